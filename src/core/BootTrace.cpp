@@ -0,0 +1,46 @@
+#include "BootTrace.hpp"
+#ifdef ARDUINO_ARCH_ESP32
+#include <esp_timer.h>
+#endif
+
+namespace BootTrace {
+  static const char* const NAMES[(uint8_t)Phase::Count] = {
+    "serial", "halBegin", "nvsLoad", "firstFrame", "server", "wifi", "mdns"
+  };
+  // 0 = not reached; written from the loop task and the Wi-Fi event task, one word each
+  static volatile uint32_t s_us[(uint8_t)Phase::Count] = {};
+
+  static uint32_t nowUs() {
+#ifdef ARDUINO_ARCH_ESP32
+    return (uint32_t)esp_timer_get_time();
+#else
+    return micros();
+#endif
+  }
+
+  void mark(Phase p) {
+    const uint8_t i = (uint8_t)p;
+    if (i >= (uint8_t)Phase::Count || s_us[i]) return;
+    const uint32_t t = nowUs();
+    s_us[i] = t ? t : 1;
+  }
+
+  bool reached(Phase p) {
+    return (uint8_t)p < (uint8_t)Phase::Count && s_us[(uint8_t)p] != 0;
+  }
+
+  void appendJson(String& out) {
+#ifdef FAST_BOOT
+    out += "{\"fastBoot\":true,\"phases\":{";
+#else
+    out += "{\"fastBoot\":false,\"phases\":{";
+#endif
+    for (uint8_t i = 0; i < (uint8_t)Phase::Count; ++i) {
+      if (i) out += ',';
+      out += '"'; out += NAMES[i]; out += "\":";
+      const uint32_t t = s_us[i];
+      if (t) out += String(t); else out += "null";
+    }
+    out += "}}";
+  }
+}
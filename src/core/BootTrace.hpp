@@ -0,0 +1,23 @@
+#pragma once
+#include <Arduino.h>
+
+// Boot-phase timestamps (microseconds since reset), recorded once per phase.
+// Served as JSON by /api/boot so boot regressions can be spotted remotely.
+namespace BootTrace {
+  enum class Phase : uint8_t {
+    Serial,      // console ready (or skipped in FAST_BOOT)
+    HalBegin,    // display driver initialised
+    NvsLoad,     // configuration loaded
+    FirstFrame,  // first display frame rendered by the HAL loop
+    Server,      // web server listening
+    Wifi,        // STA got an IP
+    Mdns,        // mDNS responder started
+    Count
+  };
+
+  // Record the current time for a phase; later calls for the same phase are ignored
+  void mark(Phase p);
+  bool reached(Phase p);
+  // {"fastBoot":bool,"phases":{"serial":us,...}} (phases not yet reached are null)
+  void appendJson(String& out);
+}
@@ -1,60 +1,377 @@
 #include "Config.hpp"
 #include <Preferences.h>
+#include <ctype.h>
+#ifdef ARDUINO_ARCH_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
 
 static const char* NS = "cfg";
+static const char* BLOB_KEY = "blob";
+
+// Binary record layout (little-endian):
+//   uint32 magic 'EZCF' | uint16 version | uint16 payload length | uint32 CRC-32 of payload | payload
+// Payload fields are written in declaration order; strings are length-prefixed (uint8, max 255 bytes).
+// Adding fields at the end keeps the version: shorter records decode with defaults for the rest.
+static constexpr uint32_t BLOB_MAGIC = 0x46435A45; // "EZCF"
+static constexpr uint16_t BLOB_VERSION = 1;
+static constexpr size_t BLOB_HEADER = 12;
+
+// Keys used before the single-record format; read once for migration then removed
+#define EZ_CFG_LEGACY_KEY(g, m, kind, def, lo, hi, json, param, legacy) legacy,
+static const char* const LEGACY_KEYS[] = { EZ_CONFIG_FIELDS(EZ_CFG_LEGACY_KEY) };
+#undef EZ_CFG_LEGACY_KEY
+
+// CRC-32 (IEEE, reflected) four bits at a time: a 64-byte table instead of 1 KB
+static uint32_t crc32(const uint8_t* data, size_t len) {
+  static const uint32_t NIBBLE[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C };
+  uint32_t crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < len; ++i) {
+    crc ^= data[i];
+    crc = (crc >> 4) ^ NIBBLE[crc & 0x0F];
+    crc = (crc >> 4) ^ NIBBLE[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+// Appends fields to a buffer; with buf == nullptr it only measures
+class BlobWriter {
+public:
+  explicit BlobWriter(uint8_t* buf) : _buf(buf) {}
+  void u8(uint8_t v) { if (_buf) _buf[_pos] = v; _pos += 1; }
+  void u16(uint16_t v) { u8(v & 0xFF); u8(v >> 8); }
+  void u32(uint32_t v) { u16(v & 0xFFFF); u16(v >> 16); }
+  void str(const String& s) {
+    const size_t n = s.length() > 255 ? 255 : s.length();
+    u8((uint8_t)n);
+    if (_buf) memcpy(_buf + _pos, s.c_str(), n);
+    _pos += n;
+  }
+  void put(const String& v) { str(v); }
+  void put(bool v) { u8(v ? 1 : 0); }
+  void put(uint8_t v) { u8(v); }
+  void put(uint16_t v) { u16(v); }
+  size_t size() const { return _pos; }
+private:
+  uint8_t* _buf;
+  size_t _pos{0};
+};
+
+class BlobReader {
+public:
+  BlobReader(const uint8_t* buf, size_t len) : _buf(buf), _len(len) {}
+  uint8_t u8() { if (_pos + 1 > _len) { _ok = false; return 0; } return _buf[_pos++]; }
+  uint16_t u16() { uint16_t lo = u8(); return lo | (uint16_t)(u8() << 8); }
+  uint32_t u32() { uint32_t lo = u16(); return lo | ((uint32_t)u16() << 16); }
+  String str() {
+    const uint8_t n = u8();
+    if (_pos + n > _len) { _ok = false; return String(); }
+    char tmp[256];
+    memcpy(tmp, _buf + _pos, n);
+    tmp[n] = 0;
+    _pos += n;
+    return String(tmp);
+  }
+  void get(String& v) { v = str(); }
+  void get(bool& v) { v = u8() != 0; }
+  void get(uint8_t& v) { v = u8(); }
+  void get(uint16_t& v) { v = u16(); }
+  bool ok() const { return _ok; }
+  bool atEnd() const { return _pos >= _len; }
+private:
+  const uint8_t* _buf;
+  size_t _len;
+  size_t _pos{0};
+  bool _ok{true};
+};
+
+#define EZ_CFG_PUT(g, m, ...) w.put(c.g.m);
+// Fields appended after a record was written are missing from it and keep their defaults
+#define EZ_CFG_GET(g, m, ...) if (!r.atEnd()) r.get(t.g.m);
+
+static void encode(const Config& c, BlobWriter& w) {
+  EZ_CONFIG_FIELDS(EZ_CFG_PUT)
+}
+
+static bool decode(Config& c, BlobReader& r) {
+  Config t = c; // decode into a copy so a truncated record leaves c untouched
+  EZ_CONFIG_FIELDS(EZ_CFG_GET)
+  if (!r.ok()) return false;
+  c = t;
+  return true;
+}
+
+static bool loadBlob(Preferences& p, Config& c) {
+  const size_t len = p.getBytesLength(BLOB_KEY);
+  if (len < BLOB_HEADER) return false;
+  uint8_t* buf = (uint8_t*)malloc(len);
+  if (!buf) return false;
+  bool ok = (p.getBytes(BLOB_KEY, buf, len) == len);
+  if (ok) {
+    BlobReader h(buf, BLOB_HEADER);
+    const uint32_t magic = h.u32();
+    const uint16_t version = h.u16();
+    const uint16_t plen = h.u16();
+    const uint32_t crc = h.u32();
+    ok = magic == BLOB_MAGIC && version == BLOB_VERSION && (size_t)plen + BLOB_HEADER == len &&
+         crc32(buf + BLOB_HEADER, plen) == crc;
+    if (ok) {
+      BlobReader r(buf + BLOB_HEADER, plen);
+      ok = decode(c, r);
+    }
+  }
+  free(buf);
+  return ok;
+}
+
+static void legacyGet(Preferences& p, const char* key, String& v) { v = p.getString(key, v); }
+static void legacyGet(Preferences& p, const char* key, bool& v) { v = p.getBool(key, v); }
+static void legacyGet(Preferences& p, const char* key, uint8_t& v) { v = p.getUChar(key, v); }
+static void legacyGet(Preferences& p, const char* key, uint16_t& v) { v = p.getUShort(key, v); }
+
+#define EZ_CFG_LEGACY_GET(g, m, kind, def, lo, hi, json, param, legacy) legacyGet(p, legacy, c.g.m);
+
+static void loadLegacy(Preferences& p, Config& c) {
+  EZ_CONFIG_FIELDS(EZ_CFG_LEGACY_GET)
+}
 
 bool Config::load() {
   Preferences p;
   if (!p.begin(NS, true)) return false;
-  wifi.ssid = p.getString("w_ssid", "");
-  wifi.password = p.getString("w_pwd", "");
-  ntp.server = p.getString("n_srv", ntp.server);
-  ntp.timezone = p.getString("n_tz", ntp.timezone);
-  mqtt.enabled = p.getBool("m_en", mqtt.enabled);
-  mqtt.host = p.getString("m_host", mqtt.host);
-  mqtt.port = p.getUShort("m_port", mqtt.port);
-  mqtt.user = p.getString("m_user", mqtt.user);
-  mqtt.pass = p.getString("m_pass", mqtt.pass);
-  mqtt.baseTopic = p.getString("m_base", mqtt.baseTopic);
-  net.hostname = p.getString("net_host", net.hostname);
-  led.colorHex = p.getString("l_hex", led.colorHex);
-  led.brightness = p.getUChar("l_bri", led.brightness);
-  led.fadeMs = p.getUShort("l_fade", led.fadeMs);
-  led.autoHue = p.getBool("l_ah_en", led.autoHue);
-  led.autoHueDegPerMin = p.getUShort("l_ah_dpm", led.autoHueDegPerMin);
-  led.ambientMinPct = p.getUChar("l_ab_min", led.ambientMinPct);
-  led.ambientMaxPct = p.getUChar("l_ab_max", led.ambientMaxPct);
-  led.ambientFullPowerThreshold = p.getUShort("l_ab_thr", led.ambientFullPowerThreshold);
-  led.ambientSampleMs = p.getUShort("l_ab_ms", led.ambientSampleMs);
-  led.ambientAvgCount = p.getUChar("l_ab_cnt", led.ambientAvgCount);
+  if (loadBlob(p, *this)) { p.end(); return true; }
+  const bool legacy = p.isKey("w_ssid") || p.isKey("l_hex") || p.isKey("n_tz");
+  if (legacy) loadLegacy(p, *this);
   p.end();
+  if (legacy) {
+    // One-time migration: write the single record, then drop the per-field entries
+    if (save()) {
+      Preferences w;
+      if (w.begin(NS, false)) {
+        for (const char* k : LEGACY_KEYS) w.remove(k);
+        w.end();
+      }
+    }
+  }
   return true;
 }
 
+// True when the stored record already holds these bytes
+static bool sameRecord(Preferences& p, const uint8_t* buf, size_t len) {
+  if (p.getBytesLength(BLOB_KEY) != len) return false;
+  uint8_t* old = (uint8_t*)malloc(len);
+  const bool same = old && p.getBytes(BLOB_KEY, old, len) == len && memcmp(old, buf, len) == 0;
+  free(old);
+  return same;
+}
+
 bool Config::save() const {
+  BlobWriter measure(nullptr);
+  encode(*this, measure);
+  const size_t plen = measure.size();
+  const size_t total = BLOB_HEADER + plen;
+  uint8_t* buf = (uint8_t*)malloc(total);
+  if (!buf) return false;
+  BlobWriter body(buf + BLOB_HEADER);
+  encode(*this, body);
+  BlobWriter head(buf);
+  head.u32(BLOB_MAGIC);
+  head.u16(BLOB_VERSION);
+  head.u16((uint16_t)plen);
+  head.u32(crc32(buf + BLOB_HEADER, plen));
   Preferences p;
-  if (!p.begin(NS, false)) return false;
-  p.putString("w_ssid", wifi.ssid);
-  p.putString("w_pwd", wifi.password);
-  p.putString("n_srv", ntp.server);
-  p.putString("n_tz", ntp.timezone);
-  p.putBool("m_en", mqtt.enabled);
-  p.putString("m_host", mqtt.host);
-  p.putUShort("m_port", mqtt.port);
-  p.putString("m_user", mqtt.user);
-  p.putString("m_pass", mqtt.pass);
-  p.putString("m_base", mqtt.baseTopic);
-  p.putString("net_host", net.hostname);
-  p.putString("l_hex", led.colorHex);
-  p.putUChar("l_bri", led.brightness);
-  p.putUShort("l_fade", led.fadeMs);
-  p.putBool("l_ah_en", led.autoHue);
-  p.putUShort("l_ah_dpm", led.autoHueDegPerMin);
-  p.putUChar("l_ab_min", led.ambientMinPct);
-  p.putUChar("l_ab_max", led.ambientMaxPct);
-  p.putUShort("l_ab_thr", led.ambientFullPowerThreshold);
-  p.putUShort("l_ab_ms", led.ambientSampleMs);
-  p.putUChar("l_ab_cnt", led.ambientAvgCount);
-  p.end();
+  bool ok = p.begin(NS, false);
+  if (ok) {
+    // A value set and set back before commit() leaves the record as stored: no flash write
+    if (!sameRecord(p, buf, total)) ok = (p.putBytes(BLOB_KEY, buf, total) == total);
+    p.end();
+  }
+  free(buf);
+  return ok;
+}
+
+// ---- request parsing (one parser per field kind) ----
+
+static Config::SetResult store(String& dst, const String& v) {
+  if (dst == v) return Config::SetResult::Unchanged;
+  dst = v;
+  return Config::SetResult::Changed;
+}
+
+template <typename T>
+static Config::SetResult storeNum(T& dst, long v) {
+  if (dst == (T)v) return Config::SetResult::Unchanged;
+  dst = (T)v;
+  return Config::SetResult::Changed;
+}
+
+static Config::SetResult parseBool(bool& dst, const String& in, long, long, bool) {
+  String s = in; s.trim();
+  const bool v = (s == "1" || s.equalsIgnoreCase("true") || s.equalsIgnoreCase("on"));
+  return storeNum(dst, v ? 1 : 0);
+}
+
+template <typename T>
+static Config::SetResult parseNum(T& dst, const String& in, long lo, long hi) {
+  long v = in.toInt();
+  if (v < lo) v = lo;
+  if (v > hi) v = hi;
+  return storeNum(dst, v);
+}
+static Config::SetResult parseU8(uint8_t& dst, const String& in, long lo, long hi, long) { return parseNum(dst, in, lo, hi); }
+static Config::SetResult parseU16(uint16_t& dst, const String& in, long lo, long hi, long) { return parseNum(dst, in, lo, hi); }
+
+static Config::SetResult parseText(String& dst, const String& in, long, long hi, const char*) {
+  if ((long)in.length() > hi) return Config::SetResult::Invalid;
+  return store(dst, in);
+}
+
+static Config::SetResult parseRequired(String& dst, const String& in, long, long hi, const char*) {
+  String s = in; s.trim();
+  if (s.isEmpty() || (long)s.length() > hi) return Config::SetResult::Invalid;
+  return store(dst, s);
+}
+
+static Config::SetResult parseSecret(String& dst, const String& in, long lo, long hi, const char* def) {
+  if (in.isEmpty()) return Config::SetResult::Unchanged;
+  return parseText(dst, in, lo, hi, def);
+}
+
+static Config::SetResult parseColor(String& dst, const String& in, long, long, const char*) {
+  uint8_t r, g, b;
+  if (!parseHexColor(in, r, g, b)) return Config::SetResult::Invalid;
+  String s = in; s.trim();
+  if (!s.startsWith("#")) s = String("#") + s;
+  return store(dst, s);
+}
+
+static Config::SetResult parseHost(String& dst, const String& in, long, long hi, const char* def) {
+  // mDNS label rules: 1..hi chars, alnum and dash only
+  String s = in; s.trim();
+  if (s.isEmpty()) s = def;
+  if ((long)s.length() > hi) s = s.substring(0, hi);
+  for (size_t i = 0; i < s.length(); ++i) {
+    const char c = s[i];
+    if (!(isalnum((unsigned char)c) || c == '-')) s.setCharAt(i, '-');
+  }
+  return store(dst, s);
+}
+
+bool parseHexColor(const String& hex, uint8_t& r, uint8_t& g, uint8_t& b) {
+  String s = hex; s.trim();
+  if (s.startsWith("#")) s.remove(0, 1);
+  if (s.length() != 6) return false;
+  for (size_t i = 0; i < 6; ++i) if (!isxdigit((unsigned char)s[i])) return false;
+  const long v = strtol(s.c_str(), nullptr, 16);
+  r = (v >> 16) & 0xFF; g = (v >> 8) & 0xFF; b = v & 0xFF;
   return true;
 }
+
+Config::SetResult Config::set(Field f, const String& value, bool apply) {
+  SetResult r = SetResult::Invalid;
+  switch (f) {
+#define EZ_CFG_SET(g, m, kind, def, lo, hi, json, param, legacy) \
+    case Field::g##_##m: { auto tmp = g.m; r = parse##kind(tmp, value, lo, hi, def); if (apply && r == SetResult::Changed) g.m = tmp; break; }
+    EZ_CONFIG_FIELDS(EZ_CFG_SET)
+#undef EZ_CFG_SET
+    default: break;
+  }
+  if (apply && r == SetResult::Changed) _pending |= bit(f);
+  return r;
+}
+
+const char* Config::paramKey(Field f) {
+  static const char* const KEYS[] = {
+#define EZ_CFG_PARAM(g, m, kind, def, lo, hi, json, param, legacy) param,
+    EZ_CONFIG_FIELDS(EZ_CFG_PARAM)
+#undef EZ_CFG_PARAM
+  };
+  return (uint8_t)f < (uint8_t)Field::Count ? KEYS[(uint8_t)f] : "";
+}
+
+// ---- cross-task access ----
+
+#ifdef ARDUINO_ARCH_ESP32
+static SemaphoreHandle_t lockHandle() {
+  static SemaphoreHandle_t m = xSemaphoreCreateRecursiveMutex();
+  return m;
+}
+Config::Lock::Lock() { xSemaphoreTakeRecursive(lockHandle(), portMAX_DELAY); }
+Config::Lock::~Lock() { xSemaphoreGiveRecursive(lockHandle()); }
+#else
+Config::Lock::Lock() {}
+Config::Lock::~Lock() {}
+#endif
+
+// ---- change notification ----
+
+struct Subscriber {
+  Config::FieldMask mask;
+  std::function<void(const Config&)> fn;
+};
+static constexpr uint8_t MAX_SUBSCRIBERS = 16;
+static Subscriber s_subs[MAX_SUBSCRIBERS];
+static uint8_t s_subCount = 0;
+
+void Config::onChange(FieldMask fields, std::function<void(const Config&)> fn) {
+  if (s_subCount < MAX_SUBSCRIBERS) s_subs[s_subCount++] = Subscriber{fields, fn};
+}
+
+void Config::notify(FieldMask fields) const {
+  for (uint8_t i = 0; i < s_subCount; ++i) {
+    if (s_subs[i].mask & fields) s_subs[i].fn(*this);
+  }
+}
+
+bool Config::commit() {
+  // Cross-field rule: ambient max never below min
+  if (led.ambientMaxPct < led.ambientMinPct) {
+    led.ambientMaxPct = led.ambientMinPct;
+    _pending |= bit(Field::led_ambientMaxPct);
+  }
+  if (!_pending) return true;
+  const FieldMask changed = _pending;
+  _pending = 0;
+  const bool ok = save();
+  notify(changed);
+  return ok;
+}
+
+// ---- JSON output ----
+
+static void jsonKey(String& out, bool& first, const char* key) {
+  if (!first) out += ',';
+  first = false;
+  out += '"'; out += key; out += "\":";
+}
+static void jsonValue(String& out, const String& v) {
+  out += '"';
+  for (size_t i = 0; i < v.length(); ++i) {
+    const char c = v[i];
+    if (c == '"' || c == '\\') out += '\\';
+    out += c;
+  }
+  out += '"';
+}
+static void jsonValue(String& out, bool v) { out += v ? "true" : "false"; }
+static void jsonValue(String& out, uint8_t v) { out += String((unsigned)v); }
+static void jsonValue(String& out, uint16_t v) { out += String((unsigned)v); }
+
+template <typename T>
+static void jsonField(String& out, bool& first, const char* key, const T& v) {
+  if (!key) return;
+  jsonKey(out, first, key);
+  jsonValue(out, v);
+}
+
+#define EZ_CFG_JSON(g, m, kind, def, lo, hi, json, param, legacy) jsonField(out, first, json, g.m);
+
+void Config::appendJson(String& out) const {
+  // wifi is intentionally absent: its fields are credentials
+  bool first;
+  out += "\"ntp\":{"; first = true; EZ_NTP_FIELDS(EZ_CFG_JSON) out += "},";
+  out += "\"net\":{"; first = true; EZ_NET_FIELDS(EZ_CFG_JSON) out += "},";
+  out += "\"mqtt\":{"; first = true; EZ_MQTT_FIELDS(EZ_CFG_JSON) out += "},";
+  out += "\"led\":{"; first = true; EZ_LED_FIELDS(EZ_CFG_JSON) out += "}";
+}
@@ -1,44 +1,81 @@
 #pragma once
 #include <Arduino.h>
+#include <functional>
 
-struct WifiConfig {
-  String ssid;
-  String password;
-};
+// Config field registry. Every persisted setting is declared exactly once here:
+//   X(group, member, kind, default, min, max, jsonKey, paramKey, legacyNvsKey)
+// kind: Bool / U8 / U16 (values clamped to [min, max]) or one of the string kinds
+//   Text     - stored as given (max = length)
+//   Required - trimmed, must not be empty
+//   Secret   - an empty value keeps the stored one
+//   Color    - "#RRGGBB" (leading '#' optional on input)
+//   Host     - mDNS label: alnum and '-', empty falls back to the default
+// jsonKey nullptr keeps the field out of /api/status.
+// The NVS record stores fields in list order and older records simply end
+// early, so new fields must be appended after the last entry of the last list.
+// Struct members, NVS persistence, request parsing, JSON output and change
+// notifications are all generated from these lists.
+#define EZ_WIFI_FIELDS(X) \
+  X(wifi, ssid,     Required, "", 0, 32, nullptr, "ssid",     "w_ssid") \
+  X(wifi, password, Text,     "", 0, 64, nullptr, "password", "w_pwd")
 
-struct NtpConfig {
-  String server = "pool.ntp.org";
-  String timezone = "UTC0"; // POSIX TZ string
-};
+#define EZ_NTP_FIELDS(X) \
+  X(ntp, server,   Required, "pool.ntp.org", 0, 63, "server",   "server", "n_srv") \
+  X(ntp, timezone, Required, "UTC0",         0, 63, "timezone", "tz",     "n_tz") /* POSIX TZ string */
 
-struct MqttConfig {
-  bool enabled = false;
-  String host;
-  uint16_t port = 1883;
-  String user;
-  String pass;
-  String baseTopic = "ezclock";
-};
+#define EZ_MQTT_FIELDS(X) \
+  X(mqtt, enabled,   Bool,     false,     0, 1,     "enabled",   "enabled",   "m_en") \
+  X(mqtt, host,      Text,     "",        0, 63,    "host",      "host",      "m_host") \
+  X(mqtt, port,      U16,      1883,      1, 65535, "port",      "port",      "m_port") \
+  X(mqtt, user,      Text,     "",        0, 63,    "user",      "user",      "m_user") \
+  X(mqtt, pass,      Secret,   "",        0, 63,    nullptr,     "pass",      "m_pass") \
+  X(mqtt, baseTopic, Required, "ezclock", 0, 63,    "baseTopic", "baseTopic", "m_base")
 
-struct NetConfig {
-  // Device hostname used for mDNS (.local)
-  String hostname = "ezQlock";
-};
+#define EZ_NET_FIELDS(X) \
+  X(net, hostname, Host, "ezQlock", 0, 23, "hostname", "hostname", "net_host") /* mDNS (.local) name */
 
-struct LedConfig {
-  String colorHex = "#6633FF";
-  uint8_t brightness = 64;
-  uint16_t fadeMs = 300; // smoothing duration for digit transitions
-  bool autoHue = false;           // enable hue auto-rotation
-  uint16_t autoHueDegPerMin = 2;  // degrees per minute (0..360)
-  // Ambient-based brightness control
-  uint8_t ambientMinPct = 10;           // 0..100
-  uint8_t ambientMaxPct = 100;          // 0..100
-  uint16_t ambientFullPowerThreshold = 1000; // 0..4095 (ADC)
-  // Ambient sampling settings
-  uint16_t ambientSampleMs = 250; // sampling period in ms
-  uint8_t ambientAvgCount = 20;   // number of samples in running average
-};
+#define EZ_LED_FIELDS(X) \
+  X(led, colorHex,                  Color, "#6633FF", 0,  7,    "hex",                       "hex",       "l_hex") \
+  X(led, brightness,                U8,    64,        0,  255,  "brightness",                "brightness", "l_bri") \
+  X(led, fadeMs,                    U16,   300,       0,  5000, "fade",                      "ms",        "l_fade")   /* digit transition smoothing */ \
+  X(led, autoHue,                   Bool,  false,     0,  1,    "autoHue",                   "enabled",   "l_ah_en")  /* hue auto-rotation */ \
+  X(led, autoHueDegPerMin,          U16,   2,         0,  360,  "autoHueDegPerMin",          "degPerMin", "l_ah_dpm") \
+  X(led, ambientMinPct,             U8,    10,        0,  100,  "ambientMinPct",             "minPct",    "l_ab_min") \
+  X(led, ambientMaxPct,             U8,    100,       0,  100,  "ambientMaxPct",             "maxPct",    "l_ab_max") \
+  X(led, ambientFullPowerThreshold, U16,   1000,      0,  4095, "ambientFullPowerThreshold", "threshold", "l_ab_thr") /* ADC counts */ \
+  X(led, ambientSampleMs,           U16,   250,       50, 5000, "ambientSampleMs",           "periodMs",  "l_ab_ms") \
+  X(led, ambientAvgCount,           U8,    20,        1,  60,   "ambientAvgCount",           "avgCount",  "l_ab_cnt") /* running average window */ \
+  X(led, ambientFilter,             U8,    0,         0,  2,    "ambientFilter",             "filter",    "l_ab_flt") /* 0 avg, 1 EMA, 2 median */ \
+  X(led, ambientCurve,              U8,    0,         0,  2,    "ambientCurve",              "curve",     "l_ab_crv") /* 0 linear, 1 gamma, 2 CIE L* */ \
+  X(led, paletteMode,               U8,    0,         0,  2,    "paletteMode",               "mode",      "l_pal_md") /* 0 single color, 1 per word group, 2 gradient */ \
+  X(led, colorPrefix,               Color, "#FFFFFF", 0,  7,    "colorPrefix",               "prefix",    "l_pal_pre") \
+  X(led, colorMinutes,              Color, "#33CCFF", 0,  7,    "colorMinutes",              "minutes",   "l_pal_min") /* also the gradient end */ \
+  X(led, colorDots,                 Color, "#FF9933", 0,  7,    "colorDots",                 "dots",      "l_pal_dot")
+
+#define EZ_CONFIG_FIELDS(X) \
+  EZ_WIFI_FIELDS(X) EZ_NTP_FIELDS(X) EZ_MQTT_FIELDS(X) EZ_NET_FIELDS(X) EZ_LED_FIELDS(X)
+
+#define EZ_CFG_TYPE_Bool     bool
+#define EZ_CFG_TYPE_U8       uint8_t
+#define EZ_CFG_TYPE_U16      uint16_t
+#define EZ_CFG_TYPE_Text     String
+#define EZ_CFG_TYPE_Required String
+#define EZ_CFG_TYPE_Secret   String
+#define EZ_CFG_TYPE_Color    String
+#define EZ_CFG_TYPE_Host     String
+
+#define EZ_CFG_DECLARE(g, m, kind, def, lo, hi, json, param, legacy) EZ_CFG_TYPE_##kind m = def;
+#define EZ_CFG_ENUM(g, m, ...) g##_##m,
+#define EZ_CFG_BIT(g, m, ...) | ((FieldMask)1 << (uint8_t)Field::g##_##m)
+
+struct WifiConfig { EZ_WIFI_FIELDS(EZ_CFG_DECLARE) };
+struct NtpConfig  { EZ_NTP_FIELDS(EZ_CFG_DECLARE) };
+struct MqttConfig { EZ_MQTT_FIELDS(EZ_CFG_DECLARE) };
+struct NetConfig  { EZ_NET_FIELDS(EZ_CFG_DECLARE) };
+struct LedConfig  { EZ_LED_FIELDS(EZ_CFG_DECLARE) };
+
+// Parse "#RRGGBB" / "RRGGBB" into components; false if malformed
+bool parseHexColor(const String& hex, uint8_t& r, uint8_t& g, uint8_t& b);
 
 struct Config {
   WifiConfig wifi;
@@ -47,6 +84,47 @@ struct Config {
   NetConfig net;
   LedConfig led;
 
+  enum class Field : uint8_t { EZ_CONFIG_FIELDS(EZ_CFG_ENUM) Count };
+  using FieldMask = uint32_t;
+  static_assert((uint8_t)Field::Count <= 32, "FieldMask too narrow");
+
+  static constexpr FieldMask WIFI_MASK = 0 EZ_WIFI_FIELDS(EZ_CFG_BIT);
+  static constexpr FieldMask NTP_MASK  = 0 EZ_NTP_FIELDS(EZ_CFG_BIT);
+  static constexpr FieldMask MQTT_MASK = 0 EZ_MQTT_FIELDS(EZ_CFG_BIT);
+  static constexpr FieldMask NET_MASK  = 0 EZ_NET_FIELDS(EZ_CFG_BIT);
+  static constexpr FieldMask LED_MASK  = 0 EZ_LED_FIELDS(EZ_CFG_BIT);
+  static constexpr FieldMask bit(Field f) { return (FieldMask)1 << (uint8_t)f; }
+
+  enum class SetResult : uint8_t { Unchanged, Changed, Invalid };
+
+  // Held around set()/commit() and reads of String fields outside setup(): the
+  // web server (AsyncTCP task), MQTT commands (loop task) and Wi-Fi events all
+  // touch the config. Recursive, so subscribers run by commit() may take it.
+  class Lock {
+  public:
+    Lock();
+    ~Lock();
+    Lock(const Lock&) = delete;
+    Lock& operator=(const Lock&) = delete;
+  };
+
   bool load();
   bool save() const;
+
+  // Parse, clamp and validate a textual value; with apply=false only validates.
+  // Changed fields are staged until commit().
+  SetResult set(Field f, const String& value, bool apply = true);
+  // Persist staged changes (if any) and notify subscribers of the changed fields
+  bool commit();
+  // Invoke subscribers for the given fields (e.g. initial application at boot)
+  void notify(FieldMask fields) const;
+  // Register a callback for changes to any field in the mask
+  static void onChange(FieldMask fields, std::function<void(const Config&)> fn);
+
+  // Append "ntp":{..},"net":{..},"mqtt":{..},"led":{..} (exposed fields only)
+  void appendJson(String& out) const;
+  static const char* paramKey(Field f);
+
+private:
+  FieldMask _pending{0};
 };
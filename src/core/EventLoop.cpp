@@ -0,0 +1,149 @@
+#include "EventLoop.hpp"
+#include "Log.hpp"
+#ifdef ARDUINO_ARCH_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_idf_version.h>
+#include <esp_pm.h>
+#endif
+
+// Tunables (override with -D flags)
+#ifndef EVENT_MAX_IDLE_MS
+#define EVENT_MAX_IDLE_MS 10000  // longest wait when no stage asked for an earlier wakeup (every stage
+                                 // that polls asks for its own deadline; this only bounds a missed one)
+#endif
+#ifndef EVENT_MIN_WAIT_MS
+#define EVENT_MIN_WAIT_MS 1      // always block at least one tick so lower-priority tasks run
+#endif
+#ifndef EVENT_LIGHT_SLEEP
+#define EVENT_LIGHT_SLEEP 0      // 1 = automatic light sleep while blocked (needs CONFIG_PM_ENABLE and
+                                 // tickless idle in the SDK; USB CDC drops out while asleep)
+#endif
+#ifndef EVENT_SLEEP_MIN_MHZ
+#define EVENT_SLEEP_MIN_MHZ 40   // CPU clock while idle under power management (XTAL)
+#endif
+
+namespace EventLoop {
+  static constexpr uint8_t EVENTS = (uint8_t)Event::Count;
+  static const char* const NAMES[EVENTS] = { "web", "mqtt", "net", "render" };
+
+  // One measurement window (a minute of loop time)
+  struct Window {
+    uint32_t startMs;
+    uint32_t spanMs;     // length once closed
+    uint32_t wakeups;
+    uint32_t events;     // wakeups caused by a posted event
+    uint32_t blockedUs;  // time spent in wait()
+  };
+
+#ifdef ARDUINO_ARCH_ESP32
+  static TaskHandle_t s_task = nullptr;
+#endif
+  static uint32_t s_deadlineMs = EVENT_MAX_IDLE_MS;
+  static uint32_t s_wakeups = 0;
+  static uint32_t s_timerWakeups = 0;
+  static uint32_t s_eventWakeups[EVENTS] = {};
+  static Window s_cur{};
+  static Window s_lastMinute{};
+  static Window s_lastIdleMinute{}; // most recent minute without any event wakeup
+  static bool s_sleepAllowed = false;
+  static bool s_sleepActive = false;
+
+  void begin() {
+#ifdef ARDUINO_ARCH_ESP32
+    s_task = xTaskGetCurrentTaskHandle();
+#endif
+    s_cur = Window();
+    s_cur.startMs = millis();
+  }
+
+  void post(Event e) {
+#ifdef ARDUINO_ARCH_ESP32
+    if (s_task && (uint8_t)e < EVENTS) xTaskNotify(s_task, 1UL << (uint8_t)e, eSetBits);
+#endif
+  }
+
+  void wakeIn(uint32_t ms) {
+    if (ms < s_deadlineMs) s_deadlineMs = ms;
+  }
+
+  static void account(uint32_t bits, uint32_t blockedUs) {
+    s_wakeups++;
+    s_cur.wakeups++;
+    s_cur.blockedUs += blockedUs;
+    if (bits) {
+      s_cur.events++;
+      for (uint8_t i = 0; i < EVENTS; ++i) if (bits & (1UL << i)) s_eventWakeups[i]++;
+    } else {
+      s_timerWakeups++;
+    }
+    const uint32_t nowMs = millis();
+    if (nowMs - s_cur.startMs < 60000UL) return;
+    s_cur.spanMs = nowMs - s_cur.startMs;
+    s_lastMinute = s_cur;
+    if (!s_cur.events) s_lastIdleMinute = s_cur;
+    s_cur = Window();
+    s_cur.startMs = nowMs;
+  }
+
+  void wait() {
+    uint32_t ms = s_deadlineMs;
+    s_deadlineMs = EVENT_MAX_IDLE_MS;
+    if (ms < EVENT_MIN_WAIT_MS) ms = EVENT_MIN_WAIT_MS;
+    const uint32_t t0 = micros();
+    uint32_t bits = 0;
+#ifdef ARDUINO_ARCH_ESP32
+    if (s_task) xTaskNotifyWait(0, UINT32_MAX, &bits, pdMS_TO_TICKS(ms));
+    else delay(ms);
+#else
+    delay(ms);
+#endif
+    account(bits, micros() - t0);
+  }
+
+  void allowLightSleep(bool allowed) {
+    s_sleepAllowed = allowed;
+#if EVENT_LIGHT_SLEEP && defined(ARDUINO_ARCH_ESP32)
+  #if ESP_IDF_VERSION_MAJOR >= 5
+    esp_pm_config_t pm{};
+  #else
+    esp_pm_config_esp32c3_t pm{};
+  #endif
+    pm.max_freq_mhz = (int)ESP.getCpuFreqMHz();
+    pm.min_freq_mhz = EVENT_SLEEP_MIN_MHZ;
+    pm.light_sleep_enable = allowed;
+    const esp_err_t err = esp_pm_configure(&pm);
+    s_sleepActive = allowed && err == ESP_OK;
+    if (err != ESP_OK) LOGW("light sleep: esp_pm_configure failed (%s)", esp_err_to_name(err));
+    else LOGI("light sleep %s", allowed ? "enabled" : "disabled");
+#endif
+  }
+
+  static void appendWindow(String& out, const char* name, const Window& w) {
+    char buf[140];
+    // Wakeups per second and the share of the minute spent blocked in wait()
+    const uint32_t perSecX100 = w.spanMs ? (uint32_t)((uint64_t)w.wakeups * 100000ULL / w.spanMs) : 0;
+    const uint32_t idlePct = w.spanMs ? (uint32_t)((uint64_t)w.blockedUs / 10ULL / w.spanMs) : 0;
+    snprintf(buf, sizeof(buf), "\"%s\":{\"spanMs\":%lu,\"wakeups\":%lu,\"events\":%lu,\"perSec\":%lu.%02lu,\"idlePct\":%lu}",
+             name, (unsigned long)w.spanMs, (unsigned long)w.wakeups, (unsigned long)w.events,
+             (unsigned long)(perSecX100 / 100), (unsigned long)(perSecX100 % 100), (unsigned long)idlePct);
+    out += buf;
+  }
+
+  void appendJson(String& out) {
+    char buf[96];
+    snprintf(buf, sizeof(buf), "{\"wakeups\":%lu,\"maxIdleMs\":%u,\"causes\":{\"timer\":%lu",
+             (unsigned long)s_wakeups, (unsigned)EVENT_MAX_IDLE_MS, (unsigned long)s_timerWakeups);
+    out += buf;
+    for (uint8_t i = 0; i < EVENTS; ++i) {
+      out += ",\""; out += NAMES[i]; out += "\":"; out += String((unsigned long)s_eventWakeups[i]);
+    }
+    out += "},";
+    appendWindow(out, "lastMinute", s_lastMinute);
+    out += ',';
+    appendWindow(out, "lastIdleMinute", s_lastIdleMinute);
+    snprintf(buf, sizeof(buf), ",\"lightSleep\":{\"built\":%s,\"allowed\":%s,\"active\":%s}}",
+             EVENT_LIGHT_SLEEP ? "true" : "false", s_sleepAllowed ? "true" : "false", s_sleepActive ? "true" : "false");
+    out += buf;
+  }
+}
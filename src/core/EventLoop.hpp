@@ -0,0 +1,35 @@
+#pragma once
+#include <Arduino.h>
+
+// Tickless main loop. Instead of a fixed delay after every pass, each stage
+// states when it next needs to run (wakeIn) and other tasks post() events;
+// wait() then blocks the loop task on its task notification until the
+// earliest deadline or the first event. While blocked the CPU idles, and with
+// EVENT_LIGHT_SLEEP the power manager may enter automatic light sleep when
+// the radio policy allows it (allowLightSleep).
+namespace EventLoop {
+  // Event sources, one notification bit each; also reported as wake causes
+  enum class Event : uint8_t {
+    Web,    // HTTP request handled (may have changed settings or the display)
+    Mqtt,   // broker connection or inbound data
+    Net,    // Wi-Fi connection change
+    Render, // first frame shown by the render task
+    Count
+  };
+
+  // Call from the loop task before the first wait()
+  void begin();
+  // Wake the loop; any task (not ISRs). No-op before begin()
+  void post(Event e);
+  // Run the loop again within ms; the earliest request of a pass wins
+  void wakeIn(uint32_t ms);
+  // Block until the earliest requested deadline or a posted event
+  void wait();
+
+  // Radio policy hook: light sleep is only allowed while Wi-Fi modem sleep is on
+  void allowLightSleep(bool allowed);
+
+  // {"wakeups":..,"maxIdleMs":..,"causes":{"timer":..,"web":..,"mqtt":..,"net":..,"render":..},
+  //  "lastMinute":{..},"lastIdleMinute":{..},"lightSleep":{..}}
+  void appendJson(String& out);
+}
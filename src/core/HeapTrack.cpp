@@ -0,0 +1,204 @@
+#include "HeapTrack.hpp"
+#include "Log.hpp"
+#include "EventLoop.hpp"
+#ifdef ARDUINO_ARCH_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_heap_caps.h>
+#endif
+
+// Tunables (override with -D flags)
+#ifndef HEAP_LOW_BLOCK_WARN
+#define HEAP_LOW_BLOCK_WARN 8192     // bytes; warn when the largest free block is smaller
+#endif
+#ifndef HEAP_CHECK_MS
+#define HEAP_CHECK_MS 10000          // largest-block sampling; the allocator keeps the free-heap minimum itself
+#endif
+#ifndef HEAP_WARN_INTERVAL_MS
+#define HEAP_WARN_INTERVAL_MS 60000  // repeat the warning at most this often while low
+#endif
+#ifndef HEAP_TRACK_TASKS
+#define HEAP_TRACK_TASKS 8           // tasks that can hold a tag at the same time
+#endif
+
+namespace HeapTrack {
+  static constexpr uint8_t TAGS = (uint8_t)Tag::Count;
+  static const char* const NAMES[TAGS] = { "other", "web", "time", "hal", "ota", "mqtt" };
+
+  struct Counters {
+    uint32_t allocs;
+    uint32_t frees;
+    uint64_t allocBytes;
+    uint64_t freeBytes;
+  };
+
+  // Per-task current tag: a small table instead of thread-local storage, whose
+  // slots are owned by the framework
+  struct TaskTag {
+    void* task;
+    uint8_t tag;
+  };
+
+#ifdef HEAP_TRACK_ALLOC
+  static Counters s_counters[TAGS];
+#endif
+  static TaskTag s_tasks[HEAP_TRACK_TASKS];
+  static uint32_t s_minLargest = UINT32_MAX;
+  static uint32_t s_lowEvents = 0;
+  static uint32_t s_lastCheckMs = 0;
+  static uint32_t s_lastWarnMs = 0;
+  static bool s_low = false;
+#ifdef ARDUINO_ARCH_ESP32
+  static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+  #define HT_LOCK() portENTER_CRITICAL(&s_mux)
+  #define HT_UNLOCK() portEXIT_CRITICAL(&s_mux)
+  static void* currentTask() { return (void*)xTaskGetCurrentTaskHandle(); }
+#else
+  #define HT_LOCK() do { } while(0)
+  #define HT_UNLOCK() do { } while(0)
+  static void* currentTask() { return nullptr; }
+#endif
+
+  // Caller holds the lock
+  static TaskTag* slotFor(void* task, bool create) {
+    TaskTag* freeSlot = nullptr;
+    for (uint8_t i = 0; i < HEAP_TRACK_TASKS; ++i) {
+      if (s_tasks[i].task == task) return &s_tasks[i];
+      if (!freeSlot && !s_tasks[i].task) freeSlot = &s_tasks[i];
+    }
+    if (create && freeSlot) freeSlot->task = task;
+    return create ? freeSlot : nullptr;
+  }
+
+  Scope::Scope(Tag t) : _prev((uint8_t)Tag::Other) {
+    void* task = currentTask();
+    HT_LOCK();
+    TaskTag* slot = slotFor(task, true);
+    if (slot) { _prev = slot->tag; slot->tag = (uint8_t)t; }
+    HT_UNLOCK();
+  }
+
+  Scope::~Scope() {
+    void* task = currentTask();
+    HT_LOCK();
+    TaskTag* slot = slotFor(task, false);
+    if (slot) {
+      slot->tag = _prev;
+      if (_prev == (uint8_t)Tag::Other) slot->task = nullptr; // outermost scope: release the slot
+    }
+    HT_UNLOCK();
+  }
+
+#ifdef HEAP_TRACK_ALLOC
+  // Caller holds the lock
+  static Counters& countersForCurrentTask() {
+    TaskTag* slot = slotFor(currentTask(), false);
+    return s_counters[slot ? slot->tag : (uint8_t)Tag::Other];
+  }
+
+  static void onAlloc(void* p, size_t size) {
+    if (!p) return;
+    HT_LOCK();
+    Counters& c = countersForCurrentTask();
+    c.allocs++;
+    c.allocBytes += size;
+    HT_UNLOCK();
+  }
+
+  static void onFree(size_t size) {
+    HT_LOCK();
+    Counters& c = countersForCurrentTask();
+    c.frees++;
+    c.freeBytes += size;
+    HT_UNLOCK();
+  }
+#endif
+
+  void loop() {
+    const uint32_t nowMs = millis();
+    const uint32_t elapsed = nowMs - s_lastCheckMs;
+    if (elapsed < HEAP_CHECK_MS) { EventLoop::wakeIn(HEAP_CHECK_MS - elapsed); return; }
+    s_lastCheckMs = nowMs;
+    EventLoop::wakeIn(HEAP_CHECK_MS);
+    const uint32_t largest = ESP.getMaxAllocHeap();
+    if (largest < s_minLargest) s_minLargest = largest;
+    const bool low = largest < HEAP_LOW_BLOCK_WARN;
+    if (low && (!s_low || nowMs - s_lastWarnMs >= HEAP_WARN_INTERVAL_MS)) {
+      if (!s_low) s_lowEvents++;
+      s_lastWarnMs = nowMs;
+      LOGW("heap: largest free block %u < %u bytes (free %u, min free %u)",
+           (unsigned)largest, (unsigned)HEAP_LOW_BLOCK_WARN, (unsigned)ESP.getFreeHeap(), (unsigned)ESP.getMinFreeHeap());
+    } else if (!low && s_low) {
+      LOGI("heap: largest free block recovered to %u bytes", (unsigned)largest);
+    }
+    s_low = low;
+  }
+
+  void appendJson(String& out) {
+    const uint32_t freeHeap = ESP.getFreeHeap();
+    const uint32_t largest = ESP.getMaxAllocHeap();
+    if (largest < s_minLargest) s_minLargest = largest;
+    char buf[200];
+    snprintf(buf, sizeof(buf),
+             "{\"free\":%u,\"minFree\":%u,\"size\":%u,\"largestBlock\":%u,\"minLargestBlock\":%u,\"fragPct\":%u,"
+             "\"lowBlockWarn\":%u,\"lowBlockEvents\":%lu,",
+             (unsigned)freeHeap, (unsigned)ESP.getMinFreeHeap(), (unsigned)ESP.getHeapSize(), (unsigned)largest,
+             (unsigned)s_minLargest, freeHeap ? (unsigned)(100 - (uint64_t)largest * 100 / freeHeap) : 0,
+             (unsigned)HEAP_LOW_BLOCK_WARN, (unsigned long)s_lowEvents);
+    out += buf;
+#ifdef HEAP_TRACK_ALLOC
+    out += "\"tracking\":true,\"tags\":[";
+    Counters snap[TAGS];
+    HT_LOCK();
+    memcpy(snap, s_counters, sizeof(snap));
+    HT_UNLOCK();
+    for (uint8_t i = 0; i < TAGS; ++i) {
+      snprintf(buf, sizeof(buf),
+               "%s{\"name\":\"%s\",\"allocs\":%lu,\"allocBytes\":%llu,\"frees\":%lu,\"freeBytes\":%llu}",
+               i ? "," : "", NAMES[i], (unsigned long)snap[i].allocs, (unsigned long long)snap[i].allocBytes,
+               (unsigned long)snap[i].frees, (unsigned long long)snap[i].freeBytes);
+      out += buf;
+    }
+    out += "]}";
+#else
+    out += "\"tracking\":false}";
+#endif
+  }
+}
+
+#ifdef HEAP_TRACK_ALLOC
+// Linker-wrapped allocator entry points (-Wl,--wrap=...)
+extern "C" {
+  void* __real_malloc(size_t size);
+  void __real_free(void* p);
+  void* __real_realloc(void* p, size_t size);
+  void* __real_calloc(size_t n, size_t size);
+
+  void* __wrap_malloc(size_t size) {
+    void* p = __real_malloc(size);
+    HeapTrack::onAlloc(p, size);
+    return p;
+  }
+
+  void __wrap_free(void* p) {
+    if (p) HeapTrack::onFree(heap_caps_get_allocated_size(p));
+    __real_free(p);
+  }
+
+  void* __wrap_realloc(void* p, size_t size) {
+    const size_t old = p ? heap_caps_get_allocated_size(p) : 0;
+    void* q = __real_realloc(p, size);
+    if (q || !size) {
+      if (p) HeapTrack::onFree(old);
+      HeapTrack::onAlloc(q, size);
+    }
+    return q;
+  }
+
+  void* __wrap_calloc(size_t n, size_t size) {
+    void* p = __real_calloc(n, size);
+    HeapTrack::onAlloc(p, n * size);
+    return p;
+  }
+}
+#endif
@@ -0,0 +1,29 @@
+#pragma once
+#include <Arduino.h>
+
+// Heap health and allocation accounting.
+// - Always on: free heap, minimum free heap, largest free block, and a warning
+//   when the largest block drops below HEAP_LOW_BLOCK_WARN (fragmentation).
+// - With -D HEAP_TRACK_ALLOC=1 plus the linker flags
+//   -Wl,--wrap=malloc,--wrap=free,--wrap=realloc,--wrap=calloc
+//   every allocation is counted against the subsystem tag active on the
+//   calling task (set with HeapTrack::Scope). Frees are charged to the tag
+//   active when they happen, so net bytes are exact only for allocations that
+//   are released within the same subsystem.
+namespace HeapTrack {
+  enum class Tag : uint8_t { Other, Web, Time, Hal, Ota, Mqtt, Count };
+
+  // RAII: attribute allocations on the current task to a tag (nests)
+  class Scope {
+  public:
+    explicit Scope(Tag t);
+    ~Scope();
+  private:
+    uint8_t _prev;
+  };
+
+  // Periodic check for the low-block warning; call from loop()
+  void loop();
+  // {"free":..,"minFree":..,"largestBlock":..,"fragPct":..,"tracking":bool,"tags":[..]}
+  void appendJson(String& out);
+}
@@ -0,0 +1,293 @@
+#include "Log.hpp"
+#include <atomic>
+#include <stdarg.h>
+#ifdef ARDUINO_ARCH_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+// Tunables (override with -D flags)
+#ifndef LOG_RING_SLOTS
+#define LOG_RING_SLOTS 32       // pending messages; power of two
+#endif
+#ifndef LOG_RING_BYTES
+#define LOG_RING_BYTES 1024     // LOG_BINARY: pending frames, packed by length; power of two
+#endif
+#ifndef LOG_LINE_MAX
+#define LOG_LINE_MAX 120        // message text per slot, longer lines are truncated
+#endif
+#ifndef LOG_TAIL_BYTES
+#define LOG_TAIL_BYTES 2048     // history kept for /api/log
+#endif
+#ifndef LOG_DRAIN_MS
+#define LOG_DRAIN_MS 1000       // drain task fallback period; writers wake it directly
+#endif
+
+#ifdef LOG_BINARY
+static_assert(LOG_RECORD_MAX <= 255, "binary frame length is one byte");
+static_assert((LOG_RING_BYTES & (LOG_RING_BYTES - 1)) == 0, "LOG_RING_BYTES must be a power of two");
+static_assert(LOG_RING_BYTES >= LOG_RECORD_MAX + 3, "LOG_RING_BYTES must hold the largest frame");
+#else
+static_assert((LOG_RING_SLOTS & (LOG_RING_SLOTS - 1)) == 0, "LOG_RING_SLOTS must be a power of two");
+#endif
+
+namespace Log {
+#ifdef LOG_BINARY
+  // Frames (0xFE, len, payload, xor) packed back to back in a byte ring, so a
+  // record takes its own size rather than a LOG_RECORD_MAX slot. Writers
+  // reserve bytes by advancing s_enq and publish by storing the 0xFE marker
+  // last; the drain task copies a frame once its marker is set and zeroes what
+  // it consumed, so stale payload bytes never read as a marker. Both counters
+  // run freely and are masked into the ring.
+  static constexpr uint32_t RING_MASK = LOG_RING_BYTES - 1;
+  static constexpr uint8_t FRAME_MARK = 0xFE;
+  static uint8_t s_bytes[LOG_RING_BYTES];
+  static std::atomic<uint32_t> s_enq{0};
+  static std::atomic<uint32_t> s_deq{0}; // written by the drain task, read by writers for free space
+  static uint32_t s_drained = 0;         // frames drained (drain task only)
+#else
+  // Bounded MPMC queue (Vyukov): each slot carries a sequence number that tells
+  // producers and the consumer whose turn it is, so no lock is needed to publish.
+  // seq is stored relative to the slot index so the zero-initialised ring is
+  // already valid before any constructor or begin() has run.
+  struct Slot {
+    std::atomic<uint32_t> seq; // expected position minus slot index
+    uint32_t ms;
+    const char* tag; // LOG_TAG literals live in flash for the program's lifetime
+    uint8_t level;
+    char text[LOG_LINE_MAX];
+  };
+
+  static Slot s_ring[LOG_RING_SLOTS];
+  static std::atomic<uint32_t> s_enq{0};
+  static uint32_t s_deq = 0; // drain task only
+#endif
+  static std::atomic<uint8_t> s_level{LOG_LEVEL};
+  static std::atomic<uint32_t> s_written{0};
+  static std::atomic<uint32_t> s_dropped{0};
+  static uint8_t s_highWater = 0;
+
+  static char s_tail[LOG_TAIL_BYTES];
+  static size_t s_tailHead = 0;   // next write position
+  static bool s_tailWrapped = false;
+#ifdef ARDUINO_ARCH_ESP32
+  static portMUX_TYPE s_tailMux = portMUX_INITIALIZER_UNLOCKED;
+  static TaskHandle_t s_task = nullptr;
+#endif
+
+#ifndef LOG_BINARY
+  static char levelChar(uint8_t level) {
+    switch (level) {
+      case Error: return 'E';
+      case Warn:  return 'W';
+      case Info:  return 'I';
+      default:    return 'D';
+    }
+  }
+#endif
+
+  void setLevel(uint8_t level) { s_level.store(level > LOG_LEVEL ? LOG_LEVEL : level, std::memory_order_relaxed); }
+  uint8_t level() { return s_level.load(std::memory_order_relaxed); }
+
+  // Count the message and wake the drain task instead of having it poll
+  static void wake() {
+    s_written.fetch_add(1, std::memory_order_relaxed);
+#ifdef ARDUINO_ARCH_ESP32
+    if (s_task) {
+      if (xPortInIsrContext()) vTaskNotifyGiveFromISR(s_task, nullptr);
+      else xTaskNotifyGive(s_task);
+    }
+#endif
+  }
+
+#ifdef LOG_BINARY
+  // Copy into the ring at a free-running position, in two parts across the end
+  static void ringCopy(uint32_t pos, const uint8_t* src, size_t n) {
+    const size_t at = pos & RING_MASK, first = min(n, (size_t)LOG_RING_BYTES - at);
+    memcpy(s_bytes + at, src, first);
+    memcpy(s_bytes, src + first, n - first);
+  }
+
+  void writeRecord(const uint8_t* rec, size_t len) {
+    if (len > LOG_RECORD_MAX) len = LOG_RECORD_MAX;
+    const uint32_t size = (uint32_t)len + 3;
+    // Reserve; a full ring drops the record rather than waiting for the drain task
+    uint32_t pos = s_enq.load(std::memory_order_relaxed);
+    do {
+      if (pos + size - s_deq.load(std::memory_order_acquire) > LOG_RING_BYTES) {
+        s_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+    } while (!s_enq.compare_exchange_weak(pos, pos + size, std::memory_order_relaxed));
+    uint8_t chk = 0;
+    for (size_t i = 0; i < len; ++i) chk ^= rec[i];
+    s_bytes[(pos + 1) & RING_MASK] = (uint8_t)len;
+    ringCopy(pos + 2, rec, len);
+    s_bytes[(pos + 2 + len) & RING_MASK] = chk;
+    __atomic_store_n(&s_bytes[pos & RING_MASK], FRAME_MARK, __ATOMIC_RELEASE);
+    wake();
+  }
+#else
+  // Claim the next slot; nullptr when the ring is full (the message is dropped
+  // rather than waiting for the drain task)
+  static Slot* claim(uint32_t& pos, uint32_t& idx) {
+    pos = s_enq.load(std::memory_order_relaxed);
+    for (;;) {
+      idx = pos & (LOG_RING_SLOTS - 1);
+      Slot* slot = &s_ring[idx];
+      const int32_t diff = (int32_t)(slot->seq.load(std::memory_order_acquire) + idx - pos);
+      if (diff == 0) {
+        if (s_enq.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) return slot;
+      } else if (diff < 0) {
+        s_dropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+      } else {
+        pos = s_enq.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  static void publish(Slot* slot, uint32_t pos, uint32_t idx) {
+    slot->seq.store(pos + 1 - idx, std::memory_order_release);
+    wake();
+  }
+
+  void write(uint8_t level, const char* tag, const char* fmt, ...) {
+    if (level > s_level.load(std::memory_order_relaxed)) return;
+    uint32_t pos, idx;
+    Slot* slot = claim(pos, idx);
+    if (!slot) return;
+    slot->ms = millis();
+    slot->tag = tag;
+    slot->level = level;
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(slot->text, sizeof(slot->text), fmt, ap);
+    va_end(ap);
+    publish(slot, pos, idx);
+  }
+#endif
+
+  static void tailAppend(const char* s, size_t n) {
+#ifdef ARDUINO_ARCH_ESP32
+    portENTER_CRITICAL(&s_tailMux);
+#endif
+    while (n) {
+      const size_t chunk = min(n, (size_t)LOG_TAIL_BYTES - s_tailHead);
+      memcpy(s_tail + s_tailHead, s, chunk);
+      s += chunk; n -= chunk;
+      s_tailHead += chunk;
+      if (s_tailHead == LOG_TAIL_BYTES) { s_tailHead = 0; s_tailWrapped = true; }
+    }
+#ifdef ARDUINO_ARCH_ESP32
+    portEXIT_CRITICAL(&s_tailMux);
+#endif
+  }
+
+#ifdef LOG_BINARY
+  // Pop and emit every published frame in order; returns the number of frames written
+  static uint32_t drain() {
+    const uint32_t pending = s_written.load(std::memory_order_relaxed) - s_drained;
+    if (pending > s_highWater) s_highWater = (uint8_t)min(pending, 255u);
+    const uint32_t pos = s_deq.load(std::memory_order_relaxed), enq = s_enq.load(std::memory_order_relaxed);
+    // Published frames up to the first reservation still being written; later ones wait for it
+    uint32_t end = pos, n = 0;
+    while (end != enq && __atomic_load_n(&s_bytes[end & RING_MASK], __ATOMIC_ACQUIRE) == FRAME_MARK) {
+      end += s_bytes[(end + 1) & RING_MASK] + 3u;
+      n++;
+    }
+    if (!n) return 0;
+    // Emitted straight from the ring in at most two runs; writers only touch reserved space
+    const uint32_t at = pos & RING_MASK, len = end - pos, first = min(len, (uint32_t)LOG_RING_BYTES - at);
+    Serial.write(s_bytes + at, first);
+    tailAppend((const char*)s_bytes + at, first);
+    if (len > first) {
+      Serial.write(s_bytes, len - first);
+      tailAppend((const char*)s_bytes, len - first);
+    }
+    memset(s_bytes + at, 0, first);
+    memset(s_bytes, 0, len - first);
+    s_deq.store(end, std::memory_order_release);
+    s_drained += n;
+    return n;
+  }
+#else
+  // Pop and emit everything currently published; returns the number of lines written
+  static uint32_t drain() {
+    const uint32_t pending = s_enq.load(std::memory_order_relaxed) - s_deq;
+    if (pending > s_highWater) s_highWater = (uint8_t)min(pending, (uint32_t)LOG_RING_SLOTS);
+    uint32_t n = 0;
+    char line[LOG_LINE_MAX + 32];
+    for (;;) {
+      const uint32_t idx = s_deq & (LOG_RING_SLOTS - 1);
+      Slot& slot = s_ring[idx];
+      if ((int32_t)(slot.seq.load(std::memory_order_acquire) + idx - (s_deq + 1)) < 0) break;
+      int len = snprintf(line, sizeof(line), "%lu [%c] %s: %s\n",
+                         (unsigned long)slot.ms, levelChar(slot.level), slot.tag, slot.text);
+      slot.seq.store(s_deq + LOG_RING_SLOTS - idx, std::memory_order_release);
+      s_deq++;
+      if (len < 0) continue;
+      if ((size_t)len >= sizeof(line)) len = sizeof(line) - 1;
+      Serial.write((const uint8_t*)line, (size_t)len);
+      tailAppend(line, (size_t)len);
+      n++;
+    }
+    return n;
+  }
+#endif
+
+#ifdef ARDUINO_ARCH_ESP32
+  static void drainTask(void*) {
+    for (;;) {
+      drain();
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LOG_DRAIN_MS));
+    }
+  }
+#endif
+
+  void begin() {
+#ifdef ARDUINO_ARCH_ESP32
+    if (s_task) return;
+    // Lowest non-idle priority: Serial output only happens when the app yields
+    xTaskCreate(drainTask, "log", 3072, nullptr, tskIDLE_PRIORITY + 1, &s_task);
+#endif
+  }
+
+  String tail() {
+    String out;
+    out.reserve(LOG_TAIL_BYTES + 1);
+#ifdef ARDUINO_ARCH_ESP32
+    // Copy under the lock, build the String outside it
+    static char snap[LOG_TAIL_BYTES];
+    size_t head; bool wrapped;
+    portENTER_CRITICAL(&s_tailMux);
+    memcpy(snap, s_tail, LOG_TAIL_BYTES);
+    head = s_tailHead; wrapped = s_tailWrapped;
+    portEXIT_CRITICAL(&s_tailMux);
+#else
+    const char* snap = s_tail;
+    size_t head = s_tailHead; bool wrapped = s_tailWrapped;
+#endif
+    if (wrapped) {
+#ifdef LOG_BINARY
+      // The decoder resynchronises on frame markers, so a cut frame is harmless
+      out.concat(snap + head, LOG_TAIL_BYTES - head);
+#else
+      // Skip the partial line at the wrap point
+      size_t start = head;
+      while (start < LOG_TAIL_BYTES && snap[start] != '\n') start++;
+      if (start < LOG_TAIL_BYTES) { start++; out.concat(snap + start, LOG_TAIL_BYTES - start); }
+#endif
+    }
+    out.concat(snap, head);
+    return out;
+  }
+
+  Stats stats() {
+    Stats s;
+    s.written = s_written.load(std::memory_order_relaxed);
+    s.dropped = s_dropped.load(std::memory_order_relaxed);
+    s.highWater = s_highWater;
+    return s;
+  }
+}
@@ -1,10 +1,120 @@
 #pragma once
 #include <Arduino.h>
+#include <type_traits>
 
 #ifndef LOG_TAG
 #define LOG_TAG "EzClock"
 #endif
 
-#define LOGI(...) do { Serial.printf("[I] %s: ", LOG_TAG); Serial.printf(__VA_ARGS__); Serial.println(); } while(0)
-#define LOGW(...) do { Serial.printf("[W] %s: ", LOG_TAG); Serial.printf(__VA_ARGS__); Serial.println(); } while(0)
-#define LOGE(...) do { Serial.printf("[E] %s: ", LOG_TAG); Serial.printf(__VA_ARGS__); Serial.println(); } while(0)
+// Compile-time ceiling: messages above this level are removed entirely.
+// 0 = off, 1 = error, 2 = warn, 3 = info, 4 = debug
+#ifndef LOG_LEVEL
+#define LOG_LEVEL 3
+#endif
+
+// Asynchronous logger. LOG* calls format into a fixed slot of a lock-free
+// multi-producer ring (LOG_BINARY: encode a frame into a byte ring, packed by
+// length) and return; a low-priority task drains the ring to Serial and into a
+// small tail served by /api/log. When the ring is full the message is dropped
+// and counted instead of blocking the caller.
+namespace Log {
+  enum Level : uint8_t { None = 0, Error = 1, Warn = 2, Info = 3, Debug = 4 };
+
+  // Start the drain task (messages logged earlier are buffered until then)
+  void begin();
+  // Runtime filter, clamped to LOG_LEVEL
+  void setLevel(uint8_t level);
+  uint8_t level();
+
+#ifdef LOG_BINARY
+  // Queue an already encoded binary record (see Log::bin below)
+  void writeRecord(const uint8_t* rec, size_t len);
+#else
+  void write(uint8_t level, const char* tag, const char* fmt, ...) __attribute__((format(printf, 3, 4)));
+#endif
+
+  // Most recent drained output, oldest first: lines ("<ms> [I] tag: message\n"),
+  // or raw frames when built with LOG_BINARY
+  String tail();
+
+  struct Stats {
+    uint32_t written;
+    uint32_t dropped;
+    uint8_t highWater; // most messages queued at once
+  };
+  Stats stats();
+}
+
+#ifdef LOG_BINARY
+// Binary records: nothing is formatted on the device. A record holds the
+// addresses of the format string and tag (both in flash), a timestamp and the
+// raw arguments; tools/logdecode.py rebuilds the text from the firmware ELF.
+//   frame  = 0xFE, len, payload[len], xor(payload)
+//   payload = level u8, ms u32, fmt u32, tag u32, args...
+//   args: integers <= 32 bit and pointers -> 4 bytes, 64-bit integers -> 8,
+//         float/double -> float32, strings -> length u8 + bytes (no NUL)
+// All values little-endian.
+#ifndef LOG_RECORD_MAX
+#define LOG_RECORD_MAX 64
+#endif
+namespace Log {
+  namespace bin {
+    struct Enc {
+      uint8_t buf[LOG_RECORD_MAX];
+      size_t len = 0;
+      void raw(const void* p, size_t n) {
+        if (n > sizeof(buf) - len) n = sizeof(buf) - len;
+        memcpy(buf + len, p, n);
+        len += n;
+      }
+      void u32(uint32_t v) { raw(&v, 4); }
+    };
+
+    template <typename T>
+    inline typename std::enable_if<(std::is_integral<T>::value || std::is_enum<T>::value) && sizeof(T) <= 4>::type
+    put(Enc& e, T v) { e.u32((uint32_t)v); }
+    template <typename T>
+    inline typename std::enable_if<std::is_integral<T>::value && sizeof(T) == 8>::type
+    put(Enc& e, T v) { uint64_t w = (uint64_t)v; e.raw(&w, 8); }
+    inline void put(Enc& e, double v) { float f = (float)v; e.raw(&f, 4); }
+    inline void put(Enc& e, const char* s) {
+      if (!s) s = "(null)";
+      size_t n = strlen(s);
+      if (n > 255) n = 255;
+      const uint8_t n8 = (uint8_t)n;
+      e.raw(&n8, 1);
+      e.raw(s, n);
+    }
+    inline void put(Enc& e, char* s) { put(e, (const char*)s); }
+    inline void put(Enc& e, const void* p) { e.u32((uint32_t)(uintptr_t)p); }
+
+    inline void putAll(Enc&) {}
+    template <typename T, typename... R>
+    inline void putAll(Enc& e, T v, R... rest) { put(e, v); putAll(e, rest...); }
+
+    // Never called: keeps the compiler's printf argument checking in binary mode
+    inline void check(const char*, ...) __attribute__((format(printf, 1, 2)));
+    inline void check(const char*, ...) {}
+
+    template <typename... A>
+    void record(uint8_t level, const char* tag, const char* fmt, A... args) {
+      if (level > Log::level()) return;
+      Enc e;
+      e.raw(&level, 1);
+      e.u32(millis());
+      e.u32((uint32_t)(uintptr_t)fmt);
+      e.u32((uint32_t)(uintptr_t)tag);
+      putAll(e, args...);
+      writeRecord(e.buf, e.len);
+    }
+  }
+}
+#define LOG_AT(lvl, fmt, ...) do { if (LOG_LEVEL >= (lvl)) { if (0) Log::bin::check(fmt, ##__VA_ARGS__); \
+  Log::bin::record((lvl), LOG_TAG, fmt, ##__VA_ARGS__); } } while(0)
+#else
+#define LOG_AT(lvl, ...) do { if (LOG_LEVEL >= (lvl)) Log::write((lvl), LOG_TAG, __VA_ARGS__); } while(0)
+#endif
+#define LOGE(...) LOG_AT(Log::Error, __VA_ARGS__)
+#define LOGW(...) LOG_AT(Log::Warn, __VA_ARGS__)
+#define LOGI(...) LOG_AT(Log::Info, __VA_ARGS__)
+#define LOGD(...) LOG_AT(Log::Debug, __VA_ARGS__)
@@ -0,0 +1,133 @@
+#include "Perf.hpp"
+#include "Log.hpp"
+
+// Default per-stage budgets in microseconds (override with -D flags)
+#ifndef PERF_BUDGET_LOOP_US
+#define PERF_BUDGET_LOOP_US 20000
+#endif
+#ifndef PERF_BUDGET_WEB_US
+#define PERF_BUDGET_WEB_US 1000
+#endif
+#ifndef PERF_BUDGET_TIME_US
+#define PERF_BUDGET_TIME_US 2000
+#endif
+#ifndef PERF_BUDGET_MQTT_US
+#define PERF_BUDGET_MQTT_US 2000
+#endif
+#ifndef PERF_BUDGET_HAL_US
+#define PERF_BUDGET_HAL_US 8000
+#endif
+#ifndef PERF_BUDGET_OTA_US
+#define PERF_BUDGET_OTA_US 2000
+#endif
+#ifndef PERF_BUDGET_HTTP_US
+#define PERF_BUDGET_HTTP_US 50000
+#endif
+#ifndef PERF_WARN_INTERVAL_MS
+#define PERF_WARN_INTERVAL_MS 5000  // at most one budget warning per stage per interval
+#endif
+
+namespace Perf {
+  static constexpr uint8_t STAGES = (uint8_t)Stage::Count;
+  static constexpr uint8_t HIST = 24; // bucket b holds durations in [2^(b-1), 2^b) us; last is open-ended
+
+  static const char* const NAMES[STAGES] = { "loop", "web", "time", "mqtt", "hal", "ota", "http" };
+
+  struct StageStats {
+    uint32_t gen;     // reset generation these numbers belong to
+    uint32_t count;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint64_t sumUs;
+    uint32_t over;
+    uint32_t lastWarnMs;
+    uint32_t hist[HIST];
+  };
+
+  // Each stage has a single writer task (loop, render or AsyncTCP). reset() runs
+  // on the web server, so it only bumps the generation and every writer clears
+  // its own stage on the next sample; readers treat older stages as empty.
+  static StageStats s_stats[STAGES];
+  static volatile uint32_t s_gen = 1;
+  static uint32_t s_budgetUs[STAGES] = {
+    PERF_BUDGET_LOOP_US, PERF_BUDGET_WEB_US, PERF_BUDGET_TIME_US, PERF_BUDGET_MQTT_US,
+    PERF_BUDGET_HAL_US, PERF_BUDGET_OTA_US, PERF_BUDGET_HTTP_US
+  };
+
+  static uint8_t bucketOf(uint32_t us) {
+    uint8_t b = us ? (uint8_t)(32 - __builtin_clz(us)) : 0;
+    return b < HIST ? b : HIST - 1;
+  }
+
+  Scope::Scope(Stage s, const char* ctx) : _stage(s), _ctx(ctx), _c0(ESP.getCycleCount()) {}
+
+  Scope::~Scope() {
+    // 32-bit cycle counter: wraps after ~26 s at 160 MHz, far beyond any stage
+    const uint32_t us = (ESP.getCycleCount() - _c0) / ESP.getCpuFreqMHz();
+    const uint8_t i = (uint8_t)_stage;
+    if (i >= STAGES) return;
+    StageStats& st = s_stats[i];
+    const uint32_t gen = s_gen;
+    if (st.gen != gen) { st = StageStats(); st.gen = gen; }
+    if (!st.count || us < st.minUs) st.minUs = us;
+    if (us > st.maxUs) st.maxUs = us;
+    st.count++;
+    st.sumUs += us;
+    st.hist[bucketOf(us)]++;
+    const uint32_t budget = s_budgetUs[i];
+    if (budget && us > budget) {
+      st.over++;
+      const uint32_t now = millis();
+      if (!st.lastWarnMs || now - st.lastWarnMs >= PERF_WARN_INTERVAL_MS) {
+        st.lastWarnMs = now ? now : 1;
+        LOGW("perf: %s took %lu us (budget %lu us, %lu over) ctx=%s heap=%u",
+             NAMES[i], (unsigned long)us, (unsigned long)budget, (unsigned long)st.over,
+             _ctx ? _ctx : "-", (unsigned)ESP.getFreeHeap());
+      }
+    }
+  }
+
+  bool setBudget(const char* stageName, uint32_t us) {
+    for (uint8_t i = 0; i < STAGES; ++i) {
+      if (strcmp(NAMES[i], stageName) == 0) { s_budgetUs[i] = us; return true; }
+    }
+    return false;
+  }
+
+  void reset() {
+    s_gen = s_gen + 1;
+  }
+
+  // Upper bound of the histogram bucket containing the 99th percentile, capped at max
+  static uint32_t p99(const StageStats& st) {
+    if (!st.count) return 0;
+    const uint32_t target = st.count - st.count / 100;
+    uint32_t seen = 0;
+    for (uint8_t b = 0; b < HIST; ++b) {
+      seen += st.hist[b];
+      if (seen >= target) {
+        const uint32_t upper = b ? (1UL << b) - 1 : 0;
+        return upper < st.maxUs ? upper : st.maxUs;
+      }
+    }
+    return st.maxUs;
+  }
+
+  void appendJson(String& out) {
+    char buf[200];
+    snprintf(buf, sizeof(buf), "{\"cpuMHz\":%u,\"stages\":[", (unsigned)ESP.getCpuFreqMHz());
+    out += buf;
+    static const StageStats EMPTY{};
+    const uint32_t gen = s_gen;
+    for (uint8_t i = 0; i < STAGES; ++i) {
+      const StageStats& st = s_stats[i].gen == gen ? s_stats[i] : EMPTY;
+      snprintf(buf, sizeof(buf),
+               "%s{\"name\":\"%s\",\"count\":%lu,\"minUs\":%lu,\"avgUs\":%lu,\"maxUs\":%lu,\"p99Us\":%lu,\"budgetUs\":%lu,\"over\":%lu}",
+               i ? "," : "", NAMES[i], (unsigned long)st.count, (unsigned long)st.minUs,
+               (unsigned long)(st.count ? st.sumUs / st.count : 0), (unsigned long)st.maxUs,
+               (unsigned long)p99(st), (unsigned long)s_budgetUs[i], (unsigned long)st.over);
+      out += buf;
+    }
+    out += "]}";
+  }
+}
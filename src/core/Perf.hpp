@@ -0,0 +1,39 @@
+#pragma once
+#include <Arduino.h>
+
+// Main-loop profiler. Each stage is timed with the CPU cycle counter and kept
+// as count/min/avg/max plus a log2 histogram (for p99). A stage that exceeds its
+// budget is counted and logged with context (rate-limited per stage).
+// Every stage is written by a single task: the loop stages by the Arduino loop
+// task, Hal by the render task when RENDER_TASK is on, Http by the AsyncTCP
+// task, so no locking is needed.
+namespace Perf {
+  enum class Stage : uint8_t {
+    Loop,  // whole loop() pass, excluding the EventLoop wait
+    Web,
+    Time,
+    Mqtt,
+    Hal,   // driver loop (render task with RENDER_TASK)
+    Ota,
+    Http,  // async web handlers (AsyncTCP task)
+    Count
+  };
+
+  // RAII timer; ctx (static string, e.g. a route path) is reported on budget violations
+  class Scope {
+  public:
+    explicit Scope(Stage s, const char* ctx = nullptr);
+    ~Scope();
+  private:
+    Stage _stage;
+    const char* _ctx;
+    uint32_t _c0;
+  };
+
+  // Runtime budget in microseconds (0 disables the check)
+  bool setBudget(const char* stageName, uint32_t us);
+  // Clear all stages; safe from any task (each stage is cleared by its own writer)
+  void reset();
+  // {"cpuMHz":n,"stages":[{"name":..,"count":..,"minUs":..,"avgUs":..,"maxUs":..,"p99Us":..,"budgetUs":..,"over":..},..]}
+  void appendJson(String& out);
+}
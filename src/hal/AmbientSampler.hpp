@@ -0,0 +1,148 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include <esp_timer.h>
+
+// Timer-driven ambient light sampling with O(1) filtering.
+// An esp_timer callback reads the ADC at a fixed period and pushes the sample
+// into a single-producer/single-consumer ring; the driver loop drains the ring
+// with poll(), so sample timing no longer follows main-loop latency. If the
+// consumer falls more than a ring behind, the oldest samples are lost, never
+// the newest.
+// Filters over the configured window:
+//   Average - moving average (running sum, no re-summing)
+//   Ema     - exponential moving average, alpha = 2 / (window + 1)
+//   Median  - median of the last min(window, MEDIAN_MAX) samples (rejects flicker spikes)
+class AmbientSampler {
+public:
+  enum Filter : uint8_t { Average = 0, Ema = 1, Median = 2 };
+  static constexpr uint8_t MAX_WINDOW = 60;
+  static constexpr uint8_t MEDIAN_MAX = 15;
+
+  void begin(uint8_t pin, uint16_t periodMs) {
+    _pin = pin;
+    esp_timer_create_args_t args{};
+    args.callback = &AmbientSampler::onTimer;
+    args.arg = this;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "ambient";
+    if (esp_timer_create(&args, &_timer) != ESP_OK) _timer = nullptr;
+    setPeriod(periodMs);
+  }
+
+  void setPeriod(uint16_t periodMs) {
+    _periodMs = periodMs;
+    if (!_timer) return;
+    esp_timer_stop(_timer);
+    esp_timer_start_periodic(_timer, (uint64_t)periodMs * 1000ULL);
+  }
+
+  // Change window/filter; restarts the filter state
+  void configure(uint8_t window, Filter filter) {
+    if (window == 0) window = 1;
+    if (window > MAX_WINDOW) window = MAX_WINDOW;
+    _window = window;
+    _filter = filter <= Median ? filter : Average;
+    _idx = 0;
+    _count = 0;
+    _sum = 0;
+    _emaQ8 = 0;
+  }
+
+  // Fold in samples captured since the last call; true if any arrived
+  bool poll() {
+    bool any = false;
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    const uint32_t head = _head.load(std::memory_order_acquire);
+    // Lapped by the timer: the slots before head - KEEP were overwritten (the
+    // one slot of slack is the one the timer writes next)
+    if (head - tail > KEEP) {
+      _overruns.fetch_add(head - tail - KEEP, std::memory_order_relaxed);
+      tail = head - KEEP;
+    }
+    while (tail != head) {
+      add(_ring[tail % RING]);
+      ++tail;
+      any = true;
+    }
+    _tail.store(tail, std::memory_order_release);
+    if (any) _value = compute();
+    return any;
+  }
+
+  uint16_t raw() const { return _raw; }
+  uint16_t value() const { return _value; }
+  uint8_t samples() const { return _count; }
+  Filter filter() const { return _filter; }
+  uint16_t periodMs() const { return _periodMs; }
+  uint32_t overruns() const { return _overruns.load(std::memory_order_relaxed); }
+  static const char* filterName(Filter f) { return f == Ema ? "ema" : f == Median ? "median" : "avg"; }
+
+private:
+  // Backlog: 1.6 s at the 50 ms minimum period, 8 s at the default 250 ms; the
+  // driver polls at least every QLOCK_FOLLOW_MS (1 s)
+  static constexpr uint8_t RING = 32;
+  static constexpr uint8_t KEEP = RING - 1;
+
+  static void onTimer(void* arg) {
+    AmbientSampler* s = static_cast<AmbientSampler*>(arg);
+    const uint16_t v = (uint16_t)analogRead(s->_pin); // 12-bit on ESP32 (0..4095)
+    // Always store: a stalled consumer loses the oldest samples in poll()
+    const uint32_t head = s->_head.load(std::memory_order_relaxed);
+    s->_ring[head % RING] = v;
+    s->_head.store(head + 1, std::memory_order_release);
+  }
+
+  void add(uint16_t x) {
+    _raw = x;
+    // Window ring + running sum: subtract the sample that falls out
+    if (_count == _window) _sum -= _buf[_idx];
+    else _count++;
+    _buf[_idx] = x;
+    _sum += x;
+    _idx = (uint8_t)((_idx + 1) % _window);
+    // EMA in Q8 fixed point
+    const int32_t xq = (int32_t)x << 8;
+    if (_count == 1) _emaQ8 = xq;
+    else _emaQ8 += (xq - _emaQ8) * 2 / ((int32_t)_window + 1);
+  }
+
+  uint16_t compute() const {
+    switch (_filter) {
+      case Ema:
+        return (uint16_t)((_emaQ8 + 128) >> 8);
+      case Median: {
+        const uint8_t n = _count < MEDIAN_MAX ? _count : MEDIAN_MAX;
+        uint16_t v[MEDIAN_MAX];
+        // Newest n samples, insertion-sorted (n <= 15)
+        for (uint8_t k = 0; k < n; ++k) {
+          const uint16_t x = _buf[(_idx + _window - 1 - k) % _window];
+          int8_t j = (int8_t)k - 1;
+          while (j >= 0 && v[j] > x) { v[j + 1] = v[j]; --j; }
+          v[j + 1] = x;
+        }
+        return n ? v[n / 2] : 0;
+      }
+      default:
+        return _count ? (uint16_t)((_sum + _count / 2) / _count) : 0;
+    }
+  }
+
+  uint8_t _pin{0};
+  esp_timer_handle_t _timer{nullptr};
+  uint16_t _periodMs{250};
+  volatile uint16_t _ring[RING]{};
+  std::atomic<uint32_t> _head{0};
+  std::atomic<uint32_t> _tail{0};
+  std::atomic<uint32_t> _overruns{0};
+
+  Filter _filter{Average};
+  uint8_t _window{20};
+  uint16_t _buf[MAX_WINDOW]{};
+  uint8_t _idx{0};
+  uint8_t _count{0};
+  uint32_t _sum{0};
+  int32_t _emaQ8{0};
+  uint16_t _raw{0};
+  uint16_t _value{0};
+};
@@ -0,0 +1,77 @@
+#pragma once
+#include <Arduino.h>
+
+#ifndef AMBIENT_DEADBAND
+#define AMBIENT_DEADBAND 3       // brightness steps a new target must differ by to be followed
+#endif
+#ifndef AMBIENT_CONFIRM
+#define AMBIENT_CONFIRM 2        // consecutive samples beyond the deadband (same direction) before moving
+#endif
+#ifndef AMBIENT_SLEW_PER_S
+#define AMBIENT_SLEW_PER_S 64    // max brightness steps per second while following a target
+#endif
+#ifndef AMBIENT_SLEW_MAX_DT_MS
+#define AMBIENT_SLEW_MAX_DT_MS 10 // longest interval one update() may credit (one frame): after an idle
+                                  // sleep the move starts from rest instead of jumping
+#endif
+
+// Brightness follower for ambient control:
+// - deadband: at rest, targets within AMBIENT_DEADBAND steps are ignored
+// - hysteresis: a move starts only after AMBIENT_CONFIRM consecutive samples
+//   beyond the deadband on the same side, then tracks to the exact target
+// - slew: the output moves at most AMBIENT_SLEW_PER_S steps per second
+// update() reports a change only when the 8-bit output moves, so the strip is
+// re-pushed for real brightness steps instead of every ADC sample.
+class BrightnessController {
+public:
+  // Feed a new target from an ambient sample; force bypasses the deadband
+  // (settings changed, first sample)
+  void setTarget(uint8_t target, bool force = false) {
+    if (!_init) {
+      _init = true;
+      _target = target;
+      _outQ8 = (uint16_t)target << 8;
+      _out = target;
+      _changed = true;
+      return;
+    }
+    if (force || moving()) { _target = target; _confirm = 0; return; }
+    const int16_t diff = (int16_t)target - (int16_t)_target;
+    const int8_t dir = diff > AMBIENT_DEADBAND ? 1 : (diff < -AMBIENT_DEADBAND ? -1 : 0);
+    if (dir == 0) { _confirm = 0; return; }
+    // Count consecutive out-of-band samples on the same side
+    _confirm = ((_confirm > 0) == (dir > 0) && _confirm != 0) ? (int8_t)(_confirm + dir) : dir;
+    if (_confirm >= AMBIENT_CONFIRM || _confirm <= -AMBIENT_CONFIRM) { _target = target; _confirm = 0; }
+  }
+
+  // Advance toward the target; true when the 8-bit output changed
+  bool update(uint32_t nowMs) {
+    uint32_t dt = nowMs - _lastMs;
+    _lastMs = nowMs;
+    if (dt > AMBIENT_SLEW_MAX_DT_MS) dt = AMBIENT_SLEW_MAX_DT_MS;
+    bool changed = _changed;
+    _changed = false;
+    if (!moving()) return changed;
+    uint32_t step = ((uint32_t)AMBIENT_SLEW_PER_S << 8) * dt / 1000;
+    if (step == 0) return changed;
+    const uint16_t targetQ8 = (uint16_t)_target << 8;
+    if (_outQ8 < targetQ8) _outQ8 = (uint16_t)min<uint32_t>(targetQ8, _outQ8 + step);
+    else _outQ8 = (uint16_t)((uint32_t)_outQ8 > targetQ8 + step ? _outQ8 - step : targetQ8);
+    const uint8_t out = (uint8_t)((_outQ8 + 128) >> 8);
+    if (out != _out) { _out = out; changed = true; }
+    return changed;
+  }
+
+  uint8_t output() const { return _out; }
+  uint8_t target() const { return _target; }
+  bool moving() const { return _outQ8 != ((uint16_t)_target << 8); }
+
+private:
+  bool _init{false};
+  bool _changed{false};
+  int8_t _confirm{0};      // signed run length of out-of-band samples
+  uint8_t _target{0};
+  uint8_t _out{0};
+  uint16_t _outQ8{0};
+  uint32_t _lastMs{0};
+};
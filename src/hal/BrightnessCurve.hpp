@@ -0,0 +1,51 @@
+#pragma once
+#include <Arduino.h>
+#include <math.h>
+
+// Ambient-to-brightness lookup table, rebuilt only when the ambient settings change.
+// The table is indexed by the 12-bit ADC value >> 4 (16-count steps), so the
+// per-frame mapping is a single load.
+// Below the threshold the output is maxPct; above it the level falls linearly in
+// the chosen space from maxPct (at threshold) to minPct (at full scale):
+//   Linear - percentages are PWM duty (the historical behaviour)
+//   Gamma  - percentages are perceived levels, duty = level^2.2
+//   CieL   - percentages are CIE L* lightness, duty = CIE 1976 inverse
+namespace BrightnessCurve {
+  enum Curve : uint8_t { Linear = 0, Gamma = 1, CieL = 2 };
+  static constexpr uint16_t LUT_SIZE = 256;
+  static constexpr uint8_t ADC_SHIFT = 4; // 4096 / 256
+
+  // level in 0..100 (percent along the curve) -> duty 0..1
+  inline float duty(float level, Curve curve) {
+    const float l = level < 0 ? 0 : (level > 100 ? 100 : level);
+    switch (curve) {
+      case Gamma: return powf(l / 100.0f, 2.2f);
+      case CieL: {
+        const float y = (l + 16.0f) / 116.0f;
+        return l > 8.0f ? y * y * y : l / 903.3f;
+      }
+      default: return l / 100.0f;
+    }
+  }
+
+  inline void build(uint8_t lut[LUT_SIZE], uint8_t minPct, uint8_t maxPct, uint16_t threshold, Curve curve) {
+    if (minPct > 100) minPct = 100;
+    if (maxPct > 100) maxPct = 100;
+    if (maxPct < minPct) maxPct = minPct;
+    if (threshold > 4095) threshold = 4095;
+    const float span = (float)(4095 - threshold);
+    for (uint16_t i = 0; i < LUT_SIZE; ++i) {
+      const uint16_t a = (uint16_t)((i << ADC_SHIFT) + (1 << (ADC_SHIFT - 1))); // bucket centre
+      float level = maxPct;
+      if (a > threshold && span > 0) {
+        const float t = (float)(a - threshold) / span; // 0..1
+        level = (float)maxPct + t * ((float)minPct - (float)maxPct);
+      }
+      lut[i] = (uint8_t)lroundf(duty(level, curve) * 255.0f);
+    }
+  }
+
+  inline uint8_t lookup(const uint8_t lut[LUT_SIZE], uint16_t adc) {
+    return lut[(adc > 4095 ? 4095 : adc) >> ADC_SHIFT];
+  }
+}
@@ -1,9 +1,10 @@
-// Driver_7SegStrip: FastLED-based linear 7-segment renderer for HH:MM
+// Driver_7SegStrip: FastLED-based linear 7-segment renderer
 //
 // Summary
-// - Renders time as HH:MM on a single linear LED strip.
-// - Layout pattern is compatible with regex: "[\\d_][\\d_][-.':][\\d_][\\d_]"
-//   where '_' is a blank digit, and separator is one of '-', '.', ':', or '\''. 
+// - Renders time on one or more linear LED strips; the geometry (digit count,
+//   separators, seconds, strips) comes from SEG_LAYOUT, see SegLayout.hpp.
+// - Default layout is HH:MM on a single strip: "HH*MM" where '*' is the
+//   STRIP_SEPARATOR glyph, one of '-', '.', ':', or '\''.
 // - Color updates are PUSHED by the Web UI via hal->fill(r,g,b); hal->show().
 // - Time is polled once per second via TimeSvc::getLocal() or localtime_r().
 //
@@ -11,6 +12,9 @@
 // -D USE_7SEGSTRIP=1
 // -D LED_PIN=2           // strip data pin
 // -D LEDS_PER_SEG=2      // how many LEDs per each of the 7 segments
+// -D SEG_LAYOUT='"HH:MM|SS"' // optional: layout pattern (default "HH*MM")
+// -D SEG_ORDER='"fabcdeg"'   // optional: segment wiring order within a digit
+// -D LED_PIN_2=3         // optional: data pins for the 2nd..4th strip ('|' in SEG_LAYOUT)
 // -D STRIP_SEPARATOR=':' // optional: default separator character (':','-','.','\'')
 // -D FADE_MS=300         // optional: crossfade duration in milliseconds
 // -D STARTUP_ANIM_MS=3000 // optional: startup animation duration (ms)
@@ -22,6 +26,8 @@
 #ifdef USE_7SEGSTRIP
 
 #include "HalDriver.hpp"
+#include "FrameStats.hpp"
+#include "SegLayout.hpp"
 #include "../services/TimeService.hpp"
 #include "../core/Log.hpp"
 #include <FastLED.h>
@@ -47,6 +53,10 @@
 #define STARTUP_STEP_MS 200
 #endif
 
+#ifndef BREATH_FPS
+#define BREATH_FPS 50 // frame cap for the unsynced separator breathing
+#endif
+
 #ifdef STARTUP_FLASH
 #ifndef STARTUP_FLASH_MS
 #define STARTUP_FLASH_MS 150
@@ -63,15 +73,30 @@
 #define SEP_STR_LIT STR(STRIP_SEPARATOR)
 #endif
 
-// Geometry: 4 digits + 1 separator (filler)
-#define DIGITS 4
-#define FILLERS 1
-#define DIGIT_LENGTH (7 * LEDS_PER_SEG)
-#define FILLER_LENGTH (2 + LEDS_PER_SEG)
-#define STRIP_LENGTH (DIGITS * DIGIT_LENGTH + FILLERS * FILLER_LENGTH)
+#ifndef SEG_LAYOUT
+#define SEG_LAYOUT "HH*MM"
+#endif
 
-// 7-seg bitmaps for 0..9 (MSB->LSB order for 7 segments)
-static const uint8_t SEVENSEG[10] = { 0x7e, 0x18, 0x37, 0x3d, 0x59, 0x6d, 0x6f, 0x38, 0x7f, 0x7d };
+#ifndef SEG_ORDER
+#define SEG_ORDER "fabcdeg" // original strip wiring: f, a, b, c, d, e, g
+#endif
+
+// Geometry resolved at compile time
+static constexpr char SEG_PATTERN[] = SEG_LAYOUT;
+static constexpr char SEG_WIRING[] = SEG_ORDER;
+using Layout = SegLayout::Layout<SEG_PATTERN, LEDS_PER_SEG, SEG_WIRING, SegLayout::glyphFromLiteral(SEP_STR_LIT)>;
+static constexpr uint16_t STRIP_LENGTH = Layout::LENGTH;
+
+#if defined(LED_PIN_4)
+#define SEG_PINS 4
+#elif defined(LED_PIN_3)
+#define SEG_PINS 3
+#elif defined(LED_PIN_2)
+#define SEG_PINS 2
+#else
+#define SEG_PINS 1
+#endif
+static_assert(Layout::STRIPS <= SEG_PINS, "SEG_LAYOUT uses more strips than LED_PIN/LED_PIN_n pins defined");
 
 #ifdef DRIVER_DEBUG
 #define DLOG(fmt, ...) LOGI("[7SEG] " fmt, ##__VA_ARGS__)
@@ -82,15 +107,27 @@ static const uint8_t SEVENSEG[10] = { 0x7e, 0x18, 0x37, 0x3d, 0x59, 0x6d, 0x6f,
 class Driver7SegStrip : public HalDriver {
 public:
   void begin() override {
-    FastLED.addLeds<WS2812B, LED_PIN, GRB>(_leds, STRIP_LENGTH);
+    // One controller per strip; FastLED pushes all of them in parallel on show()
+    addStrip<LED_PIN>(0);
+    #ifdef LED_PIN_2
+      addStrip<LED_PIN_2>(1);
+    #endif
+    #ifdef LED_PIN_3
+      addStrip<LED_PIN_3>(2);
+    #endif
+    #ifdef LED_PIN_4
+      addStrip<LED_PIN_4>(3);
+    #endif
     FastLED.setBrightness(128);
     clearMask(_currentMask);
     clearMask(_targetMask);
     clearMask(_prevMask);
-    FastLED.show();
+    showFrame(FrameStats::Kind::Static);
     _lastMinute = 255; // force first render
     _dirty = true;
     _fadeMs = FADE_MS;
+    // Breathing curve: same levels as beatsin8(30, 40, 255), indexed by beat8(30)
+    for (uint16_t p = 0; p < 256; ++p) _breathCurve[p] = (uint8_t)(40 + scale8(sin8((uint8_t)p), 255 - 40));
     // Startup animation state
     #ifndef DISABLE_STARTUP_ANIM
       _animPhase = (STARTUP_FLASH_MS > 0) ? PHASE_FLASH : PHASE_SCROLL;
@@ -105,7 +142,7 @@ public:
     FastLED.setBrightness(255); // ensure startup anim is clearly visible
     if (_animPhase == PHASE_FLASH) {
       for (int i=0;i<STRIP_LENGTH;++i) _leds[i] = CRGB::White;
-      FastLED.show();
+      showFrame(FrameStats::Kind::Static);
     }
     DLOG("begin: phase=%d", (int)_animPhase);
     _dirty = true; // request first frame
@@ -126,6 +163,14 @@ public:
     _fadeMs = ms;
   }
 
+  void setBrightness(uint8_t scale) override {
+    // Scale the nominal strip brightness (128). The startup animation runs at full
+    // brightness and restores this value when done.
+    _startupPrevBrightness = scale8(128, scale);
+    if (_animPhase == PHASE_DONE) FastLED.setBrightness(_startupPrevBrightness);
+    _dirty = true;
+  }
+
   void loop() override {
     // Poll time periodically; detect minute change
     uint32_t ms = millis();
@@ -157,18 +202,12 @@ public:
             _scrollPrimed = true;
         if (!stepsTotal) stepsTotal = 1;
         uint16_t step = (elapsed / STARTUP_STEP_MS) % stepsTotal;
-        // Map step to base digit (0..9) cycling
+        // Map step to base digit (0..9) cycling, each cell one ahead of the previous
         uint8_t d = step % 10;
         uint8_t hue = (uint8_t)((elapsed * 255UL) / STARTUP_ANIM_MS);
-        const char* sepstr = SEP_STR_LIT;
-        char sep = (sepstr[0] == '\'' && sepstr[1]) ? sepstr[1] : sepstr[0];
-        char pat[5];
-        pat[0] = char('0' + d);
-        pat[1] = char('0' + ((d + 1) % 10));
-        pat[2] = sep;
-        pat[3] = char('0' + ((d + 2) % 10));
-        pat[4] = char('0' + ((d + 3) % 10));
-        renderPattern(pat, _currentMask);
+        uint8_t values[SegLayout::MAX_DIGITS];
+        for (uint8_t i = 0; i < Layout::DIGITS; ++i) values[i] = (uint8_t)((d + i) % 10);
+        renderDigits(values, _currentMask);
         _useOverrideColor = true;
         _overrideColor = CHSV(hue, 255, 255);
         _dirty = true;
@@ -184,10 +223,11 @@ public:
       uint8_t hh = tmv.tm_hour;  // 0..23
       uint8_t mm = tmv.tm_min;   // 0..59
       uint8_t ss = tmv.tm_sec;   // 0..59
-      // Trigger re-render only when minute or hour changes
-      if (mm != _lastMinute || hh != _lastHour) {
+      // Trigger re-render only when a displayed field changes
+      if (mm != _lastMinute || hh != _lastHour || (Layout::SECONDS && ss != _lastSecond)) {
         _lastMinute = mm;
         _lastHour = hh;
+        _lastSecond = ss;
         // If already transitioning, finalize to current target first
         if (_inTransition) {
           copyMask(_targetMask, _currentMask);
@@ -195,7 +235,7 @@ public:
         }
         // Prepare new transition from current -> target
         copyMask(_currentMask, _prevMask);
-        renderTime(hh, mm, _targetMask);
+        renderTime(hh, mm, ss, _targetMask);
         _transitionStart = ms;
         _inTransition = (_fadeMs > 0);
         _dirty = true;
@@ -203,50 +243,48 @@ public:
     }
 
     // While time isn't synced and startup is done, fade the separator on/off
-  bool unsyncedMode = (_animPhase == PHASE_DONE && !TimeSvc::isSynced());
-  if (unsyncedMode && !_reportedUnsynced) { DLOG("enter unsynced breathing"); _reportedUnsynced = true; }
-    if (unsyncedMode) {
-      // Build separator-only mask into current
-      clearMask(_currentMask);
-      const int SEP_BASE = DIGIT_LENGTH * 2; // after two digits
-      const char* sepstr = SEP_STR_LIT; char sep = (sepstr[0] == '\'' && sepstr[1]) ? sepstr[1] : sepstr[0];
-      writeSeparator(_currentMask, SEP_BASE, sep);
-      _inTransition = false;
-      _dirty = true;
+    const bool unsyncedMode = (_animPhase == PHASE_DONE && !TimeSvc::isSynced());
+    if (unsyncedMode != _breathing) {
+      _breathing = unsyncedMode;
+      if (unsyncedMode) {
+        DLOG("enter unsynced breathing");
+        enterBreathing();
+      } else {
+        _lastMinute = 255; _lastHour = 255; _dirty = true; // show the time on the next poll
+      }
+    }
+    if (_breathing) {
+      _inTransition = false; // time polling keeps running, nothing is shown until synced
+      renderBreath(ms);
+      return;
     }
 
     // Render output if in transition or something changed
-    if (_inTransition || _dirty || unsyncedMode) {
+    if (_inTransition || _dirty) {
       uint8_t progress = 255;
       if (_inTransition) {
         uint32_t elapsed = ms - _transitionStart;
         progress = (uint8_t)((_fadeMs == 0) ? 255 : (elapsed >= _fadeMs ? 255 : (elapsed * 255) / _fadeMs));
       }
 
-      uint8_t baseR = _useOverrideColor ? _overrideColor.r : _colorR;
-      uint8_t baseG = _useOverrideColor ? _overrideColor.g : _colorG;
-      uint8_t baseB = _useOverrideColor ? _overrideColor.b : _colorB;
-
-      // When unsynced, apply a breathing effect on separator intensity
-      uint8_t sepLevel = 255;
-      if (unsyncedMode) {
-        sepLevel = beatsin8(30, 40, 255); // 30 BPM, keep visibly on (min ~16%)
-      }
+      const CRGB base = _useOverrideColor ? _overrideColor : CRGB(_colorR, _colorG, _colorB);
+      bool changed = true; // a full repaint counts as a change
 
-      for (int i = 0; i < STRIP_LENGTH; ++i) {
-        uint16_t intensity;
-        if (unsyncedMode) {
-          intensity = _currentMask[i] ? sepLevel : 0;
-        } else {
-          uint16_t fromI = _inTransition ? (_prevMask[i] ? 255 : 0) : (_currentMask[i] ? 255 : 0);
-          uint16_t toI   = _inTransition ? (_targetMask[i] ? 255 : 0) : fromI;
-          intensity = (uint16_t)((fromI * (255 - progress) + toI * progress + 127) / 255); // rounded
+      if (_inTransition) {
+        // New transition or color change: repaint the whole frame once, then
+        // only the LEDs in the change list are touched on following frames
+        if (_dirty) {
+          buildRuns();
+          paintMask(_prevMask, base);
         }
-        _leds[i].r = (uint8_t)((baseR * intensity) / 255);
-        _leds[i].g = (uint8_t)((baseG * intensity) / 255);
-        _leds[i].b = (uint8_t)((baseB * intensity) / 255);
+        const bool moved = paintRuns(base, progress);
+        changed = moved || _dirty;
+      } else {
+        // Color fast path: every lit LED gets the same precomputed color
+        paintMask(_currentMask, base);
       }
-      FastLED.show();
+      showFrame(!_inTransition ? FrameStats::Kind::Static
+                : progress >= 255 ? FrameStats::Kind::FadeEnd : FrameStats::Kind::Fade, changed);
 
       if (_inTransition && progress >= 255) {
         // Transition complete
@@ -283,6 +321,11 @@ public:
     _dirty = true; // loop() will apply color to current/transition and show
   }
 
+  bool getTelemetry(HalTelemetry& out) const override {
+    _frames.fill(out);
+    return true;
+  }
+
   uint16_t size() const override { return STRIP_LENGTH; }
 
 private:
@@ -291,12 +334,20 @@ private:
   bool _targetMask[STRIP_LENGTH]{};  // next pattern
   bool _prevMask[STRIP_LENGTH]{};    // previous pattern (for blending)
   CRGB _leds[STRIP_LENGTH];
+  struct Run { uint16_t start; uint16_t len; bool on; };
+  // Worst case for digit/separator masks: every segment flips, separators twice
+  static constexpr uint16_t MAX_RUNS = Layout::DIGITS * 7 + Layout::SEPS * 2;
+  Run _runs[MAX_RUNS];
+  uint16_t _runCount{0};
+  bool _runsOverflow{false};
+  CRGB _runRising, _runFalling; // run colors of the last fade frame
   uint8_t _colorR{0}, _colorG{128}, _colorB{0}; // default green-ish
   bool _useOverrideColor{false};
   CRGB _overrideColor{0,0,0};
   bool _dirty{false};
   uint8_t _lastMinute{255};
   uint8_t _lastHour{255};
+  uint8_t _lastSecond{255};
   uint32_t _lastPoll{0};
   bool _inTransition{false};
   uint32_t _transitionStart{0};
@@ -306,110 +357,124 @@ private:
   uint32_t _startupStart{0};
   uint8_t _startupPrevBrightness{128};
   uint32_t _lastStepTime{0};
-  bool _reportedUnsynced{false};
+  bool _breathing{false};
+  uint8_t _breathCurve[256];
+  uint8_t _breathLevel{0};
+  uint32_t _breathFrameMs{0};
+  uint16_t _sepLeds[Layout::SEPS * Layout::SEP_LENGTH + 1]; // lit separator LEDs
+  uint16_t _sepLedCount{0};
   bool _scrollPrimed{false};
+  FrameStats _frames;
 
-  static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+  // changed: whether this frame's pixels differ from the last one shown
+  void showFrame(FrameStats::Kind kind, bool changed = true) {
+    const uint32_t t0 = _frames.start();
+    FastLED.show();
+    _frames.shown(t0, changed, FastLED.getBrightness(), kind);
+  }
 
-  static void clearMask(bool* mask) {
-    for (int i = 0; i < STRIP_LENGTH; ++i) mask[i] = false;
+  template <uint8_t PIN>
+  void addStrip(uint8_t strip) {
+    if (strip >= Layout::STRIPS) return;
+    const uint16_t start = Layout::T.stripStart[strip];
+    FastLED.addLeds<WS2812B, PIN, GRB>(_leds + start, Layout::T.stripStart[strip + 1] - start);
   }
 
-  static void copyMask(const bool* from, bool* to) {
-    for (int i = 0; i < STRIP_LENGTH; ++i) to[i] = from[i];
+  // Separator-only frame; the lit LED indices are cached for renderBreath()
+  void enterBreathing() {
+    clearMask(_currentMask);
+    Layout::writeSeparators(_currentMask);
+    _sepLedCount = 0;
+    for (uint16_t i = 0; i < STRIP_LENGTH; ++i) if (_currentMask[i]) _sepLeds[_sepLedCount++] = i;
+    paintMask(_currentMask, CRGB(0, 0, 0));
+    _inTransition = false;
+    _dirty = true; // first level is always shown
   }
 
-  // Render HH:MM into _buffer according to the linear layout
-  void renderTime(uint8_t hh, uint8_t mm, bool* outMask) {
-    // Build pattern string matching regex: [\d_][\d_][-.':][\d_][\d_]
-    // Robustly parse separator from macro (handles :, '-', '.', '\'', with or without quotes)
-    const char* sepstr = SEP_STR_LIT;              // e.g. ":" or "-" or "':'"
-    char sep = (sepstr[0] == '\'' && sepstr[1])   // if ":'': then take second char
-           ? sepstr[1]
-           : sepstr[0];                      // else first char (e.g. ':')
-    char pattern[5];
-    pattern[0] = char('0' + (hh / 10));
-    pattern[1] = char('0' + (hh % 10));
-    pattern[2] = sep; // '-', '.', ':', or '\''
-    pattern[3] = char('0' + (mm / 10));
-    pattern[4] = char('0' + (mm % 10));
-
-    // Map pattern to mask
-    int offset = 0;
-    clearMask(outMask);
-    for (int i = 0; i < 5; ++i) {
-      char c = pattern[i];
-      if (i == 2) {
-        // Separator occupies FILLER_LENGTH LEDs
-        writeSeparator(outMask, offset, c);
-        offset += FILLER_LENGTH;
-      } else if (c == '_') {
-        // Blank digit
-        offset += DIGIT_LENGTH;
-      } else if (isDigit(c)) {
-        uint8_t digit = uint8_t(c - '0');
-        writeDigit(outMask, offset, digit);
-        offset += DIGIT_LENGTH;
-      } else {
-        // Unsupported char, treat as blank
-        offset += (i == 2) ? FILLER_LENGTH : DIGIT_LENGTH;
-      }
-    }
+  // 30 BPM separator breathing (min ~16% so it stays visibly on). Shown only
+  // when the level changes, at most BREATH_FPS times per second; a color
+  // change (_dirty) is applied on the next allowed frame.
+  void renderBreath(uint32_t ms) {
+    if (ms - _breathFrameMs < 1000UL / BREATH_FPS) return;
+    const uint8_t level = _breathCurve[beat8(30)];
+    if (level == _breathLevel && !_dirty) return;
+    _breathLevel = level;
+    _breathFrameMs = ms;
+    _dirty = false;
+    const CRGB base = _useOverrideColor ? _overrideColor : CRGB(_colorR, _colorG, _colorB);
+    const CRGB c = scaleColor(base, level);
+    for (uint16_t i = 0; i < _sepLedCount; ++i) _leds[_sepLeds[i]] = c;
+    showFrame(FrameStats::Kind::Static);
   }
 
-  void renderPattern(const char pattern[5], bool* outMask) {
-    int offset = 0;
-    clearMask(outMask);
-    for (int i = 0; i < 5; ++i) {
-      char c = pattern[i];
-      if (i == 2) {
-        writeSeparator(outMask, offset, c);
-        offset += FILLER_LENGTH;
-      } else if (c == '_') {
-        offset += DIGIT_LENGTH;
-      } else if (isDigit(c)) {
-        uint8_t digit = uint8_t(c - '0');
-        writeDigit(outMask, offset, digit);
-        offset += DIGIT_LENGTH;
-      } else {
-        offset += (i == 2) ? FILLER_LENGTH : DIGIT_LENGTH;
-      }
+  // base * intensity / 255 per channel (matches the historical per-LED math)
+  static CRGB scaleColor(const CRGB& c, uint8_t intensity) {
+    return CRGB((uint8_t)((c.r * intensity) / 255), (uint8_t)((c.g * intensity) / 255), (uint8_t)((c.b * intensity) / 255));
+  }
+
+  void paintMask(const bool* mask, const CRGB& on) {
+    const CRGB off(0, 0, 0);
+    for (uint16_t i = 0; i < STRIP_LENGTH; ++i) _leds[i] = mask[i] ? on : off;
+  }
+
+  // Change list: runs of adjacent LEDs that switch in the same direction
+  // between _prevMask and _targetMask. Segments are contiguous, so a minute
+  // change is a handful of runs regardless of LEDS_PER_SEG.
+  void buildRuns() {
+    _runCount = 0;
+    _runsOverflow = false;
+    for (uint16_t i = 0; i < STRIP_LENGTH; ) {
+      if (_prevMask[i] == _targetMask[i]) { ++i; continue; }
+      const bool on = _targetMask[i];
+      const uint16_t start = i;
+      while (i < STRIP_LENGTH && _prevMask[i] != _targetMask[i] && _targetMask[i] == on) ++i;
+      if (_runCount == MAX_RUNS) { _runsOverflow = true; return; }
+      _runs[_runCount++] = { start, (uint16_t)(i - start), on };
     }
   }
 
-  void writeDigit(bool* mask, int base, uint8_t digit) {
-    uint8_t segmask = SEVENSEG[digit];
-    // 7 segments -> for each bit, set LEDS_PER_SEG entries
-    for (int seg = 0; seg < 7; ++seg) {
-      bool on = (segmask & (1 << (6 - seg))) != 0; // MSB first
-      for (int led = 0; led < LEDS_PER_SEG; ++led) {
-        mask[base + seg * LEDS_PER_SEG + led] = on;
+  // Returns whether the run colors moved since the previous fade frame (a
+  // long fade repeats a progress step across several frames)
+  bool paintRuns(const CRGB& base, uint8_t progress) {
+    const CRGB rising = scaleColor(base, progress);
+    const CRGB falling = scaleColor(base, 255 - progress);
+    const bool moved = rising != _runRising || falling != _runFalling;
+    _runRising = rising;
+    _runFalling = falling;
+    if (_runsOverflow) {
+      // Arbitrary masks (setPixel): interpolate every changed LED
+      for (uint16_t i = 0; i < STRIP_LENGTH; ++i) {
+        if (_prevMask[i] != _targetMask[i]) _leds[i] = _targetMask[i] ? rising : falling;
       }
+      return moved;
     }
+    for (uint16_t r = 0; r < _runCount; ++r) {
+      fill_solid(_leds + _runs[r].start, _runs[r].len, _runs[r].on ? rising : falling);
+    }
+    return moved;
+  }
+
+  static void clearMask(bool* mask) {
+    for (int i = 0; i < STRIP_LENGTH; ++i) mask[i] = false;
+  }
+
+  static void copyMask(const bool* from, bool* to) {
+    for (int i = 0; i < STRIP_LENGTH; ++i) to[i] = from[i];
+  }
+
+  // Render the current time into outMask through the layout tables
+  void renderTime(uint8_t hh, uint8_t mm, uint8_t ss, bool* outMask) {
+    uint8_t values[SegLayout::MAX_DIGITS];
+    for (uint8_t d = 0; d < Layout::DIGITS; ++d) values[d] = Layout::digitValue(d, hh, mm, ss);
+    renderDigits(values, outMask);
   }
 
-  void writeSeparator(bool* mask, int base, char c) {
-    // FILLER layout (length = 2 + LEDS_PER_SEG) from the Python example:
-    // '.' => [off, off, off, sign]
-    // '-' => [off, sign, sign, off]
-    // '\'' => [sign, off, off, off]
-    // ':' (not in original mapping) -> choose middle dot: [sign, off, off, sign]
-    // Use first 2 fixed LEDs, then LEDS_PER_SEG for the vertical bar
-    // Map into _buffer as simple true/false pattern
-    // We'll linearize as positions 0..(FILLER_LENGTH-1)
-    for (int i = 0; i < FILLER_LENGTH; ++i) mask[base + i] = false;
-    switch (c) {
-      case '\'':
-        mask[base + 0] = true; break;
-      case '-':
-        mask[base + 1] = true; if (FILLER_LENGTH > 2) mask[base + 2] = true; break;
-      case '.':
-        mask[base + (FILLER_LENGTH - 1)] = true; break;
-      case ':':
-        mask[base + 0] = true; mask[base + (FILLER_LENGTH - 1)] = true; break;
-      default:
-        break; // center-ish
+  // values: one per digit cell (0..9, anything else = blank); separators always drawn
+  void renderDigits(const uint8_t* values, bool* outMask) {
+    for (uint8_t d = 0; d < Layout::DIGITS; ++d) {
+      Layout::writeDigit(outMask, d, Layout::T.role[d] == '_' ? 255 : values[d]);
     }
+    Layout::writeSeparators(outMask);
   }
 };
 
@@ -77,6 +77,14 @@ public:
   // Return the number of addressable elements if applicable; 0/1 is fine for simple outputs.
   uint16_t size() const override { return 1; }
 
+  // Tell the main loop when loop() next has work: here the next time poll, or
+  // right away when a change from the Web UI is pending.
+  uint32_t idleMs(uint32_t nowMs) const override {
+    if (_dirty) return 0;
+    const uint32_t elapsed = nowMs - _lastTimePollMs;
+    return elapsed >= 1000 ? 0 : 1000 - elapsed;
+  }
+
 private:
   // Example internal state
   uint8_t _colorR{0}, _colorG{0}, _colorB{0};
@@ -1,20 +1,31 @@
 // Driver_Qlock3030: Word‑clock style driver for a 114‑LED matrix strip using FastLED
 // Behavior:
-// - Renders time using the Qlock mask/mapping approach adapted from Example/MyQlock.
-// - Uses a linear 114‑LED strip wired to represent a 12x13 matrix (serpentine, with borders masked).
+// - Renders time from the packed frames in WordClock.hpp, generated by
+//   tools/wordclock.py from tools/wordclock/*.clock (grid, words, rules, wiring).
+// - Uses a linear 114‑LED strip wired to represent a 12x13 matrix (serpentine, with borders masked);
+//   MatrixMap.hpp gives the cell of each LED and back.
 // - Color is controlled by hal->fill(r,g,b) from the Web UI; default color if none set.
-// - Updates once per second; recomputes mask on minute changes (supports 5‑minute words + minute dots).
+// - Two layers: the word layer changes every five minutes and crossfades; the
+//   corner minute dots are an overlay written only into their own LEDs, with
+//   the next dot filling in over the current minute (QLOCK_SECONDS_PROGRESS).
 // - While not synced, LEDs remain off.
 
 #ifdef USE_QLOCK3030
 
 #include <Arduino.h>
 #include "HalDriver.hpp"
+#include "FrameStats.hpp"
+#include "AmbientSampler.hpp"
+#include "BrightnessCurve.hpp"
+#include "BrightnessController.hpp"
+#include "WordClock.hpp"
+#include "MatrixMap.hpp"
 #include "../services/TimeService.hpp"
 #include "../core/Log.hpp"
 #include "../core/Config.hpp"
 #include <FastLED.h>
 #include <time.h>
+#include <sys/time.h>
 
 #ifndef LED_PIN
 #define LED_PIN 2
@@ -32,6 +43,34 @@
 #define QLOCK_COLS 13
 #endif
 
+static_assert(WordClock::LED_COUNT == QLOCK_LED_COUNT, "QLOCK_LED_COUNT does not match the word-clock layout");
+static_assert(WordClock::ROWS == QLOCK_ROWS && WordClock::COLS == QLOCK_COLS, "QLOCK_ROWS/QLOCK_COLS do not match the word-clock layout");
+
+// Cell <-> strip index in both directions, checked at compile time
+static constexpr auto PANEL = Matrix::fromTable<QLOCK_ROWS, QLOCK_COLS, QLOCK_LED_COUNT>(WordClock::LED_AT, WordClock::NO_LED);
+static_assert(PANEL.error == Matrix::Ok, "word-clock wiring must map each LED to exactly one cell");
+
+#ifndef QLOCK_SECONDS_PROGRESS
+#define QLOCK_SECONDS_PROGRESS 1 // next minute dot ramps up with the seconds (0 = dots switch on the minute)
+#endif
+
+#ifndef QLOCK_PALETTE_STEPS
+#define QLOCK_PALETTE_STEPS 16 // palette entries for the gradient mode
+#endif
+static_assert(QLOCK_PALETTE_STEPS >= 4 && QLOCK_PALETTE_STEPS <= 255, "palette needs room for the four word groups");
+
+#ifndef QLOCK_OVERLAY_FPS
+#define QLOCK_OVERLAY_FPS 60 // cap for overlay-only frames
+#endif
+
+#ifndef QLOCK_FRAME_MS
+#define QLOCK_FRAME_MS 10 // loop period while fading or following a brightness change
+#endif
+
+#ifndef QLOCK_FOLLOW_MS
+#define QLOCK_FOLLOW_MS 1000 // longest idle sleep: ambient samples and AutoHue steps are picked up this often
+#endif
+
 #ifndef AMBIANT_ANALOG_PIN
 #define AMBIANT_ANALOG_PIN 4 // A2 on XIAO ESP32C3
 #endif
@@ -52,12 +91,13 @@ public:
     FastLED.addLeds<WS2812B, LED_PIN, GRB>(_leds, QLOCK_LED_COUNT);
     FastLED.setBrightness(128);
     fill_solid(_leds, QLOCK_LED_COUNT, CRGB::Black);
-    FastLED.show();
+    showFrame(FrameStats::Kind::Static);
     _colorR = 255; _colorG = 255; _colorB = 255; // default white
     _lastMinute = 255; // force first render
     _dirty = true;
     _lastHueUpdateMs = millis();
-    _lastAdcMs = millis();
+    _ambient.configure(_adcWindow, _ambient.filter());
+    _ambient.begin(AMBIANT_ANALOG_PIN, _adcPeriodMs);
     _fadeMs = 300; // default smoothing
   }
 
@@ -78,6 +118,17 @@ public:
     }
   }
 
+  void setPalette(uint8_t mode, uint32_t prefix, uint32_t minutes, uint32_t dots) override {
+    _palMode = mode <= 2 ? mode : 0;
+    _palPrefix = CRGB((uint8_t)(prefix >> 16), (uint8_t)(prefix >> 8), (uint8_t)prefix);
+    _palMinutes = CRGB((uint8_t)(minutes >> 16), (uint8_t)(minutes >> 8), (uint8_t)minutes);
+    _palDots = CRGB((uint8_t)(dots >> 16), (uint8_t)(dots >> 8), (uint8_t)dots);
+    rebuildPaletteIndex();
+    // Fade the words into the new colors
+    _needFadeFrame = true;
+    _dirty = true;
+  }
+
   void setSmoothing(uint16_t ms) override {
     _fadeMs = ms;
   }
@@ -90,41 +141,42 @@ public:
     _ambMinPct = minPct;
     _ambMaxPct = maxPct;
     _ambThreshold = threshold;
+    rebuildAmbientLut();
+    _dirty = true;
+  }
+
+  void setAmbientCurve(uint8_t curve) override {
+    _ambCurve = curve <= BrightnessCurve::CieL ? (BrightnessCurve::Curve)curve : BrightnessCurve::Linear;
+    rebuildAmbientLut();
     _dirty = true;
   }
 
   void loop() override {
     const uint32_t nowMs = millis();
-    // Periodic ADC read on A2 (GPIO4)
-    if (nowMs - _lastAdcMs >= _adcPeriodMs) {
-      _lastAdcMs = nowMs;
-      _adcRaw = (uint16_t)analogRead(AMBIANT_ANALOG_PIN); // default 12-bit on ESP32 (0..4095)
-      // Push into ring buffer sized by _adcWindow
-      if (_adcWindow == 0) _adcWindow = 1;
-      _adcBuf[_adcIndex] = _adcRaw;
-      _adcIndex = (_adcIndex + 1) % _adcWindow;
-      if (_adcCount < _adcWindow) _adcCount++;
-      // update moving average and flag dirty so brightness can change
-      uint32_t sum = 0;
-      for (uint8_t i = 0; i < _adcCount; ++i) sum += _adcBuf[i];
-      _adcAvg = (uint16_t)((sum + (_adcCount/2)) / _adcCount);
-      _dirty = true;
+    // Fold in ADC samples taken by the sampling timer on A2 (GPIO4)
+    if (_ambient.poll()) {
+      _adcRaw = _ambient.raw();
+      _adcAvg = _ambient.value();
+      if (!_ambLutReady) rebuildAmbientLut();
+      _brightness.setTarget(BrightnessCurve::lookup(_ambLut, _adcAvg));
     }
-    // Log average over last 10 seconds every 10 seconds
+    // Re-push only when the slew-limited brightness actually moves
+    if (_brightness.update(nowMs)) _dirty = true;
+    // Log the filtered value every 10 seconds
     if (nowMs - _lastAdcLogMs >= 10000) {
       _lastAdcLogMs = nowMs;
-      if (_adcCount > 0) {
-        uint32_t sum = 0;
-        for (uint8_t i = 0; i < _adcCount; ++i) sum += _adcBuf[i];
-        uint32_t avg = (sum + (_adcCount/2)) / _adcCount; // rounded integer average
-        LOGI("ADC avg(10s)=%u from %u samples", (unsigned)avg, (unsigned)_adcCount);
+      if (_ambient.samples() > 0) {
+        LOGI("ADC %s=%u from %u samples", AmbientSampler::filterName(_ambient.filter()),
+             (unsigned)_adcAvg, (unsigned)_ambient.samples());
       } else {
         LOGI("ADC avg(10s)=N/A (no samples)");
       }
     }
     if (nowMs - _lastPollMs < _renderIntervalMs) {
       // While below the render interval, still advance fades and any pending updates
-      if (_fading || _dirty) { applyToHardware(); _dirty = false; }
+      // A change queued behind a running fade (_needFadeFrame) starts as soon as it ends
+      if (_fading || _dirty || _needFadeFrame) { applyToHardware(); _dirty = false; }
+      else updateOverlay(nowMs);
       return;
     }
     _lastPollMs = nowMs;
@@ -133,9 +185,10 @@ public:
       // keep off until synced
       if (!_unsyncedShown) {
         fill_solid(_leds, QLOCK_LED_COUNT, CRGB::Black);
-        FastLED.show();
+        showFrame(FrameStats::Kind::Static);
         _unsyncedShown = true;
       }
+      _lastSlot = 0xFFFF; // redraw the words once synced
       return;
     }
     _unsyncedShown = false;
@@ -163,25 +216,38 @@ public:
         CHSV hsv = rgb2hsv_approximate(CRGB(_colorR,_colorG,_colorB));
         hsv.h = (uint8_t)lroundf((_autoHueAccumDeg / 360.0f) * 255.0f);
         CRGB rgb; hsv2rgb_rainbow(hsv, rgb);
-        _renderR = rgb.r; _renderG = rgb.g; _renderB = rgb.b;
-        _dirty = true;
+        if (rgb.r != _renderR || rgb.g != _renderG || rgb.b != _renderB) {
+          _renderR = rgb.r; _renderG = rgb.g; _renderB = rgb.b;
+          // Palette, word layer and dots follow the new hue now, not at the next five-minute slot
+          _needFadeFrame = true;
+          _dirty = true;
+        }
       }
     } else {
       _renderR = _colorR; _renderG = _colorG; _renderB = _colorB;
     }
 
-    // Only recompute mask when minute changes or on first render
-    if (mm != _lastMinute || _firstFrame) {
+    // Overlay state: dots for the minute, progress through it
+    if (ss != _lastSecond) { _lastSecond = ss; _secondStartMs = nowMs; }
+    _lastMinute = mm;
+    _second = ss;
+
+    // Word layer only changes every five minutes; minute changes stay in the overlay
+    const uint16_t slot = (uint16_t)((hh * 60 + mm) / 5);
+    if (slot != _lastSlot || _firstFrame) {
       _firstFrame = false;
-      _lastMinute = mm;
-      const uint32_t mask = timeMaskUpdate(hh, mm);
-      pixelStateUpdate(mask);
-  // Map state to TARGET buffer and start fade
-  renderFrame();
-  _needFadeFrame = true;
-  applyToHardware();
+      _lastSlot = slot;
+      memcpy(_frame, WordClock::words(hh, mm), WordClock::FRAME_BYTES);
+      // Map state to TARGET buffer and start fade
+      renderFrame();
+      _needFadeFrame = true;
+      applyToHardware();
+    } else if (_fading || _dirty || _needFadeFrame) {
+      // Poll frames keep a fade going instead of skipping a step every _renderIntervalMs
+      applyToHardware();
+      _dirty = false;
     } else {
-      // Optional: minute dots animation based on seconds could go here
+      updateOverlay(nowMs);
     }
   }
 
@@ -208,18 +274,27 @@ public:
 
   void clear() override { fill_solid(_leds, QLOCK_LED_COUNT, CRGB::Black); _dirty = true; }
 
-  void show() override { applyToHardware(); _dirty = false; FastLED.show(); }
+  void show() override { applyToHardware(); _dirty = false; showFrame(FrameStats::Kind::Static); }
 
   void setAmbientSampling(uint16_t periodMs, uint8_t avgCount) override {
     if (periodMs < 50) periodMs = 50; // avoid too fast
     if (periodMs > 5000) periodMs = 5000;
     if (avgCount == 0) avgCount = 1;
-    if (avgCount > ADC_MAX_WINDOW) avgCount = ADC_MAX_WINDOW;
+    if (avgCount > AmbientSampler::MAX_WINDOW) avgCount = AmbientSampler::MAX_WINDOW;
     _adcPeriodMs = periodMs;
     _adcWindow = avgCount;
-    // Reset averaging buffer safely
-    _adcIndex = 0;
-    _adcCount = 0;
+    // Restart the filter over the new window
+    _ambient.configure(_adcWindow, _ambient.filter());
+    if (_ambient.periodMs() != periodMs) _ambient.setPeriod(periodMs);
+  }
+
+  void setAmbientFilter(uint8_t mode) override {
+    _ambient.configure(_adcWindow, (AmbientSampler::Filter)mode);
+  }
+
+  void setBrightness(uint8_t scale) override {
+    _userScale = scale;
+    _dirty = true;
   }
 
   bool getAmbientReading(uint16_t& raw, uint16_t& avg) override {
@@ -228,8 +303,31 @@ public:
     return true;
   }
 
+  bool getTelemetry(HalTelemetry& out) const override {
+    _frames.fill(out);
+    return true;
+  }
+
   uint16_t size() const override { return QLOCK_LED_COUNT; }
 
+  // Between animations the panel only changes at the next dot step (or the
+  // next minute without QLOCK_SECONDS_PROGRESS), so the loop can sleep until
+  // then, or until the next ambient/AutoHue check if that comes first
+  uint32_t idleMs(uint32_t /*nowMs*/) const override {
+    if (_fading || _dirty || _needFadeFrame || _brightness.moving()) return QLOCK_FRAME_MS;
+    if (_firstFrame || _unsyncedShown) return _renderIntervalMs;
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    const uint32_t t = (uint32_t)(tv.tv_sec % 60) * 1000UL + (uint32_t)(tv.tv_usec / 1000); // ms into the minute
+#if QLOCK_SECONDS_PROGRESS
+    // Next partial-dot level: 255 steps over the minute
+    const uint32_t next = ((t * 255UL) / 60000UL + 1) * 60000UL / 255UL + 1;
+#else
+    const uint32_t next = 60000UL + 1;
+#endif
+    return next > t ? min<uint32_t>(next - t, QLOCK_FOLLOW_MS) : 0;
+  }
+
 private:
   CRGB _leds[QLOCK_LED_COUNT];
   CRGB _target[QLOCK_LED_COUNT];
@@ -239,6 +337,12 @@ private:
   uint32_t _lastPollMs{0};
   bool _unsyncedShown{false};
   uint8_t _lastMinute{255};
+  uint8_t _lastSecond{255};
+  uint8_t _second{0};
+  uint32_t _secondStartMs{0};
+  uint16_t _lastSlot{0xFFFF};
+  uint8_t _dotLevel[WordClock::DOT_COUNT + 1]{};
+  uint32_t _overlayShownMs{0};
   bool _dirty{false};
   bool _firstFrame{true};
   // Fading
@@ -252,12 +356,8 @@ private:
   float _autoHueAccumDeg{0.0f};
   uint32_t _lastHueUpdateMs{0};
   // ADC reading
+  AmbientSampler _ambient;
   uint16_t _adcRaw{0};
-  uint32_t _lastAdcMs{0};
-  static constexpr uint8_t ADC_MAX_WINDOW = 60;
-  uint16_t _adcBuf[ADC_MAX_WINDOW] = {0};
-  uint8_t _adcIndex{0};
-  uint8_t _adcCount{0};
   uint32_t _lastAdcLogMs{0};
   uint16_t _adcAvg{0};
   uint16_t _adcPeriodMs{250};
@@ -268,95 +368,121 @@ private:
   uint8_t _ambMinPct{10};
   uint8_t _ambMaxPct{100};
   uint16_t _ambThreshold{1000};
+  BrightnessCurve::Curve _ambCurve{BrightnessCurve::Linear};
+  uint8_t _ambLut[BrightnessCurve::LUT_SIZE]{};
+  bool _ambLutReady{false};
 
-  // Geometry and masks (adapted from Example/MyQlock.h)
-  // Mapping converts matrix (row,col) to strip index (150=unused)
-  const uint8_t Mapping[QLOCK_ROWS][QLOCK_COLS] = {
-    {113,150,150,150,150,150,150,150,150,150,150,150,101},
-    {150,112,111,110,109,108,107,106,105,104,103,102,150},
-    {150,90,91,92,93,94,95,96,97,98,99,100,150},
-    {150,89,88,87,86,85,84,83,82,81,80,79,150},
-    {150,68,69,70,71,72,73,74,75,76,77,78,150},
-    {150,67,66,65,64,63,62,61,60,59,58,57,150},
-    {150,46,47,48,49,50,51,52,53,54,55,56,150},
-    {150,45,44,43,42,41,40,39,38,37,36,35,150},
-    {150,24,25,26,27,28,29,30,31,32,33,34,150},
-    {150,23,22,21,20,19,18,17,16,15,14,13,150},
-    {150,1,2,3,4,5,6,7,8,9,10,11,150},
-    {0,150,150,150,150,150,150,150,150,150,150,150,12}
-  };
-
-  const uint32_t Mask[QLOCK_ROWS][QLOCK_COLS] = {
-    {16,0,0,0,0,0,0,0,0,0,0,0,30},
-    {0,1073610752,1073610752,0,1073610752,1073610752,1073610752,0,4194304,4194304,4194304,4194304,0},
-    {0,2097152,2097152,2097152,2097152,2097152,2097152,1048576,1048576,1048576,1048576,1048576,0},
-    {0,67108864,67108864,67108864,67108864,536870912,0,134217728,25165824,16777216,16777216,16777216,0},
-    {0,262144,262144,262144,131072,537001984,131072,131072,142737408,131072,0,0,0},
-    {0,268435456,268435456,268435456,268435456,537395200,524288,524288,8912896,134217728,0,0,0},
-    {0,33554432,33554432,33554432,33554432,536870912,536608768,536608768,536608768,536608768,536608768,536346624,0},
-    {0,126976,126976,126976,126976,126976,0,16384,16384,32896,32896,32896,0},
-    {0,256,256,0,16640,16640,16640,16640,16640,0,0,0,0},
-    {0,0,13824,13824,13824,13824,13824,5120,70720,70720,70720,70720,0},
-    {0,2048,2048,0,2048,2048,2048,2048,2048,0,0,0,0},
-    {24,0,0,0,0,0,0,0,0,0,0,0,28}
-  };
-
-  uint8_t AbsoluteOn[QLOCK_ROWS][QLOCK_COLS]{};
-
-  static uint32_t timeMaskUpdate(uint8_t H, uint8_t M) {
-    // Ported from Example/MyQlock.cpp
-    uint8_t hours = H % 13 + (H - 1) / 12 + (M >= 35);
-    uint8_t Minutes = M / 5;
-    uint8_t minutes = M % 5;
-    if (H == 23 && M >= 35) { hours = 0; }
-    if (H == 12 && M >= 35) { hours = 1; }
-    return (uint32_t)1 << (17 + hours) | (uint32_t)1 << (5 + Minutes) | (uint32_t)1 << minutes;
+  BrightnessController _brightness;
+
+  void rebuildAmbientLut() {
+    BrightnessCurve::build(_ambLut, _ambMinPct, _ambMaxPct, _ambThreshold, _ambCurve);
+    _ambLutReady = true;
+    // Settings changed: follow the new mapping even if the step is inside the deadband
+    _brightness.setTarget(BrightnessCurve::lookup(_ambLut, _adcAvg), true);
   }
+  uint8_t _userScale{255}; // master scale from setBrightness()
+  FrameStats _frames;
 
-  void pixelStateUpdate(uint32_t TimeMask) {
-    for (uint8_t x = 0; x < QLOCK_COLS; x++) {
-      for (uint8_t y = 0; y < QLOCK_ROWS; y++) {
-        AbsoluteOn[y][x] = ((Mask[y][x] & TimeMask) > 0) ? 1 : 0;
+  // changed: whether this frame's pixels differ from the last one shown
+  void showFrame(FrameStats::Kind kind, bool changed = true) {
+    const uint32_t t0 = _frames.start();
+    FastLED.show();
+    _frames.shown(t0, changed, FastLED.getBrightness(), kind);
+  }
+  uint16_t _fadeAmt{0xFFFF}; // blend step of the last fade frame shown
+
+  uint8_t _frame[WordClock::FRAME_BYTES]{}; // word layer of the current five-minute slot
+
+  // Palette: each LED points at one of QLOCK_PALETTE_STEPS colors. The index
+  // table depends only on the mode, the colors on the palette and the render
+  // color; both are rebuilt off the frame path, so rendering is a lookup.
+  uint8_t _palMode{0};
+  CRGB _palPrefix{255, 255, 255};
+  CRGB _palMinutes{0x33, 0xCC, 0xFF};
+  CRGB _palDots{0xFF, 0x99, 0x33};
+  CRGB _palette[QLOCK_PALETTE_STEPS];
+  uint8_t _ledPal[QLOCK_LED_COUNT]{};
+
+  void rebuildPaletteIndex() {
+    const uint16_t span = QLOCK_ROWS + QLOCK_COLS - 2;
+    for (uint16_t led = 0; led < QLOCK_LED_COUNT; ++led) {
+      uint8_t idx = 0;
+      if (_palMode == 1) {
+        const uint8_t g = WordClock::LED_GROUP[led];
+        idx = g == WordClock::Unused ? WordClock::Hour : g;
+      } else if (_palMode == 2) {
+        // Diagonal gradient, top-left (main color) to bottom-right (minutes color)
+        const Matrix::Cell cell = PANEL.cell[led];
+        idx = (uint8_t)(((cell.row + cell.col) * (QLOCK_PALETTE_STEPS - 1) + span / 2) / span);
       }
+      _ledPal[led] = idx;
     }
   }
 
-  void renderFrame() {
-    // Map AbsoluteOn into the linear TARGET buffer with current RGB color
-    for (uint8_t x = 0; x < QLOCK_COLS; x++) {
-      for (uint8_t y = 0; y < QLOCK_ROWS; y++) {
-        uint8_t idx = Mapping[y][x];
-        if (idx >= QLOCK_LED_COUNT) continue; // 150 markers ignored
-        if (AbsoluteOn[y][x]) _target[idx].setRGB(_renderR, _renderG, _renderB);
-        else _target[idx] = CRGB::Black;
+  void rebuildPalette() {
+    const CRGB main(_renderR, _renderG, _renderB);
+    if (_palMode == 1) {
+      _palette[WordClock::Prefix] = _palPrefix;
+      _palette[WordClock::Hour] = main;
+      _palette[WordClock::Minute] = _palMinutes;
+      _palette[WordClock::Dot] = _palDots;
+    } else if (_palMode == 2) {
+      for (uint8_t k = 0; k < QLOCK_PALETTE_STEPS; ++k) {
+        _palette[k] = blend(main, _palMinutes, (uint8_t)(k * 255 / (QLOCK_PALETTE_STEPS - 1)));
       }
+    } else {
+      _palette[0] = main;
     }
   }
 
-  void applyToHardware() {
-    // Compute target brightness based on ambient ADC average and configured mapping
-    uint8_t targetBrightness = 128; // default
-    uint8_t minPct = _ambMinPct;
-    uint8_t maxPct = _ambMaxPct;
-    if (maxPct < minPct) maxPct = minPct;
-    if (maxPct > 100) maxPct = 100;
-    if (minPct > 100) minPct = 100;
-    if (_adcAvg <= _ambThreshold) {
-      targetBrightness = (uint8_t)lroundf((maxPct / 100.0f) * 255.0f);
-    } else {
-      // Map [thr..4095] -> [maxPct..minPct] linearly
-      uint16_t a = _adcAvg;
-      uint16_t thr = _ambThreshold;
-      if (a > 4095) a = 4095;
-      if (thr > 4095) thr = 4095;
-      if (a < thr) a = thr;
-      uint16_t denom = (uint16_t)(4095 - thr);
-      float t = denom == 0 ? 1.0f : (float)(a - thr) / (float)denom; // 0..1
-      float pct = (float)maxPct + t * ((float)minPct - (float)maxPct);
-      if (pct < 0) pct = 0; if (pct > 100) pct = 100;
-      targetBrightness = (uint8_t)lroundf((pct / 100.0f) * 255.0f);
+  void renderFrame() {
+    // Map the packed frame into the linear TARGET buffer through the palette
+    rebuildPalette();
+    for (uint16_t i = 0; i < QLOCK_LED_COUNT; ++i) {
+      _target[i] = WordClock::lit(_frame, i) ? _palette[_ledPal[i]] : CRGB(CRGB::Black);
     }
-    FastLED.setBrightness(targetBrightness);
+  }
+
+  // Dot levels for the current minute: minute % 5 dots on, the next one
+  // filling in over the minute. True when any level changed.
+  bool computeDots(uint32_t nowMs) {
+    const uint8_t on = _lastMinute == 255 ? 0 : _lastMinute % 5;
+    uint8_t partial = 0;
+#if QLOCK_SECONDS_PROGRESS
+    uint32_t sub = nowMs - _secondStartMs;
+    if (sub > 999) sub = 999;
+    partial = (uint8_t)(((uint32_t)_second * 1000UL + sub) * 255UL / 60000UL);
+#endif
+    bool changed = false;
+    for (uint8_t i = 0; i < WordClock::DOT_COUNT; ++i) {
+      const uint8_t level = i < on ? 255 : (i == on ? partial : 0);
+      if (level != _dotLevel[i]) { _dotLevel[i] = level; changed = true; }
+    }
+    return changed;
+  }
+
+  // Write the overlay into its LEDs only (the word layer never lights a dot)
+  void compositeOverlay() {
+    for (uint8_t i = 0; i < WordClock::DOT_COUNT; ++i) {
+      CRGB c = _palette[_ledPal[WordClock::DOTS[i]]];
+      _leds[WordClock::DOTS[i]] = c.nscale8(_dotLevel[i]);
+    }
+  }
+
+  // Overlay-only frame: at most QLOCK_OVERLAY_FPS, and only when a dot level moved
+  void updateOverlay(uint32_t nowMs) {
+    if (_firstFrame || _unsyncedShown) return;
+    if (nowMs - _overlayShownMs < 1000UL / QLOCK_OVERLAY_FPS) return;
+    if (!computeDots(nowMs)) return;
+    _overlayShownMs = nowMs;
+    compositeOverlay();
+    showFrame(FrameStats::Kind::Static);
+  }
+
+  void applyToHardware() {
+    // Ambient brightness: curve table lookup, then deadband/slew limited
+    if (!_ambLutReady) rebuildAmbientLut();
+    FastLED.setBrightness(scale8(_brightness.output(), _userScale));
     const uint32_t nowMs = millis();
     if (_needFadeFrame && !_fading) {
       // Rebuild target to reflect latest color state (e.g., AutoHue/color change)
@@ -369,14 +495,19 @@ private:
         for (uint16_t i = 0; i < QLOCK_LED_COUNT; ++i) _leds[i] = _target[i];
       }
     }
+    const bool fadeFrame = _fading;
+    bool changed = true; // anything but a repeated fade step repaints
     if (_fading) {
       uint32_t dt = nowMs - _fadeStartMs;
       uint32_t dur = _fadeMs;
       if (dur == 0 || dt >= dur) {
         _fading = false;
+        _fadeAmt = 0xFFFF;
         for (uint16_t i = 0; i < QLOCK_LED_COUNT; ++i) _leds[i] = _target[i];
       } else {
         uint8_t amt = (uint8_t)((dt * 255UL) / dur);
+        changed = amt != _fadeAmt;
+        _fadeAmt = amt;
         for (uint16_t i = 0; i < QLOCK_LED_COUNT; ++i) {
           CRGB c = _start[i];
           nblend(c, _target[i], amt);
@@ -384,7 +515,12 @@ private:
         }
       }
     }
-    FastLED.show();
+    if (!_firstFrame) {
+      if (computeDots(nowMs)) changed = true;
+      compositeOverlay();
+    }
+    showFrame(!fadeFrame ? FrameStats::Kind::Static : _fading ? FrameStats::Kind::Fade : FrameStats::Kind::FadeEnd,
+              changed);
   }
 };
 
@@ -0,0 +1,93 @@
+#pragma once
+#include <Arduino.h>
+#include "HalDriver.hpp"
+
+#ifndef HAL_LATE_FRAME_MS
+#define HAL_LATE_FRAME_MS 40 // gap between fade frames that counts as late (frame tick is ~10 ms)
+#endif
+
+// Frame accounting shared by the LED drivers: wrap every strip update with
+// start()/shown() and report the counters through HalDriver::getTelemetry().
+class FrameStats {
+public:
+  enum class Kind : uint8_t { Static, Fade, FadeEnd };
+
+  uint32_t start() const { return micros(); }
+
+  // changed: the render path painted pixels that differ from the previous frame
+  // (drivers may report a full repaint as changed); kind: its role in a transition
+  void shown(uint32_t t0, bool changed, uint8_t brightness, Kind kind) {
+    const uint32_t endUs = micros();
+    const uint32_t dt = endUs - t0;
+    const uint32_t nowMs = millis();
+    _shown++;
+    _showSumUs += dt;
+    if (dt > _showMaxUs) _showMaxUs = dt;
+
+    if (changed || brightness != _brightness || _shown == 1) _rendered++;
+    _brightness = brightness;
+
+    if (kind != Kind::Static) {
+      if (_fadeFrames) {
+        if (nowMs - _lastShowMs > HAL_LATE_FRAME_MS) _late++;
+        // Frame pacing: interval to the previous fade frame and its change from the last interval
+        const uint32_t gap = endUs - _lastShowUs;
+        if (_gapValid) {
+          _jitterSumUs += gap > _lastGapUs ? gap - _lastGapUs : _lastGapUs - gap;
+          _jitterCount++;
+        }
+        _gapSumUs += gap;
+        _gapCount++;
+        if (gap > _gapMaxUs) _gapMaxUs = gap;
+        _lastGapUs = gap;
+        _gapValid = true;
+      }
+      _fadeFrames++;
+      if (kind == Kind::FadeEnd) {
+        _lastFadeFrames = _fadeFrames;
+        _fadeFramesSum += _fadeFrames;
+        _transitions++;
+        _fadeFrames = 0;
+        _gapValid = false;
+      }
+    }
+    _lastShowMs = nowMs;
+    _lastShowUs = endUs;
+  }
+
+  void fill(HalTelemetry& t) const {
+    t.framesRendered = _rendered;
+    t.framesShown = _shown;
+    t.showMeanUs = _shown ? (uint32_t)(_showSumUs / _shown) : 0;
+    t.showMaxUs = _showMaxUs;
+    t.transitions = _transitions;
+    t.lastFadeFrames = _lastFadeFrames;
+    t.meanFadeFrames = _transitions ? (uint16_t)(_fadeFramesSum / _transitions) : 0;
+    t.lateFrames = _late;
+    t.fadeGapMeanUs = _gapCount ? (uint32_t)(_gapSumUs / _gapCount) : 0;
+    t.fadeGapMaxUs = _gapMaxUs;
+    t.fadeJitterUs = _jitterCount ? (uint32_t)(_jitterSumUs / _jitterCount) : 0;
+    t.brightness = _brightness;
+  }
+
+private:
+  uint32_t _rendered{0};
+  uint32_t _shown{0};
+  uint64_t _showSumUs{0};
+  uint32_t _showMaxUs{0};
+  uint32_t _lastShowMs{0};
+  uint16_t _fadeFrames{0};
+  uint16_t _lastFadeFrames{0};
+  uint32_t _fadeFramesSum{0};
+  uint32_t _transitions{0};
+  uint32_t _late{0};
+  uint32_t _lastShowUs{0};
+  uint32_t _lastGapUs{0};
+  bool _gapValid{false};
+  uint64_t _gapSumUs{0};
+  uint32_t _gapCount{0};
+  uint32_t _gapMaxUs{0};
+  uint64_t _jitterSumUs{0};
+  uint32_t _jitterCount{0};
+  uint8_t _brightness{0};
+};
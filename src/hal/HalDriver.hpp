@@ -1,6 +1,22 @@
 #pragma once
 #include <Arduino.h>
 
+// Render-pipeline counters reported by drivers that support it (see getTelemetry)
+struct HalTelemetry {
+  uint32_t framesRendered;  // shown frames the render path changed (pixels or brightness)
+  uint32_t framesShown;     // strip updates pushed to the bus
+  uint32_t showMeanUs;      // mean duration of one strip update
+  uint32_t showMaxUs;
+  uint32_t transitions;     // completed fades
+  uint16_t lastFadeFrames;  // frames shown during the last completed fade
+  uint16_t meanFadeFrames;
+  uint32_t lateFrames;      // fade frames shown later than HAL_LATE_FRAME_MS after the previous one
+  uint32_t fadeGapMeanUs;   // interval between consecutive fade frames
+  uint32_t fadeGapMaxUs;
+  uint32_t fadeJitterUs;    // mean |change| between consecutive fade intervals
+  uint8_t brightness;       // effective global brightness (0..255)
+};
+
 class HalDriver {
 public:
   virtual ~HalDriver() = default;
@@ -12,6 +28,11 @@ public:
   virtual void show() = 0;
   virtual uint16_t size() const = 0;
 
+  // Optional: longest time (ms) loop() may go uncalled before the display falls
+  // behind; the main loop sleeps until the earliest deadline of all stages.
+  // The default keeps the fixed 10 ms tick for drivers that animate freely.
+  virtual uint32_t idleMs(uint32_t /*nowMs*/) const { return 10; }
+
   // Optional: runtime smoothing/transition control; default no-op
   virtual void setSmoothing(uint16_t /*ms*/) {}
 
@@ -31,6 +52,23 @@ public:
 
   // Optional: Ambient sampling configuration (default no-op)
   virtual void setAmbientSampling(uint16_t /*periodMs*/, uint8_t /*avgCount*/) {}
+
+  // Optional: Ambient filter over the sampling window (0 = moving average, 1 = EMA, 2 = median)
+  virtual void setAmbientFilter(uint8_t /*mode*/) {}
+
+  // Optional: Ambient brightness curve (0 = linear duty, 1 = gamma 2.2, 2 = CIE L*)
+  virtual void setAmbientCurve(uint8_t /*curve*/) {}
+
+  // Optional: word palette (0 = single color, 1 = prefix/hour/minute/dot groups, 2 = gradient
+  // across the grid from the main color to `minutes`); colors are 0xRRGGBB, the main color
+  // (fill/AutoHue) colors the hour words
+  virtual void setPalette(uint8_t /*mode*/, uint32_t /*prefix*/, uint32_t /*minutes*/, uint32_t /*dots*/) {}
+
+  // Optional: master output scale applied on top of any ambient control (255 = full, 0 = off)
+  virtual void setBrightness(uint8_t /*scale*/) {}
+
+  // Optional: render-pipeline telemetry (default not supported)
+  virtual bool getTelemetry(HalTelemetry& /*out*/) const { return false; }
 };
 
 HalDriver* createDefaultDriver();
@@ -0,0 +1,154 @@
+#include "HalTask.hpp"
+#include "../core/BootTrace.hpp"
+#include "../core/EventLoop.hpp"
+#include "../core/HeapTrack.hpp"
+#include "../core/Log.hpp"
+#include "../core/Perf.hpp"
+
+#ifdef ARDUINO_ARCH_ESP32
+
+// Tunables (override with -D flags)
+#ifndef RENDER_FRAME_MS
+#define RENDER_FRAME_MS 10        // frame tick while the driver animates
+#endif
+#ifndef RENDER_MAX_IDLE_MS
+#define RENDER_MAX_IDLE_MS 10000  // longest sleep between frames when nothing animates; the driver's
+                                  // idleMs() sets the real deadline (Qlock: dot step or QLOCK_FOLLOW_MS)
+#endif
+#ifndef RENDER_TASK_PRIORITY
+#define RENDER_TASK_PRIORITY 12   // above AsyncTCP (CONFIG_ASYNC_TCP_PRIORITY, 10) and the loop task (1),
+                                  // below lwIP (18) and the Wi-Fi driver (23)
+#endif
+#ifndef RENDER_TASK_CORE
+#define RENDER_TASK_CORE -1       // dual-core parts: 0 or 1 pins the task, -1 lets it float
+#endif
+#ifndef RENDER_TASK_STACK
+#define RENDER_TASK_STACK 4096
+#endif
+#ifndef RENDER_QUEUE_DEPTH
+#define RENDER_QUEUE_DEPTH 16     // pending commands; boot applies about a dozen at once
+#endif
+#ifndef RENDER_POST_WAIT_MS
+#define RENDER_POST_WAIT_MS 20    // how long a setter waits for queue space before dropping
+#endif
+
+static_assert(RENDER_TASK_PRIORITY < configMAX_PRIORITIES, "RENDER_TASK_PRIORITY out of range");
+
+void HalTask::begin() {
+  _hal->begin();
+  _queue = xQueueCreate(RENDER_QUEUE_DEPTH, sizeof(Cmd));
+  const BaseType_t core = (RENDER_TASK_CORE >= 0 && RENDER_TASK_CORE < portNUM_PROCESSORS) ? RENDER_TASK_CORE : tskNO_AFFINITY;
+  if (!_queue || xTaskCreatePinnedToCore(taskEntry, "render", RENDER_TASK_STACK, this, RENDER_TASK_PRIORITY, &_task, core) != pdPASS) {
+    LOGE("render task start failed");
+    _task = nullptr;
+    return;
+  }
+  LOGI("render task: prio %d core %d tick %u ms", RENDER_TASK_PRIORITY, (int)RENDER_TASK_CORE, (unsigned)RENDER_FRAME_MS);
+}
+
+void HalTask::post(Op op, uint8_t a, uint8_t b, uint8_t c, uint32_t x, uint32_t y, uint32_t z) {
+  const Cmd cmd{ op, a, b, c, x, y, z };
+  if (!_task) { apply(cmd); return; } // no render task: fall back to calling the driver directly
+  if (xQueueSend(_queue, &cmd, pdMS_TO_TICKS(RENDER_POST_WAIT_MS)) != pdTRUE) {
+    _dropped++;
+    LOGW("render queue full, command %u dropped", (unsigned)op);
+  }
+}
+
+void HalTask::apply(const Cmd& cmd) {
+  switch (cmd.op) {
+    case Op::SetPixel:         _hal->setPixel((uint16_t)cmd.x, cmd.a, cmd.b, cmd.c); break;
+    case Op::Fill:             _hal->fill(cmd.a, cmd.b, cmd.c); break;
+    case Op::Clear:            _hal->clear(); break;
+    case Op::Show:             _hal->show(); break;
+    case Op::Smoothing:        _hal->setSmoothing((uint16_t)cmd.x); break;
+    case Op::RestartAnimation: _hal->restartAnimation(); break;
+    case Op::AutoHue:          _hal->setAutoHue(cmd.a != 0, (uint16_t)cmd.x); break;
+    case Op::AmbientControl:   _hal->setAmbientControl(cmd.a, cmd.b, (uint16_t)cmd.x); break;
+    case Op::AmbientSampling:  _hal->setAmbientSampling((uint16_t)cmd.x, cmd.a); break;
+    case Op::AmbientFilter:    _hal->setAmbientFilter(cmd.a); break;
+    case Op::AmbientCurve:     _hal->setAmbientCurve(cmd.a); break;
+    case Op::Palette:          _hal->setPalette(cmd.a, cmd.x, cmd.y, cmd.z); break;
+    case Op::Brightness:       _hal->setBrightness(cmd.a); break;
+  }
+}
+
+void HalTask::loop() {
+  if (!_task) frame(); // fallback: render on the caller
+}
+
+void HalTask::drain() {
+  if (!_queue) return;
+  Cmd cmd;
+  while (xQueueReceive(_queue, &cmd, 0) == pdTRUE) apply(cmd);
+}
+
+bool HalTask::getAmbientReading(uint16_t& raw, uint16_t& avg) {
+  if (!_task) return _hal->getAmbientReading(raw, avg);
+  portENTER_CRITICAL(&_mux);
+  raw = _ambientRaw;
+  avg = _ambientAvg;
+  const bool ok = _ambientOk;
+  portEXIT_CRITICAL(&_mux);
+  return ok;
+}
+
+bool HalTask::getTelemetry(HalTelemetry& out) const {
+  if (!_task) return _hal->getTelemetry(out);
+  portENTER_CRITICAL(&_mux);
+  out = _telemetry;
+  const bool ok = _telemetryOk;
+  portEXIT_CRITICAL(&_mux);
+  return ok;
+}
+
+// Render task only: publish the readings other tasks may ask for
+void HalTask::snapshot() {
+  uint16_t raw = 0, avg = 0;
+  const bool ambientOk = _hal->getAmbientReading(raw, avg);
+  HalTelemetry t{};
+  const bool telemetryOk = _hal->getTelemetry(t);
+  portENTER_CRITICAL(&_mux);
+  _ambientOk = ambientOk;
+  _ambientRaw = raw;
+  _ambientAvg = avg;
+  _telemetryOk = telemetryOk;
+  _telemetry = t;
+  portEXIT_CRITICAL(&_mux);
+}
+
+void HalTask::frame() {
+  drain();
+  { Perf::Scope s(Perf::Stage::Hal); HeapTrack::Scope h(HeapTrack::Tag::Hal); _hal->loop(); }
+  snapshot();
+  if (!_firstFrame) {
+    _firstFrame = true;
+    BootTrace::mark(BootTrace::Phase::FirstFrame);
+    EventLoop::post(EventLoop::Event::Render);
+  }
+}
+
+void HalTask::taskEntry(void* arg) {
+  static_cast<HalTask*>(arg)->run();
+}
+
+void HalTask::run() {
+  const TickType_t tick = pdMS_TO_TICKS(RENDER_FRAME_MS);
+  TickType_t lastWake = xTaskGetTickCount();
+  for (;;) {
+    frame();
+    uint32_t idle = _hal->idleMs(millis());
+    if (idle <= RENDER_FRAME_MS) {
+      // Animating: fixed frame tick; commands wait for the next frame
+      vTaskDelayUntil(&lastWake, tick);
+    } else {
+      // Nothing moving: sleep until the driver's deadline or the next command
+      if (idle > RENDER_MAX_IDLE_MS) idle = RENDER_MAX_IDLE_MS;
+      Cmd cmd;
+      if (xQueueReceive(_queue, &cmd, pdMS_TO_TICKS(idle)) == pdTRUE) apply(cmd);
+      lastWake = xTaskGetTickCount();
+    }
+  }
+}
+
+#endif // ARDUINO_ARCH_ESP32
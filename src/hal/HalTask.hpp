@@ -0,0 +1,93 @@
+#pragma once
+#include <Arduino.h>
+#include "HalDriver.hpp"
+#ifdef ARDUINO_ARCH_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+
+// Runs a HalDriver on its own FreeRTOS render task and stands in for it.
+//
+// Setters called from the web (AsyncTCP) task, the main loop or MQTT become
+// commands on a queue; the render task applies them between frames, so only
+// that task ever touches the driver. Readings (ambient, telemetry) come from a
+// snapshot the render task refreshes after every frame.
+//
+// While the driver animates (idleMs() <= RENDER_FRAME_MS) the task runs on a
+// fixed frame tick; otherwise it sleeps until the driver's deadline or the next
+// command.
+//
+// FreeRTOS only: elsewhere main.cpp builds with RENDER_TASK 0 and runs the
+// driver on the loop task.
+class HalTask : public HalDriver {
+public:
+  explicit HalTask(HalDriver* hal) : _hal(hal) {}
+
+  // Driver begin() on the caller, then start the render task
+  void begin() override;
+  // Rendering happens on the render task; these only matter if it failed to start
+  void loop() override;
+  uint32_t idleMs(uint32_t nowMs) const override { return _task ? UINT32_MAX : _hal->idleMs(nowMs); }
+
+  void setPixel(uint16_t index, uint8_t r, uint8_t g, uint8_t b) override { post(Op::SetPixel, r, g, b, index); }
+  void fill(uint8_t r, uint8_t g, uint8_t b) override { post(Op::Fill, r, g, b); }
+  void clear() override { post(Op::Clear); }
+  void show() override { post(Op::Show); }
+  uint16_t size() const override { return _hal->size(); }
+
+  void setSmoothing(uint16_t ms) override { post(Op::Smoothing, 0, 0, 0, ms); }
+  void restartAnimation() override { post(Op::RestartAnimation); }
+  void setAutoHue(bool enabled, uint16_t degPerMin) override { post(Op::AutoHue, enabled, 0, 0, degPerMin); }
+  void setAmbientControl(uint8_t minPct, uint8_t maxPct, uint16_t threshold) override {
+    post(Op::AmbientControl, minPct, maxPct, 0, threshold);
+  }
+  void setAmbientSampling(uint16_t periodMs, uint8_t avgCount) override { post(Op::AmbientSampling, avgCount, 0, 0, periodMs); }
+  void setAmbientFilter(uint8_t mode) override { post(Op::AmbientFilter, mode); }
+  void setAmbientCurve(uint8_t curve) override { post(Op::AmbientCurve, curve); }
+  void setPalette(uint8_t mode, uint32_t prefix, uint32_t minutes, uint32_t dots) override {
+    post(Op::Palette, mode, 0, 0, prefix, minutes, dots);
+  }
+  void setBrightness(uint8_t scale) override { post(Op::Brightness, scale); }
+
+  bool getAmbientReading(uint16_t& raw, uint16_t& avg) override;
+  bool getTelemetry(HalTelemetry& out) const override;
+
+  // Commands dropped because the queue stayed full
+  uint32_t dropped() const { return _dropped; }
+
+private:
+  enum class Op : uint8_t {
+    SetPixel, Fill, Clear, Show, Smoothing, RestartAnimation, AutoHue,
+    AmbientControl, AmbientSampling, AmbientFilter, AmbientCurve, Palette, Brightness
+  };
+
+  struct Cmd {
+    Op op;
+    uint8_t a, b, c;
+    uint32_t x, y, z;
+  };
+
+  HalDriver* _hal;
+  QueueHandle_t _queue{nullptr};
+  TaskHandle_t _task{nullptr};
+  mutable portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+  volatile uint32_t _dropped{0};
+  bool _firstFrame{false};
+
+  // Snapshot published by the render task
+  bool _ambientOk{false};
+  uint16_t _ambientRaw{0};
+  uint16_t _ambientAvg{0};
+  bool _telemetryOk{false};
+  HalTelemetry _telemetry{};
+
+  void post(Op op, uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint32_t x = 0, uint32_t y = 0, uint32_t z = 0);
+  void apply(const Cmd& cmd);
+  void drain();
+  void frame();
+  void snapshot();
+  static void taskEntry(void* arg);
+  void run();
+};
+
+#endif // ARDUINO_ARCH_ESP32
@@ -0,0 +1,103 @@
+#pragma once
+#include <Arduino.h>
+
+// Compile-time LED matrix description.
+//
+// A Map ties a Rows x Cols grid of cells to the Count LEDs of a strip:
+//   led[r][c]   strip index of a cell (NONE where the panel has no LED)
+//   cell[i]     row / column of strip index i
+// Both directions are resolved by constexpr builders, so effects can work in
+// matrix space (neighbors, gradients) while output stays in strip order, and
+// iterating cell[] visits only real LEDs, without scanning masked cells.
+// The builders use C++14 constexpr (loops, local state); platformio.ini builds
+// with gnu++17 because the core defaults to gnu++11.
+static_assert(__cplusplus >= 201402L, "MatrixMap needs C++14 or later (-std=gnu++17 in platformio.ini)");
+
+namespace Matrix {
+  constexpr uint16_t NONE = 0xFFFF;
+
+  struct Cell { uint8_t row; uint8_t col; };
+
+  enum Error : uint8_t { Ok, OutOfRange, Duplicate, Missing };
+
+  template <uint8_t Rows, uint8_t Cols, uint16_t Count>
+  struct Map {
+    static constexpr uint8_t ROWS = Rows;
+    static constexpr uint8_t COLS = Cols;
+    static constexpr uint16_t COUNT = Count;
+
+    uint8_t error;
+    uint16_t led[Rows][Cols];
+    Cell cell[Count];
+
+    // Strip index at (r, c); NONE off the grid or where there is no LED
+    constexpr uint16_t at(int r, int c) const {
+      return (r < 0 || c < 0 || r >= Rows || c >= Cols) ? NONE : led[r][c];
+    }
+  };
+
+  // From a forward table such as WordClock::LED_AT, where `none` marks cells
+  // without an LED. Every strip index must appear exactly once.
+  template <uint8_t Rows, uint8_t Cols, uint16_t Count, class T>
+  constexpr Map<Rows, Cols, Count> fromTable(const T (&table)[Rows][Cols], T none) {
+    Map<Rows, Cols, Count> m{};
+    bool seen[Count]{};
+    for (uint8_t r = 0; r < Rows; ++r) {
+      for (uint8_t c = 0; c < Cols; ++c) {
+        const T v = table[r][c];
+        m.led[r][c] = NONE;
+        if (v == none) continue;
+        if ((uint32_t)v >= Count) { m.error = OutOfRange; return m; }
+        if (seen[v]) { m.error = Duplicate; return m; }
+        seen[v] = true;
+        m.led[r][c] = (uint16_t)v;
+        m.cell[v] = Cell{ r, c };
+      }
+    }
+    for (uint16_t i = 0; i < Count; ++i) if (!seen[i]) { m.error = Missing; return m; }
+    return m;
+  }
+
+  // Fully populated serpentine panel: row 0 runs left to right, row 1 back,
+  // and so on. bottomUp starts the strip on the last row instead.
+  template <uint8_t Rows, uint8_t Cols>
+  constexpr Map<Rows, Cols, (uint16_t)(Rows * Cols)> serpentine(bool bottomUp = false) {
+    Map<Rows, Cols, (uint16_t)(Rows * Cols)> m{};
+    uint16_t i = 0;
+    for (uint8_t k = 0; k < Rows; ++k) {
+      const uint8_t r = bottomUp ? (uint8_t)(Rows - 1 - k) : k;
+      for (uint8_t j = 0; j < Cols; ++j) {
+        const uint8_t c = (k & 1) ? (uint8_t)(Cols - 1 - j) : j;
+        m.led[r][c] = i;
+        m.cell[i++] = Cell{ r, c };
+      }
+    }
+    return m;
+  }
+
+  // Pixel buffer in strip order, addressable by cell. The map must outlive
+  // the frame (in practice a static constexpr table).
+  template <class MapT, class Pixel>
+  class Frame {
+  public:
+    Frame(const MapT& map, Pixel* pixels) : _map(map), _px(pixels) {}
+
+    Pixel& operator[](uint16_t led) const { return _px[led]; }
+
+    // Pixel at (r, c), nullptr off the grid or where there is no LED
+    Pixel* at(int r, int c) const {
+      const uint16_t i = _map.at(r, c);
+      return i == NONE ? nullptr : &_px[i];
+    }
+
+    // fn(led, cell, pixel) for every real LED, in strip order
+    template <class Fn>
+    void forEach(Fn fn) const {
+      for (uint16_t i = 0; i < MapT::COUNT; ++i) fn(i, _map.cell[i], _px[i]);
+    }
+
+  private:
+    const MapT& _map;
+    Pixel* _px;
+  };
+}
@@ -0,0 +1,171 @@
+#pragma once
+#include <Arduino.h>
+
+// Compile-time 7-segment layout description.
+//
+// A layout is a pattern string in wiring order:
+//   'H' 'M' 'S'   digit cell (first occurrence = tens, second = ones)
+//   '_'           blank digit cell (LEDs present, never lit)
+//   - . : '       separator cell showing that glyph
+//   '*'           separator cell showing the default glyph (STRIP_SEPARATOR)
+//   '|'           continue on the next strip / data pin
+// e.g. "HH*MM" (classic), "HH:MM:SS", "HH:MM|SS" (seconds on a second pin).
+//
+// Each digit has 7 segments of LEDS_PER_SEG LEDs wired in the order given by a
+// string of segment letters ("fabcdeg" = f first, g last). Separators are
+// 2 + LEDS_PER_SEG LEDs. All strips share one LED buffer, strip k starting at
+// stripStart[k].
+//
+// build() resolves everything into index tables at compile time so rendering
+// is a table lookup per segment, independent of the layout's shape. It is a
+// C++14 constexpr function (loops, local state); platformio.ini builds with
+// gnu++17 for it.
+namespace SegLayout {
+  constexpr uint8_t MAX_DIGITS = 6;
+  constexpr uint8_t MAX_SEPS = 4;
+  constexpr uint8_t MAX_STRIPS = 4;
+
+  // Canonical segment bits: bit0 = a ... bit6 = g
+  //    a
+  //  f   b
+  //    g
+  //  e   c
+  //    d
+  constexpr uint8_t GLYPHS[10] = { 0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F };
+
+  enum Error : uint8_t { Ok, TooManyDigits, TooManySeps, TooManyStrips, BadRole, BadChar, BadOrder, Empty };
+
+  struct Table {
+    uint8_t error;
+    uint8_t digits;                    // digit cells, including blanks
+    uint8_t seps;
+    uint8_t strips;
+    uint16_t length;                   // LEDs over all strips
+    bool hasSeconds;
+    char role[MAX_DIGITS];             // 'H', 'M', 'S' or '_'
+    uint8_t place[MAX_DIGITS];         // 0 = tens, 1 = ones
+    uint16_t seg[MAX_DIGITS][7];       // first LED of canonical segment a..g
+    uint16_t sepBase[MAX_SEPS];        // first LED of each separator
+    char sepGlyph[MAX_SEPS];
+    uint16_t stripStart[MAX_STRIPS + 1];
+  };
+
+  // "'.'" / ".": the char of a stringified STRIP_SEPARATOR
+  constexpr char glyphFromLiteral(const char* s) {
+    return (s[0] == '\'' && s[1]) ? s[1] : s[0];
+  }
+
+  constexpr Table build(const char* pattern, uint8_t ledsPerSeg, const char* order, char defaultSep) {
+    Table t{};
+    uint8_t pos[7] = {};               // canonical segment -> position along the digit
+    uint8_t seen = 0;
+    for (uint8_t i = 0; i < 7; ++i) {
+      const char c = order[i];
+      if (c < 'a' || c > 'g' || (seen & (1 << (c - 'a')))) { t.error = BadOrder; return t; }
+      seen |= (uint8_t)(1 << (c - 'a'));
+      pos[c - 'a'] = i;
+    }
+    if (order[7]) { t.error = BadOrder; return t; }
+
+    const uint16_t digitLen = (uint16_t)(7 * ledsPerSeg);
+    const uint16_t sepLen = (uint16_t)(2 + ledsPerSeg);
+    uint8_t count[3] = {};             // H, M, S occurrences
+    uint16_t at = 0;
+    t.strips = 1;
+    for (const char* p = pattern; *p; ++p) {
+      const char c = *p;
+      if (c == '|') {
+        if (t.strips == MAX_STRIPS) { t.error = TooManyStrips; return t; }
+        t.stripStart[t.strips++] = at;
+      } else if (c == 'H' || c == 'M' || c == 'S' || c == '_') {
+        if (t.digits == MAX_DIGITS) { t.error = TooManyDigits; return t; }
+        const uint8_t d = t.digits++;
+        t.role[d] = c;
+        if (c != '_') {
+          const uint8_t r = (c == 'H') ? 0 : (c == 'M') ? 1 : 2;
+          if (count[r] == 2) { t.error = BadRole; return t; }
+          t.place[d] = count[r]++;
+        }
+        for (uint8_t s = 0; s < 7; ++s) t.seg[d][s] = (uint16_t)(at + pos[s] * ledsPerSeg);
+        at = (uint16_t)(at + digitLen);
+      } else if (c == '*' || c == ':' || c == '-' || c == '.' || c == '\'') {
+        if (t.seps == MAX_SEPS) { t.error = TooManySeps; return t; }
+        t.sepGlyph[t.seps] = (c == '*') ? defaultSep : c;
+        t.sepBase[t.seps++] = at;
+        at = (uint16_t)(at + sepLen);
+      } else {
+        t.error = BadChar; return t;
+      }
+    }
+    // Each role needs both its digits (a lone 'H' would show only the tens)
+    for (uint8_t r = 0; r < 3; ++r) if (count[r] == 1) { t.error = BadRole; return t; }
+    if (!t.digits) { t.error = Empty; return t; }
+    t.hasSeconds = count[2] == 2;
+    t.length = at;
+    t.stripStart[t.strips] = at;
+    return t;
+  }
+
+  // Layout<Pattern, LedsPerSeg, Order, Sep>: Pattern / Order must be
+  // namespace-scope constexpr char arrays.
+  template <const char* Pattern, uint8_t LedsPerSeg, const char* Order, char Sep>
+  struct Layout {
+    static constexpr Table T = build(Pattern, LedsPerSeg, Order, Sep);
+    static_assert(T.error != BadOrder, "segment order must name each of a..g exactly once");
+    static_assert(T.error != TooManyDigits, "layout has more than MAX_DIGITS digit cells");
+    static_assert(T.error != TooManySeps, "layout has more than MAX_SEPS separators");
+    static_assert(T.error != TooManyStrips, "layout has more than MAX_STRIPS strips");
+    static_assert(T.error != BadRole, "H, M and S must each appear twice or not at all");
+    static_assert(T.error != BadChar, "layout chars: H M S _ * : - . ' |");
+    static_assert(T.error != Empty, "layout has no digits");
+    static_assert(LedsPerSeg > 0, "LEDS_PER_SEG must be at least 1");
+
+    static constexpr uint8_t LEDS = LedsPerSeg;
+    static constexpr uint16_t DIGIT_LENGTH = 7 * LedsPerSeg;
+    static constexpr uint16_t SEP_LENGTH = 2 + LedsPerSeg;
+    static constexpr uint16_t LENGTH = T.length;
+    static constexpr uint8_t DIGITS = T.digits;
+    static constexpr uint8_t SEPS = T.seps;
+    static constexpr uint8_t STRIPS = T.strips;
+    static constexpr bool SECONDS = T.hasSeconds;
+
+    // Light digit cell d with value 0..9 (>9 = blank)
+    static void writeDigit(bool* mask, uint8_t d, uint8_t value) {
+      const uint8_t bits = value < 10 ? GLYPHS[value] : 0;
+      for (uint8_t s = 0; s < 7; ++s) memset(mask + T.seg[d][s], (bits >> s) & 1, LedsPerSeg);
+    }
+
+    // Separator layout (SEP_LENGTH LEDs): two single LEDs then a bar of LedsPerSeg
+    //   '\'' => [sign, off, off, off]   '-' => [off, sign, sign, off]
+    //   '.'  => [off, off, off, sign]   ':' => [sign, off, off, sign]
+    static void writeSeparator(bool* mask, uint8_t i, char glyph) {
+      bool* m = mask + T.sepBase[i];
+      memset(m, 0, SEP_LENGTH);
+      switch (glyph) {
+        case '\'': m[0] = true; break;
+        case '-':  m[1] = true; if (SEP_LENGTH > 2) m[2] = true; break;
+        case '.':  m[SEP_LENGTH - 1] = true; break;
+        case ':':  m[0] = true; m[SEP_LENGTH - 1] = true; break;
+        default:   break;
+      }
+    }
+
+    static void writeSeparators(bool* mask) {
+      for (uint8_t i = 0; i < SEPS; ++i) writeSeparator(mask, i, T.sepGlyph[i]);
+    }
+
+    // Time -> digit values per cell (blank cells stay blank)
+    static uint8_t digitValue(uint8_t d, uint8_t hh, uint8_t mm, uint8_t ss) {
+      const char r = T.role[d];
+      const uint8_t v = (r == 'H') ? hh : (r == 'M') ? mm : (r == 'S') ? ss : 255;
+      if (v == 255) return 255;
+      return T.place[d] ? v % 10 : v / 10;
+    }
+  };
+
+#if __cplusplus < 201703L
+  // T is indexed at run time; before C++17 that needs a namespace-scope definition
+  template <const char* Pattern, uint8_t LedsPerSeg, const char* Order, char Sep>
+  constexpr Table Layout<Pattern, LedsPerSeg, Order, Sep>::T;
+#endif
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <Arduino.h>
+
+// Word-clock panel tables generated by tools/wordclock.py from
+// tools/wordclock/<lang>.clock. Pick the panel with -D QLOCK_LANG_EN=1 or
+// -D QLOCK_LANG_DE=1 (default: French).
+#if defined(QLOCK_LANG_EN)
+#include "wordclock/WordClock_en.hpp"
+#elif defined(QLOCK_LANG_DE)
+#include "wordclock/WordClock_de.hpp"
+#else
+#include "wordclock/WordClock_fr.hpp"
+#endif
+
+namespace WordClock {
+  // Values of LED_GROUP
+  enum Group : uint8_t { Prefix, Hour, Minute, Dot, Unused };
+
+  inline bool lit(const uint8_t* frame, uint16_t led) {
+    return (frame[led >> 3] >> (led & 7)) & 1;
+  }
+
+  // Word layer for hh:mm (no minute dots)
+  inline const uint8_t* words(uint8_t hh, uint8_t mm) {
+    return WORDS[(hh * 60 + mm) / 5];
+  }
+
+  // Packed frame for hh:mm: the word layer of its five-minute slot plus
+  // minute % 5 corner dots
+  inline void frame(uint8_t hh, uint8_t mm, uint8_t* out) {
+    memcpy(out, words(hh, mm), FRAME_BYTES);
+    for (uint8_t i = 0; i < mm % 5 && i < DOT_COUNT; ++i) out[DOTS[i] >> 3] |= (uint8_t)(1 << (DOTS[i] & 7));
+  }
+}
@@ -0,0 +1,345 @@
+// Generated by tools/wordclock.py from tools/wordclock/de.clock - do not edit.
+#pragma once
+#include <stdint.h>
+
+// Grid:
+//   o...........o
+//   .ESKISTAFÜNF.
+//   .ZEHNZWANZIG.
+//   .DREIVIERTEL.
+//   .VORFUNKNACH.
+//   .HALBAELFÜNF.
+//   .EINSXAMZWEI.
+//   .DREIPMJVIER.
+//   .SECHSNLACHT.
+//   .SIEBENZWÖLF.
+//   .ZEHNEUNKUHR.
+//   o...........o
+namespace WordClock {
+  constexpr const char* LANG = "de";
+  constexpr uint8_t ROWS = 12;
+  constexpr uint8_t COLS = 13;
+  constexpr uint16_t LED_COUNT = 114;
+  constexpr uint8_t NO_LED = 0xFF;
+  constexpr uint8_t FRAME_BYTES = 15;
+  constexpr uint16_t SLOTS = 288; // five-minute slots per day
+
+  // Strip index of each cell, NO_LED where the panel has none
+  constexpr uint8_t LED_AT[ROWS][COLS] = {
+    {113, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, 101},
+    {NO_LED, 112, 111, 110, 109, 108, 107, 106, 105, 104, 103, 102, NO_LED},
+    {NO_LED, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, NO_LED},
+    {NO_LED, 89, 88, 87, 86, 85, 84, 83, 82, 81, 80, 79, NO_LED},
+    {NO_LED, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, NO_LED},
+    {NO_LED, 67, 66, 65, 64, 63, 62, 61, 60, 59, 58, 57, NO_LED},
+    {NO_LED, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, NO_LED},
+    {NO_LED, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, NO_LED},
+    {NO_LED, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, NO_LED},
+    {NO_LED, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, NO_LED},
+    {NO_LED, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, NO_LED},
+    {0, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, 12},
+  };
+
+  // Minute dots in lighting order: minute % 5 == k lights the first k
+  constexpr uint8_t DOT_COUNT = 4;
+  constexpr uint8_t DOTS[DOT_COUNT + 1] = {101, 12, 0, 113, NO_LED};
+
+  // Word group of each LED: 0 prefix, 1 hour, 2 minute, 3 dot, 4 never lit
+  constexpr uint8_t LED_GROUP[LED_COUNT] = {
+    3, 1, 1, 1, 1, 1, 1, 1, 4, 2, 2, 2, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 4, 1, 1, 1, 1, 1, 1, 1,
+    1, 4, 4, 4, 1, 1, 1, 1, 1, 1, 1, 1, 4, 4, 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 4, 0, 0, 0, 4, 0, 0, 3,
+  };
+
+  // Word layer per slot (slot = minute of day / 5), bit i of byte i / 8 = LED i
+  constexpr uint8_t WORDS[SLOTS][FRAME_BYTES] = {
+    {0x00, 0xEE, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 00:00 ES IST UHR ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 00:05 ES IST FÜNF NACH ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 00:10 ES IST ZEHN NACH ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 00:15 ES IST VIERTEL NACH ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 00:20 ES IST ZWANZIG NACH ZWÖLF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 00:25 ES IST FÜNF VOR HALB EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 00:30 ES IST HALB EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 00:35 ES IST FÜNF NACH HALB EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 00:40 ES IST ZWANZIG VOR EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 00:45 ES IST VIERTEL VOR EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 00:50 ES IST ZEHN VOR EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 00:55 ES IST FÜNF VOR EINS
+    {0x00, 0x0E, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 01:00 ES IST UHR EIN
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 01:05 ES IST FÜNF NACH EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 01:10 ES IST ZEHN NACH EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 01:15 ES IST VIERTEL NACH EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 01:20 ES IST ZWANZIG NACH EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 01:25 ES IST FÜNF VOR HALB ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 01:30 ES IST HALB ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 01:35 ES IST FÜNF NACH HALB ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 01:40 ES IST ZWANZIG VOR ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 01:45 ES IST VIERTEL VOR ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 01:50 ES IST ZEHN VOR ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 01:55 ES IST FÜNF VOR ZWEI
+    {0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 02:00 ES IST UHR ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 02:05 ES IST FÜNF NACH ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 02:10 ES IST ZEHN NACH ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 02:15 ES IST VIERTEL NACH ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 02:20 ES IST ZWANZIG NACH ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 02:25 ES IST FÜNF VOR HALB DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 02:30 ES IST HALB DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 02:35 ES IST FÜNF NACH HALB DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 02:40 ES IST ZWANZIG VOR DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 02:45 ES IST VIERTEL VOR DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 02:50 ES IST ZEHN VOR DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 02:55 ES IST FÜNF VOR DREI
+    {0x00, 0x0E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 03:00 ES IST UHR DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 03:05 ES IST FÜNF NACH DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 03:10 ES IST ZEHN NACH DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 03:15 ES IST VIERTEL NACH DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 03:20 ES IST ZWANZIG NACH DREI
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 03:25 ES IST FÜNF VOR HALB VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 03:30 ES IST HALB VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 03:35 ES IST FÜNF NACH HALB VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 03:40 ES IST ZWANZIG VOR VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 03:45 ES IST VIERTEL VOR VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 03:50 ES IST ZEHN VOR VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 03:55 ES IST FÜNF VOR VIER
+    {0x00, 0x0E, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 04:00 ES IST UHR VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 04:05 ES IST FÜNF NACH VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 04:10 ES IST ZEHN NACH VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 04:15 ES IST VIERTEL NACH VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 04:20 ES IST ZWANZIG NACH VIER
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 04:25 ES IST FÜNF VOR HALB FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 04:30 ES IST HALB FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 04:35 ES IST FÜNF NACH HALB FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 04:40 ES IST ZWANZIG VOR FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 04:45 ES IST VIERTEL VOR FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 04:50 ES IST ZEHN VOR FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 04:55 ES IST FÜNF VOR FÜNF
+    {0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 05:00 ES IST UHR FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 05:05 ES IST FÜNF NACH FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 05:10 ES IST ZEHN NACH FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 05:15 ES IST VIERTEL NACH FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 05:20 ES IST ZWANZIG NACH FÜNF
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 05:25 ES IST FÜNF VOR HALB SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 05:30 ES IST HALB SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 05:35 ES IST FÜNF NACH HALB SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 05:40 ES IST ZWANZIG VOR SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 05:45 ES IST VIERTEL VOR SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 05:50 ES IST ZEHN VOR SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 05:55 ES IST FÜNF VOR SECHS
+    {0x00, 0x0E, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 06:00 ES IST UHR SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 06:05 ES IST FÜNF NACH SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 06:10 ES IST ZEHN NACH SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 06:15 ES IST VIERTEL NACH SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 06:20 ES IST ZWANZIG NACH SECHS
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 06:25 ES IST FÜNF VOR HALB SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 06:30 ES IST HALB SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 06:35 ES IST FÜNF NACH HALB SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 06:40 ES IST ZWANZIG VOR SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 06:45 ES IST VIERTEL VOR SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 06:50 ES IST ZEHN VOR SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 06:55 ES IST FÜNF VOR SIEBEN
+    {0x00, 0x0E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 07:00 ES IST UHR SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 07:05 ES IST FÜNF NACH SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 07:10 ES IST ZEHN NACH SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 07:15 ES IST VIERTEL NACH SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 07:20 ES IST ZWANZIG NACH SIEBEN
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 07:25 ES IST FÜNF VOR HALB ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 07:30 ES IST HALB ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 07:35 ES IST FÜNF NACH HALB ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 07:40 ES IST ZWANZIG VOR ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 07:45 ES IST VIERTEL VOR ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 07:50 ES IST ZEHN VOR ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 07:55 ES IST FÜNF VOR ACHT
+    {0x00, 0x0E, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 08:00 ES IST UHR ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 08:05 ES IST FÜNF NACH ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 08:10 ES IST ZEHN NACH ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 08:15 ES IST VIERTEL NACH ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 08:20 ES IST ZWANZIG NACH ACHT
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 08:25 ES IST FÜNF VOR HALB NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 08:30 ES IST HALB NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 08:35 ES IST FÜNF NACH HALB NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 08:40 ES IST ZWANZIG VOR NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 08:45 ES IST VIERTEL VOR NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 08:50 ES IST ZEHN VOR NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 08:55 ES IST FÜNF VOR NEUN
+    {0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 09:00 ES IST UHR NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 09:05 ES IST FÜNF NACH NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 09:10 ES IST ZEHN NACH NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 09:15 ES IST VIERTEL NACH NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 09:20 ES IST ZWANZIG NACH NEUN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 09:25 ES IST FÜNF VOR HALB ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 09:30 ES IST HALB ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 09:35 ES IST FÜNF NACH HALB ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 09:40 ES IST ZWANZIG VOR ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 09:45 ES IST VIERTEL VOR ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 09:50 ES IST ZEHN VOR ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 09:55 ES IST FÜNF VOR ZEHN
+    {0x1E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 10:00 ES IST UHR ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 10:05 ES IST FÜNF NACH ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 10:10 ES IST ZEHN NACH ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 10:15 ES IST VIERTEL NACH ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 10:20 ES IST ZWANZIG NACH ZEHN
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 10:25 ES IST FÜNF VOR HALB ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 10:30 ES IST HALB ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 10:35 ES IST FÜNF NACH HALB ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 10:40 ES IST ZWANZIG VOR ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 10:45 ES IST VIERTEL VOR ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 10:50 ES IST ZEHN VOR ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 10:55 ES IST FÜNF VOR ELF
+    {0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 11:00 ES IST UHR ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 11:05 ES IST FÜNF NACH ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 11:10 ES IST ZEHN NACH ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 11:15 ES IST VIERTEL NACH ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 11:20 ES IST ZWANZIG NACH ELF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 11:25 ES IST FÜNF VOR HALB ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 11:30 ES IST HALB ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 11:35 ES IST FÜNF NACH HALB ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 11:40 ES IST ZWANZIG VOR ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 11:45 ES IST VIERTEL VOR ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 11:50 ES IST ZEHN VOR ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 11:55 ES IST FÜNF VOR ZWÖLF
+    {0x00, 0xEE, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 12:00 ES IST UHR ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 12:05 ES IST FÜNF NACH ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 12:10 ES IST ZEHN NACH ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 12:15 ES IST VIERTEL NACH ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 12:20 ES IST ZWANZIG NACH ZWÖLF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 12:25 ES IST FÜNF VOR HALB EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 12:30 ES IST HALB EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 12:35 ES IST FÜNF NACH HALB EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 12:40 ES IST ZWANZIG VOR EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 12:45 ES IST VIERTEL VOR EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 12:50 ES IST ZEHN VOR EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 12:55 ES IST FÜNF VOR EINS
+    {0x00, 0x0E, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 13:00 ES IST UHR EIN
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 13:05 ES IST FÜNF NACH EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 13:10 ES IST ZEHN NACH EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 13:15 ES IST VIERTEL NACH EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 13:20 ES IST ZWANZIG NACH EINS
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 13:25 ES IST FÜNF VOR HALB ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 13:30 ES IST HALB ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 13:35 ES IST FÜNF NACH HALB ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 13:40 ES IST ZWANZIG VOR ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 13:45 ES IST VIERTEL VOR ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 13:50 ES IST ZEHN VOR ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 13:55 ES IST FÜNF VOR ZWEI
+    {0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 14:00 ES IST UHR ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 14:05 ES IST FÜNF NACH ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 14:10 ES IST ZEHN NACH ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 14:15 ES IST VIERTEL NACH ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 14:20 ES IST ZWANZIG NACH ZWEI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 14:25 ES IST FÜNF VOR HALB DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 14:30 ES IST HALB DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 14:35 ES IST FÜNF NACH HALB DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 14:40 ES IST ZWANZIG VOR DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 14:45 ES IST VIERTEL VOR DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 14:50 ES IST ZEHN VOR DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 14:55 ES IST FÜNF VOR DREI
+    {0x00, 0x0E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 15:00 ES IST UHR DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 15:05 ES IST FÜNF NACH DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 15:10 ES IST ZEHN NACH DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 15:15 ES IST VIERTEL NACH DREI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 15:20 ES IST ZWANZIG NACH DREI
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 15:25 ES IST FÜNF VOR HALB VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 15:30 ES IST HALB VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 15:35 ES IST FÜNF NACH HALB VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 15:40 ES IST ZWANZIG VOR VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 15:45 ES IST VIERTEL VOR VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 15:50 ES IST ZEHN VOR VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 15:55 ES IST FÜNF VOR VIER
+    {0x00, 0x0E, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 16:00 ES IST UHR VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 16:05 ES IST FÜNF NACH VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 16:10 ES IST ZEHN NACH VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 16:15 ES IST VIERTEL NACH VIER
+    {0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 16:20 ES IST ZWANZIG NACH VIER
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 16:25 ES IST FÜNF VOR HALB FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 16:30 ES IST HALB FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 16:35 ES IST FÜNF NACH HALB FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 16:40 ES IST ZWANZIG VOR FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 16:45 ES IST VIERTEL VOR FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 16:50 ES IST ZEHN VOR FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 16:55 ES IST FÜNF VOR FÜNF
+    {0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 17:00 ES IST UHR FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 17:05 ES IST FÜNF NACH FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 17:10 ES IST ZEHN NACH FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 17:15 ES IST VIERTEL NACH FÜNF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 17:20 ES IST ZWANZIG NACH FÜNF
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 17:25 ES IST FÜNF VOR HALB SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 17:30 ES IST HALB SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 17:35 ES IST FÜNF NACH HALB SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 17:40 ES IST ZWANZIG VOR SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 17:45 ES IST VIERTEL VOR SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 17:50 ES IST ZEHN VOR SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 17:55 ES IST FÜNF VOR SECHS
+    {0x00, 0x0E, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 18:00 ES IST UHR SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 18:05 ES IST FÜNF NACH SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 18:10 ES IST ZEHN NACH SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 18:15 ES IST VIERTEL NACH SECHS
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 18:20 ES IST ZWANZIG NACH SECHS
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 18:25 ES IST FÜNF VOR HALB SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 18:30 ES IST HALB SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 18:35 ES IST FÜNF NACH HALB SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 18:40 ES IST ZWANZIG VOR SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 18:45 ES IST VIERTEL VOR SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 18:50 ES IST ZEHN VOR SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 18:55 ES IST FÜNF VOR SIEBEN
+    {0x00, 0x0E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 19:00 ES IST UHR SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 19:05 ES IST FÜNF NACH SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 19:10 ES IST ZEHN NACH SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 19:15 ES IST VIERTEL NACH SIEBEN
+    {0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 19:20 ES IST ZWANZIG NACH SIEBEN
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 19:25 ES IST FÜNF VOR HALB ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 19:30 ES IST HALB ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 19:35 ES IST FÜNF NACH HALB ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 19:40 ES IST ZWANZIG VOR ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 19:45 ES IST VIERTEL VOR ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 19:50 ES IST ZEHN VOR ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 19:55 ES IST FÜNF VOR ACHT
+    {0x00, 0x0E, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 20:00 ES IST UHR ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 20:05 ES IST FÜNF NACH ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 20:10 ES IST ZEHN NACH ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 20:15 ES IST VIERTEL NACH ACHT
+    {0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 20:20 ES IST ZWANZIG NACH ACHT
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 20:25 ES IST FÜNF VOR HALB NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 20:30 ES IST HALB NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 20:35 ES IST FÜNF NACH HALB NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 20:40 ES IST ZWANZIG VOR NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 20:45 ES IST VIERTEL VOR NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 20:50 ES IST ZEHN VOR NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 20:55 ES IST FÜNF VOR NEUN
+    {0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 21:00 ES IST UHR NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 21:05 ES IST FÜNF NACH NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 21:10 ES IST ZEHN NACH NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 21:15 ES IST VIERTEL NACH NEUN
+    {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 21:20 ES IST ZWANZIG NACH NEUN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 21:25 ES IST FÜNF VOR HALB ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 21:30 ES IST HALB ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 21:35 ES IST FÜNF NACH HALB ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 21:40 ES IST ZWANZIG VOR ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 21:45 ES IST VIERTEL VOR ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 21:50 ES IST ZEHN VOR ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 21:55 ES IST FÜNF VOR ZEHN
+    {0x1E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 22:00 ES IST UHR ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 22:05 ES IST FÜNF NACH ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 22:10 ES IST ZEHN NACH ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 22:15 ES IST VIERTEL NACH ZEHN
+    {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 22:20 ES IST ZWANZIG NACH ZEHN
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 22:25 ES IST FÜNF VOR HALB ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 22:30 ES IST HALB ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 22:35 ES IST FÜNF NACH HALB ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 22:40 ES IST ZWANZIG VOR ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 22:45 ES IST VIERTEL VOR ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 22:50 ES IST ZEHN VOR ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 22:55 ES IST FÜNF VOR ELF
+    {0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 23:00 ES IST UHR ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 23:05 ES IST FÜNF NACH ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 23:10 ES IST ZEHN NACH ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 23:15 ES IST VIERTEL NACH ELF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x78, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 23:20 ES IST ZWANZIG NACH ELF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 23:25 ES IST FÜNF VOR HALB ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 23:30 ES IST HALB ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 23:35 ES IST FÜNF NACH HALB ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x1F, 0xB8, 0x01}, // 23:40 ES IST ZWANZIG VOR ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x80, 0x3F, 0x00, 0x00, 0xB8, 0x01}, // 23:45 ES IST VIERTEL VOR ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x01}, // 23:50 ES IST ZEHN VOR ZWÖLF
+    {0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 23:55 ES IST FÜNF VOR ZWÖLF
+  };
+}
@@ -0,0 +1,345 @@
+// Generated by tools/wordclock.py from tools/wordclock/en.clock - do not edit.
+#pragma once
+#include <stdint.h>
+
+// Grid:
+//   o...........o
+//   .ITLISASAMPM.
+//   .ACQUARTERDC.
+//   .TWENTYFIVEX.
+//   .HALFSTENFTO.
+//   .PASTERUNINE.
+//   .ONESIXTHREE.
+//   .FOURFIVETWO.
+//   .EIGHTELEVEN.
+//   .SEVENTWELVE.
+//   .TENSEOCLOCK.
+//   o...........o
+namespace WordClock {
+  constexpr const char* LANG = "en";
+  constexpr uint8_t ROWS = 12;
+  constexpr uint8_t COLS = 13;
+  constexpr uint16_t LED_COUNT = 114;
+  constexpr uint8_t NO_LED = 0xFF;
+  constexpr uint8_t FRAME_BYTES = 15;
+  constexpr uint16_t SLOTS = 288; // five-minute slots per day
+
+  // Strip index of each cell, NO_LED where the panel has none
+  constexpr uint8_t LED_AT[ROWS][COLS] = {
+    {113, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, 101},
+    {NO_LED, 112, 111, 110, 109, 108, 107, 106, 105, 104, 103, 102, NO_LED},
+    {NO_LED, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, NO_LED},
+    {NO_LED, 89, 88, 87, 86, 85, 84, 83, 82, 81, 80, 79, NO_LED},
+    {NO_LED, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, NO_LED},
+    {NO_LED, 67, 66, 65, 64, 63, 62, 61, 60, 59, 58, 57, NO_LED},
+    {NO_LED, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, NO_LED},
+    {NO_LED, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, NO_LED},
+    {NO_LED, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, NO_LED},
+    {NO_LED, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, NO_LED},
+    {NO_LED, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, NO_LED},
+    {0, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, 12},
+  };
+
+  // Minute dots in lighting order: minute % 5 == k lights the first k
+  constexpr uint8_t DOT_COUNT = 4;
+  constexpr uint8_t DOTS[DOT_COUNT + 1] = {101, 12, 0, 113, NO_LED};
+
+  // Word group of each LED: 0 prefix, 1 hour, 2 minute, 3 dot, 4 never lit
+  constexpr uint8_t LED_GROUP[LED_COUNT] = {
+    3, 1, 1, 1, 4, 4, 2, 2, 2, 2, 2, 2, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2,
+    4, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2, 4, 4, 3, 4, 4, 4, 4, 4, 4, 0, 0, 4, 0, 0, 3,
+  };
+
+  // Word layer per slot (slot = minute of day / 5), bit i of byte i / 8 = LED i
+  constexpr uint8_t WORDS[SLOTS][FRAME_BYTES] = {
+    {0xC0, 0xEF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 00:00 IT IS OCLOCK TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 00:05 IT IS FIVE PAST TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 00:10 IT IS TEN PAST TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 00:15 IT IS A QUARTER PAST TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 00:20 IT IS TWENTY PAST TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 00:25 IT IS TWENTY FIVE PAST TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 00:30 IT IS HALF PAST TWELVE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 00:35 IT IS TWENTY FIVE TO ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 00:40 IT IS TWENTY TO ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 00:45 IT IS A QUARTER TO ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 00:50 IT IS TEN TO ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 00:55 IT IS FIVE TO ONE
+    {0xC0, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 01:00 IT IS OCLOCK ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 01:05 IT IS FIVE PAST ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 01:10 IT IS TEN PAST ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 01:15 IT IS A QUARTER PAST ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 01:20 IT IS TWENTY PAST ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 01:25 IT IS TWENTY FIVE PAST ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 01:30 IT IS HALF PAST ONE
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 01:35 IT IS TWENTY FIVE TO TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 01:40 IT IS TWENTY TO TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 01:45 IT IS A QUARTER TO TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 01:50 IT IS TEN TO TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 01:55 IT IS FIVE TO TWO
+    {0xC0, 0x0F, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 02:00 IT IS OCLOCK TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 02:05 IT IS FIVE PAST TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 02:10 IT IS TEN PAST TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 02:15 IT IS A QUARTER PAST TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 02:20 IT IS TWENTY PAST TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 02:25 IT IS TWENTY FIVE PAST TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 02:30 IT IS HALF PAST TWO
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 02:35 IT IS TWENTY FIVE TO THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 02:40 IT IS TWENTY TO THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 02:45 IT IS A QUARTER TO THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 02:50 IT IS TEN TO THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 02:55 IT IS FIVE TO THREE
+    {0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 03:00 IT IS OCLOCK THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 03:05 IT IS FIVE PAST THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 03:10 IT IS TEN PAST THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 03:15 IT IS A QUARTER PAST THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 03:20 IT IS TWENTY PAST THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 03:25 IT IS TWENTY FIVE PAST THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 03:30 IT IS HALF PAST THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 03:35 IT IS TWENTY FIVE TO FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 03:40 IT IS TWENTY TO FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 03:45 IT IS A QUARTER TO FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 03:50 IT IS TEN TO FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 03:55 IT IS FIVE TO FOUR
+    {0xC0, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 04:00 IT IS OCLOCK FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 04:05 IT IS FIVE PAST FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 04:10 IT IS TEN PAST FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 04:15 IT IS A QUARTER PAST FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 04:20 IT IS TWENTY PAST FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 04:25 IT IS TWENTY FIVE PAST FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 04:30 IT IS HALF PAST FOUR
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 04:35 IT IS TWENTY FIVE TO FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 04:40 IT IS TWENTY TO FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 04:45 IT IS A QUARTER TO FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 04:50 IT IS TEN TO FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 04:55 IT IS FIVE TO FIVE
+    {0xC0, 0x0F, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 05:00 IT IS OCLOCK FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 05:05 IT IS FIVE PAST FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 05:10 IT IS TEN PAST FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 05:15 IT IS A QUARTER PAST FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 05:20 IT IS TWENTY PAST FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 05:25 IT IS TWENTY FIVE PAST FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 05:30 IT IS HALF PAST FIVE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 05:35 IT IS TWENTY FIVE TO SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 05:40 IT IS TWENTY TO SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 05:45 IT IS A QUARTER TO SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 05:50 IT IS TEN TO SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 05:55 IT IS FIVE TO SIX
+    {0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 06:00 IT IS OCLOCK SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 06:05 IT IS FIVE PAST SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 06:10 IT IS TEN PAST SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 06:15 IT IS A QUARTER PAST SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 06:20 IT IS TWENTY PAST SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 06:25 IT IS TWENTY FIVE PAST SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 06:30 IT IS HALF PAST SIX
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 06:35 IT IS TWENTY FIVE TO SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 06:40 IT IS TWENTY TO SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 06:45 IT IS A QUARTER TO SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 06:50 IT IS TEN TO SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 06:55 IT IS FIVE TO SEVEN
+    {0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 07:00 IT IS OCLOCK SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 07:05 IT IS FIVE PAST SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 07:10 IT IS TEN PAST SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 07:15 IT IS A QUARTER PAST SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 07:20 IT IS TWENTY PAST SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 07:25 IT IS TWENTY FIVE PAST SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 07:30 IT IS HALF PAST SEVEN
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 07:35 IT IS TWENTY FIVE TO EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 07:40 IT IS TWENTY TO EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 07:45 IT IS A QUARTER TO EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 07:50 IT IS TEN TO EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 07:55 IT IS FIVE TO EIGHT
+    {0xC0, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 08:00 IT IS OCLOCK EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 08:05 IT IS FIVE PAST EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 08:10 IT IS TEN PAST EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 08:15 IT IS A QUARTER PAST EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 08:20 IT IS TWENTY PAST EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 08:25 IT IS TWENTY FIVE PAST EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 08:30 IT IS HALF PAST EIGHT
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 08:35 IT IS TWENTY FIVE TO NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 08:40 IT IS TWENTY TO NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 08:45 IT IS A QUARTER TO NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 08:50 IT IS TEN TO NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 08:55 IT IS FIVE TO NINE
+    {0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 09:00 IT IS OCLOCK NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 09:05 IT IS FIVE PAST NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 09:10 IT IS TEN PAST NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 09:15 IT IS A QUARTER PAST NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 09:20 IT IS TWENTY PAST NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 09:25 IT IS TWENTY FIVE PAST NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 09:30 IT IS HALF PAST NINE
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 09:35 IT IS TWENTY FIVE TO TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 09:40 IT IS TWENTY TO TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 09:45 IT IS A QUARTER TO TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 09:50 IT IS TEN TO TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 09:55 IT IS FIVE TO TEN
+    {0xCE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 10:00 IT IS OCLOCK TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 10:05 IT IS FIVE PAST TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 10:10 IT IS TEN PAST TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 10:15 IT IS A QUARTER PAST TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 10:20 IT IS TWENTY PAST TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 10:25 IT IS TWENTY FIVE PAST TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 10:30 IT IS HALF PAST TEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 10:35 IT IS TWENTY FIVE TO ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 10:40 IT IS TWENTY TO ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 10:45 IT IS A QUARTER TO ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 10:50 IT IS TEN TO ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 10:55 IT IS FIVE TO ELEVEN
+    {0xC0, 0x0F, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 11:00 IT IS OCLOCK ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 11:05 IT IS FIVE PAST ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 11:10 IT IS TEN PAST ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 11:15 IT IS A QUARTER PAST ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 11:20 IT IS TWENTY PAST ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 11:25 IT IS TWENTY FIVE PAST ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 11:30 IT IS HALF PAST ELEVEN
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 11:35 IT IS TWENTY FIVE TO TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 11:40 IT IS TWENTY TO TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 11:45 IT IS A QUARTER TO TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 11:50 IT IS TEN TO TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 11:55 IT IS FIVE TO TWELVE
+    {0xC0, 0xEF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 12:00 IT IS OCLOCK TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 12:05 IT IS FIVE PAST TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 12:10 IT IS TEN PAST TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 12:15 IT IS A QUARTER PAST TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 12:20 IT IS TWENTY PAST TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 12:25 IT IS TWENTY FIVE PAST TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 12:30 IT IS HALF PAST TWELVE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 12:35 IT IS TWENTY FIVE TO ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 12:40 IT IS TWENTY TO ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 12:45 IT IS A QUARTER TO ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 12:50 IT IS TEN TO ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 12:55 IT IS FIVE TO ONE
+    {0xC0, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 13:00 IT IS OCLOCK ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 13:05 IT IS FIVE PAST ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 13:10 IT IS TEN PAST ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 13:15 IT IS A QUARTER PAST ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 13:20 IT IS TWENTY PAST ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 13:25 IT IS TWENTY FIVE PAST ONE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 13:30 IT IS HALF PAST ONE
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 13:35 IT IS TWENTY FIVE TO TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 13:40 IT IS TWENTY TO TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 13:45 IT IS A QUARTER TO TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 13:50 IT IS TEN TO TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 13:55 IT IS FIVE TO TWO
+    {0xC0, 0x0F, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 14:00 IT IS OCLOCK TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 14:05 IT IS FIVE PAST TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 14:10 IT IS TEN PAST TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 14:15 IT IS A QUARTER PAST TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 14:20 IT IS TWENTY PAST TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 14:25 IT IS TWENTY FIVE PAST TWO
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 14:30 IT IS HALF PAST TWO
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 14:35 IT IS TWENTY FIVE TO THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 14:40 IT IS TWENTY TO THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 14:45 IT IS A QUARTER TO THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 14:50 IT IS TEN TO THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 14:55 IT IS FIVE TO THREE
+    {0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 15:00 IT IS OCLOCK THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 15:05 IT IS FIVE PAST THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 15:10 IT IS TEN PAST THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 15:15 IT IS A QUARTER PAST THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 15:20 IT IS TWENTY PAST THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 15:25 IT IS TWENTY FIVE PAST THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 15:30 IT IS HALF PAST THREE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 15:35 IT IS TWENTY FIVE TO FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 15:40 IT IS TWENTY TO FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 15:45 IT IS A QUARTER TO FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 15:50 IT IS TEN TO FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 15:55 IT IS FIVE TO FOUR
+    {0xC0, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 16:00 IT IS OCLOCK FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 16:05 IT IS FIVE PAST FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 16:10 IT IS TEN PAST FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 16:15 IT IS A QUARTER PAST FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 16:20 IT IS TWENTY PAST FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 16:25 IT IS TWENTY FIVE PAST FOUR
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 16:30 IT IS HALF PAST FOUR
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 16:35 IT IS TWENTY FIVE TO FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 16:40 IT IS TWENTY TO FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 16:45 IT IS A QUARTER TO FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 16:50 IT IS TEN TO FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 16:55 IT IS FIVE TO FIVE
+    {0xC0, 0x0F, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 17:00 IT IS OCLOCK FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 17:05 IT IS FIVE PAST FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 17:10 IT IS TEN PAST FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 17:15 IT IS A QUARTER PAST FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 17:20 IT IS TWENTY PAST FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 17:25 IT IS TWENTY FIVE PAST FIVE
+    {0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 17:30 IT IS HALF PAST FIVE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 17:35 IT IS TWENTY FIVE TO SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 17:40 IT IS TWENTY TO SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 17:45 IT IS A QUARTER TO SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 17:50 IT IS TEN TO SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 17:55 IT IS FIVE TO SIX
+    {0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 18:00 IT IS OCLOCK SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 18:05 IT IS FIVE PAST SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 18:10 IT IS TEN PAST SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 18:15 IT IS A QUARTER PAST SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 18:20 IT IS TWENTY PAST SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 18:25 IT IS TWENTY FIVE PAST SIX
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 18:30 IT IS HALF PAST SIX
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 18:35 IT IS TWENTY FIVE TO SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 18:40 IT IS TWENTY TO SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 18:45 IT IS A QUARTER TO SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 18:50 IT IS TEN TO SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 18:55 IT IS FIVE TO SEVEN
+    {0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 19:00 IT IS OCLOCK SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 19:05 IT IS FIVE PAST SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 19:10 IT IS TEN PAST SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 19:15 IT IS A QUARTER PAST SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 19:20 IT IS TWENTY PAST SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 19:25 IT IS TWENTY FIVE PAST SEVEN
+    {0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 19:30 IT IS HALF PAST SEVEN
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 19:35 IT IS TWENTY FIVE TO EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 19:40 IT IS TWENTY TO EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 19:45 IT IS A QUARTER TO EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 19:50 IT IS TEN TO EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 19:55 IT IS FIVE TO EIGHT
+    {0xC0, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 20:00 IT IS OCLOCK EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 20:05 IT IS FIVE PAST EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 20:10 IT IS TEN PAST EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 20:15 IT IS A QUARTER PAST EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 20:20 IT IS TWENTY PAST EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 20:25 IT IS TWENTY FIVE PAST EIGHT
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 20:30 IT IS HALF PAST EIGHT
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 20:35 IT IS TWENTY FIVE TO NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 20:40 IT IS TWENTY TO NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 20:45 IT IS A QUARTER TO NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 20:50 IT IS TEN TO NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 20:55 IT IS FIVE TO NINE
+    {0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 21:00 IT IS OCLOCK NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 21:05 IT IS FIVE PAST NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 21:10 IT IS TEN PAST NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 21:15 IT IS A QUARTER PAST NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 21:20 IT IS TWENTY PAST NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 21:25 IT IS TWENTY FIVE PAST NINE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 21:30 IT IS HALF PAST NINE
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 21:35 IT IS TWENTY FIVE TO TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 21:40 IT IS TWENTY TO TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 21:45 IT IS A QUARTER TO TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 21:50 IT IS TEN TO TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 21:55 IT IS FIVE TO TEN
+    {0xCE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 22:00 IT IS OCLOCK TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 22:05 IT IS FIVE PAST TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 22:10 IT IS TEN PAST TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 22:15 IT IS A QUARTER PAST TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 22:20 IT IS TWENTY PAST TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 22:25 IT IS TWENTY FIVE PAST TEN
+    {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 22:30 IT IS HALF PAST TEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 22:35 IT IS TWENTY FIVE TO ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 22:40 IT IS TWENTY TO ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 22:45 IT IS A QUARTER TO ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 22:50 IT IS TEN TO ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 22:55 IT IS FIVE TO ELEVEN
+    {0xC0, 0x0F, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 23:00 IT IS OCLOCK ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 23:05 IT IS FIVE PAST ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 23:10 IT IS TEN PAST ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 23:15 IT IS A QUARTER PAST ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 23:20 IT IS TWENTY PAST ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 23:25 IT IS TWENTY FIVE PAST ELEVEN
+    {0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 23:30 IT IS HALF PAST ELEVEN
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0xB0, 0x01}, // 23:35 IT IS TWENTY FIVE TO TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x03, 0x00, 0xB0, 0x01}, // 23:40 IT IS TWENTY TO TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF4, 0x07, 0xB0, 0x01}, // 23:45 IT IS A QUARTER TO TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xB0, 0x01}, // 23:50 IT IS TEN TO TWELVE
+    {0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0F, 0x00, 0x00, 0xB0, 0x01}, // 23:55 IT IS FIVE TO TWELVE
+  };
+}
@@ -0,0 +1,345 @@
+// Generated by tools/wordclock.py from tools/wordclock/fr.clock - do not edit.
+#pragma once
+#include <stdint.h>
+
+// Grid:
+//   o...........o
+//   .ILNESTOCINQ.
+//   .QUATRETROIS.
+//   .NEUFMADSEPT.
+//   .UNEMINUITAE.
+//   .ONZEDEUXXLP.
+//   .HUITIHEURES.
+//   .MOINSOLEDIX.
+//   .ETRQUARTPMD.
+//   .UVINGT-CINQ.
+//   .ETSDEMIEPAM.
+//   o...........o
+namespace WordClock {
+  constexpr const char* LANG = "fr";
+  constexpr uint8_t ROWS = 12;
+  constexpr uint8_t COLS = 13;
+  constexpr uint16_t LED_COUNT = 114;
+  constexpr uint8_t NO_LED = 0xFF;
+  constexpr uint8_t FRAME_BYTES = 15;
+  constexpr uint16_t SLOTS = 288; // five-minute slots per day
+
+  // Strip index of each cell, NO_LED where the panel has none
+  constexpr uint8_t LED_AT[ROWS][COLS] = {
+    {113, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, 101},
+    {NO_LED, 112, 111, 110, 109, 108, 107, 106, 105, 104, 103, 102, NO_LED},
+    {NO_LED, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, NO_LED},
+    {NO_LED, 89, 88, 87, 86, 85, 84, 83, 82, 81, 80, 79, NO_LED},
+    {NO_LED, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, NO_LED},
+    {NO_LED, 67, 66, 65, 64, 63, 62, 61, 60, 59, 58, 57, NO_LED},
+    {NO_LED, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, NO_LED},
+    {NO_LED, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, NO_LED},
+    {NO_LED, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, NO_LED},
+    {NO_LED, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, NO_LED},
+    {NO_LED, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, NO_LED},
+    {0, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, 12},
+  };
+
+  // Minute dots in lighting order: minute % 5 == k lights the first k
+  constexpr uint8_t DOT_COUNT = 4;
+  constexpr uint8_t DOTS[DOT_COUNT + 1] = {101, 12, 0, 113, NO_LED};
+
+  // Word group of each LED: 0 prefix, 1 hour, 2 minute, 3 dot, 4 never lit
+  constexpr uint8_t LED_GROUP[LED_COUNT] = {
+    3, 2, 2, 4, 2, 2, 2, 2, 2, 4, 4, 4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 4, 2, 2, 2, 2, 2, 4, 4, 4, 2, 2, 2,
+    2, 2, 4, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 4, 4, 1, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 4, 0, 0, 0, 4, 0, 0, 3,
+  };
+
+  // Word layer per slot (slot = minute of day / 5), bit i of byte i / 8 = LED i
+  constexpr uint8_t WORDS[SLOTS][FRAME_BYTES] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 00:00 IL EST MINUIT
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 00:05 IL EST CINQ MINUIT
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 00:10 IL EST DIX MINUIT
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 00:15 IL EST ET QUART MINUIT
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 00:20 IL EST VINGT MINUIT
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 00:25 IL EST VINGT - CINQ MINUIT
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 00:30 IL EST ET DEMIE MINUIT
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 00:35 IL EST MOINS VINGT - CINQ UNE HEURE
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 00:40 IL EST MOINS VINGT UNE HEURE
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 00:45 IL EST MOINS LE QUART UNE HEURE
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 00:50 IL EST MOINS DIX UNE HEURE
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 00:55 IL EST MOINS CINQ UNE HEURE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 01:00 IL EST UNE HEURE
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 01:05 IL EST CINQ UNE HEURE
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 01:10 IL EST DIX UNE HEURE
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 01:15 IL EST ET QUART UNE HEURE
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 01:20 IL EST VINGT UNE HEURE
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 01:25 IL EST VINGT - CINQ UNE HEURE
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 01:30 IL EST ET DEMIE UNE HEURE
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 01:35 IL EST MOINS VINGT - CINQ DEUX HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 01:40 IL EST MOINS VINGT DEUX HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 01:45 IL EST MOINS LE QUART DEUX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 01:50 IL EST MOINS DIX DEUX HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 01:55 IL EST MOINS CINQ DEUX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 02:00 IL EST DEUX HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 02:05 IL EST CINQ DEUX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 02:10 IL EST DIX DEUX HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 02:15 IL EST ET QUART DEUX HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 02:20 IL EST VINGT DEUX HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 02:25 IL EST VINGT - CINQ DEUX HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 02:30 IL EST ET DEMIE DEUX HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 02:35 IL EST MOINS VINGT - CINQ TROIS HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 02:40 IL EST MOINS VINGT TROIS HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 02:45 IL EST MOINS LE QUART TROIS HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 02:50 IL EST MOINS DIX TROIS HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 02:55 IL EST MOINS CINQ TROIS HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 03:00 IL EST TROIS HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 03:05 IL EST CINQ TROIS HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 03:10 IL EST DIX TROIS HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 03:15 IL EST ET QUART TROIS HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 03:20 IL EST VINGT TROIS HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 03:25 IL EST VINGT - CINQ TROIS HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 03:30 IL EST ET DEMIE TROIS HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 03:35 IL EST MOINS VINGT - CINQ QUATRE HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 03:40 IL EST MOINS VINGT QUATRE HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 03:45 IL EST MOINS LE QUART QUATRE HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 03:50 IL EST MOINS DIX QUATRE HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 03:55 IL EST MOINS CINQ QUATRE HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 04:00 IL EST QUATRE HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 04:05 IL EST CINQ QUATRE HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 04:10 IL EST DIX QUATRE HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 04:15 IL EST ET QUART QUATRE HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 04:20 IL EST VINGT QUATRE HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 04:25 IL EST VINGT - CINQ QUATRE HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 04:30 IL EST ET DEMIE QUATRE HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 04:35 IL EST MOINS VINGT - CINQ CINQ HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 04:40 IL EST MOINS VINGT CINQ HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 04:45 IL EST MOINS LE QUART CINQ HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 04:50 IL EST MOINS DIX CINQ HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 04:55 IL EST MOINS CINQ CINQ HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 05:00 IL EST CINQ HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 05:05 IL EST CINQ CINQ HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 05:10 IL EST DIX CINQ HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 05:15 IL EST ET QUART CINQ HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 05:20 IL EST VINGT CINQ HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 05:25 IL EST VINGT - CINQ CINQ HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 05:30 IL EST ET DEMIE CINQ HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 05:35 IL EST MOINS VINGT - CINQ SIX HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 05:40 IL EST MOINS VINGT SIX HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 05:45 IL EST MOINS LE QUART SIX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 05:50 IL EST MOINS DIX SIX HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 05:55 IL EST MOINS CINQ SIX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 06:00 IL EST SIX HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 06:05 IL EST CINQ SIX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 06:10 IL EST DIX SIX HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 06:15 IL EST ET QUART SIX HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 06:20 IL EST VINGT SIX HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 06:25 IL EST VINGT - CINQ SIX HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 06:30 IL EST ET DEMIE SIX HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 06:35 IL EST MOINS VINGT - CINQ SEPT HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 06:40 IL EST MOINS VINGT SEPT HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 06:45 IL EST MOINS LE QUART SEPT HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 06:50 IL EST MOINS DIX SEPT HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 06:55 IL EST MOINS CINQ SEPT HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 07:00 IL EST SEPT HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 07:05 IL EST CINQ SEPT HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 07:10 IL EST DIX SEPT HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 07:15 IL EST ET QUART SEPT HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 07:20 IL EST VINGT SEPT HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 07:25 IL EST VINGT - CINQ SEPT HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 07:30 IL EST ET DEMIE SEPT HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0xFE, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 07:35 IL EST MOINS VINGT - CINQ HUIT HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0xFE, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 07:40 IL EST MOINS VINGT HUIT HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0xFE, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 07:45 IL EST MOINS LE QUART HUIT HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0xFE, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 07:50 IL EST MOINS DIX HUIT HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0xFE, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 07:55 IL EST MOINS CINQ HUIT HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 08:00 IL EST HUIT HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0xC0, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 08:05 IL EST CINQ HUIT HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0xC0, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 08:10 IL EST DIX HUIT HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0xC0, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 08:15 IL EST ET QUART HUIT HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0xC0, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 08:20 IL EST VINGT HUIT HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0xC0, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 08:25 IL EST VINGT - CINQ HUIT HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0xC0, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 08:30 IL EST ET DEMIE HUIT HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 08:35 IL EST MOINS VINGT - CINQ NEUF HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 08:40 IL EST MOINS VINGT NEUF HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 08:45 IL EST MOINS LE QUART NEUF HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 08:50 IL EST MOINS DIX NEUF HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 08:55 IL EST MOINS CINQ NEUF HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 09:00 IL EST NEUF HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 09:05 IL EST CINQ NEUF HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 09:10 IL EST DIX NEUF HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 09:15 IL EST ET QUART NEUF HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 09:20 IL EST VINGT NEUF HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 09:25 IL EST VINGT - CINQ NEUF HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 09:30 IL EST ET DEMIE NEUF HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 09:35 IL EST MOINS VINGT - CINQ DIX HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 09:40 IL EST MOINS VINGT DIX HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 09:45 IL EST MOINS LE QUART DIX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 09:50 IL EST MOINS DIX DIX HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 09:55 IL EST MOINS CINQ DIX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 10:00 IL EST DIX HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 10:05 IL EST CINQ DIX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 10:10 IL EST DIX DIX HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 10:15 IL EST ET QUART DIX HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 10:20 IL EST VINGT DIX HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 10:25 IL EST VINGT - CINQ DIX HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 10:30 IL EST ET DEMIE DIX HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 10:35 IL EST MOINS VINGT - CINQ ONZE HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 10:40 IL EST MOINS VINGT ONZE HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 10:45 IL EST MOINS LE QUART ONZE HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 10:50 IL EST MOINS DIX ONZE HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 10:55 IL EST MOINS CINQ ONZE HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 11:00 IL EST ONZE HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 11:05 IL EST CINQ ONZE HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 11:10 IL EST DIX ONZE HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 11:15 IL EST ET QUART ONZE HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 11:20 IL EST VINGT ONZE HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 11:25 IL EST VINGT - CINQ ONZE HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 11:30 IL EST ET DEMIE ONZE HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0x04, 0x80, 0x00, 0x01, 0x20, 0x00, 0x00, 0xB8, 0x01}, // 11:35 IL EST MOINS VINGT - CINQ MIDI
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x04, 0x80, 0x00, 0x01, 0x20, 0x00, 0x00, 0xB8, 0x01}, // 11:40 IL EST MOINS VINGT MIDI
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0x04, 0x80, 0x00, 0x01, 0x20, 0x00, 0x00, 0xB8, 0x01}, // 11:45 IL EST MOINS LE QUART MIDI
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0x04, 0x80, 0x00, 0x01, 0x20, 0x00, 0x00, 0xB8, 0x01}, // 11:50 IL EST MOINS DIX MIDI
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0x04, 0x80, 0x00, 0x01, 0x20, 0x00, 0x00, 0xB8, 0x01}, // 11:55 IL EST MOINS CINQ MIDI
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x01, 0x20, 0x00, 0x00, 0xB8, 0x01}, // 12:00 IL EST MIDI
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x01, 0x20, 0x00, 0x00, 0xB8, 0x01}, // 12:05 IL EST CINQ MIDI
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x04, 0x80, 0x00, 0x01, 0x20, 0x00, 0x00, 0xB8, 0x01}, // 12:10 IL EST DIX MIDI
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x04, 0x80, 0x00, 0x01, 0x20, 0x00, 0x00, 0xB8, 0x01}, // 12:15 IL EST ET QUART MIDI
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x01, 0x20, 0x00, 0x00, 0xB8, 0x01}, // 12:20 IL EST VINGT MIDI
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x01, 0x20, 0x00, 0x00, 0xB8, 0x01}, // 12:25 IL EST VINGT - CINQ MIDI
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x01, 0x20, 0x00, 0x00, 0xB8, 0x01}, // 12:30 IL EST ET DEMIE MIDI
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 12:35 IL EST MOINS VINGT - CINQ UNE HEURE
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 12:40 IL EST MOINS VINGT UNE HEURE
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 12:45 IL EST MOINS LE QUART UNE HEURE
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 12:50 IL EST MOINS DIX UNE HEURE
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 12:55 IL EST MOINS CINQ UNE HEURE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 13:00 IL EST UNE HEURE
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 13:05 IL EST CINQ UNE HEURE
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 13:10 IL EST DIX UNE HEURE
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 13:15 IL EST ET QUART UNE HEURE
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 13:20 IL EST VINGT UNE HEURE
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 13:25 IL EST VINGT - CINQ UNE HEURE
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 13:30 IL EST ET DEMIE UNE HEURE
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 13:35 IL EST MOINS VINGT - CINQ DEUX HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 13:40 IL EST MOINS VINGT DEUX HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 13:45 IL EST MOINS LE QUART DEUX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 13:50 IL EST MOINS DIX DEUX HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 13:55 IL EST MOINS CINQ DEUX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 14:00 IL EST DEUX HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 14:05 IL EST CINQ DEUX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 14:10 IL EST DIX DEUX HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 14:15 IL EST ET QUART DEUX HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 14:20 IL EST VINGT DEUX HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 14:25 IL EST VINGT - CINQ DEUX HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 14:30 IL EST ET DEMIE DEUX HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 14:35 IL EST MOINS VINGT - CINQ TROIS HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 14:40 IL EST MOINS VINGT TROIS HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 14:45 IL EST MOINS LE QUART TROIS HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 14:50 IL EST MOINS DIX TROIS HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 14:55 IL EST MOINS CINQ TROIS HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 15:00 IL EST TROIS HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 15:05 IL EST CINQ TROIS HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 15:10 IL EST DIX TROIS HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 15:15 IL EST ET QUART TROIS HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 15:20 IL EST VINGT TROIS HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 15:25 IL EST VINGT - CINQ TROIS HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x01}, // 15:30 IL EST ET DEMIE TROIS HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 15:35 IL EST MOINS VINGT - CINQ QUATRE HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 15:40 IL EST MOINS VINGT QUATRE HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 15:45 IL EST MOINS LE QUART QUATRE HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 15:50 IL EST MOINS DIX QUATRE HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 15:55 IL EST MOINS CINQ QUATRE HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 16:00 IL EST QUATRE HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 16:05 IL EST CINQ QUATRE HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 16:10 IL EST DIX QUATRE HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 16:15 IL EST ET QUART QUATRE HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 16:20 IL EST VINGT QUATRE HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 16:25 IL EST VINGT - CINQ QUATRE HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xB8, 0x01}, // 16:30 IL EST ET DEMIE QUATRE HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 16:35 IL EST MOINS VINGT - CINQ CINQ HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 16:40 IL EST MOINS VINGT CINQ HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 16:45 IL EST MOINS LE QUART CINQ HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 16:50 IL EST MOINS DIX CINQ HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 16:55 IL EST MOINS CINQ CINQ HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 17:00 IL EST CINQ HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 17:05 IL EST CINQ CINQ HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 17:10 IL EST DIX CINQ HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 17:15 IL EST ET QUART CINQ HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 17:20 IL EST VINGT CINQ HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 17:25 IL EST VINGT - CINQ CINQ HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xBB, 0x01}, // 17:30 IL EST ET DEMIE CINQ HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 17:35 IL EST MOINS VINGT - CINQ SIX HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 17:40 IL EST MOINS VINGT SIX HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 17:45 IL EST MOINS LE QUART SIX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 17:50 IL EST MOINS DIX SIX HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 17:55 IL EST MOINS CINQ SIX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 18:00 IL EST SIX HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 18:05 IL EST CINQ SIX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 18:10 IL EST DIX SIX HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 18:15 IL EST ET QUART SIX HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 18:20 IL EST VINGT SIX HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 18:25 IL EST VINGT - CINQ SIX HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x11, 0x00, 0x08, 0x04, 0x00, 0x00, 0xB8, 0x01}, // 18:30 IL EST ET DEMIE SIX HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 18:35 IL EST MOINS VINGT - CINQ SEPT HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 18:40 IL EST MOINS VINGT SEPT HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 18:45 IL EST MOINS LE QUART SEPT HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 18:50 IL EST MOINS DIX SEPT HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 18:55 IL EST MOINS CINQ SEPT HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 19:00 IL EST SEPT HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 19:05 IL EST CINQ SEPT HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 19:10 IL EST DIX SEPT HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 19:15 IL EST ET QUART SEPT HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 19:20 IL EST VINGT SEPT HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 19:25 IL EST VINGT - CINQ SEPT HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x80, 0x07, 0x00, 0x00, 0xB8, 0x01}, // 19:30 IL EST ET DEMIE SEPT HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0xFE, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 19:35 IL EST MOINS VINGT - CINQ HUIT HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0xFE, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 19:40 IL EST MOINS VINGT HUIT HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0xFE, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 19:45 IL EST MOINS LE QUART HUIT HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0xFE, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 19:50 IL EST MOINS DIX HUIT HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0xFE, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 19:55 IL EST MOINS CINQ HUIT HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 20:00 IL EST HUIT HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0xC0, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 20:05 IL EST CINQ HUIT HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0xC0, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 20:10 IL EST DIX HUIT HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0xC0, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 20:15 IL EST ET QUART HUIT HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0xC0, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 20:20 IL EST VINGT HUIT HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0xC0, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 20:25 IL EST VINGT - CINQ HUIT HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0xC0, 0xFB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 20:30 IL EST ET DEMIE HUIT HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 20:35 IL EST MOINS VINGT - CINQ NEUF HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 20:40 IL EST MOINS VINGT NEUF HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 20:45 IL EST MOINS LE QUART NEUF HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 20:50 IL EST MOINS DIX NEUF HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 20:55 IL EST MOINS CINQ NEUF HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 21:00 IL EST NEUF HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 21:05 IL EST CINQ NEUF HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 21:10 IL EST DIX NEUF HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 21:15 IL EST ET QUART NEUF HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 21:20 IL EST VINGT NEUF HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 21:25 IL EST VINGT - CINQ NEUF HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xB8, 0x01}, // 21:30 IL EST ET DEMIE NEUF HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 21:35 IL EST MOINS VINGT - CINQ DIX HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 21:40 IL EST MOINS VINGT DIX HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 21:45 IL EST MOINS LE QUART DIX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 21:50 IL EST MOINS DIX DIX HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 21:55 IL EST MOINS CINQ DIX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 22:00 IL EST DIX HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 22:05 IL EST CINQ DIX HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 22:10 IL EST DIX DIX HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 22:15 IL EST ET QUART DIX HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 22:20 IL EST VINGT DIX HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 22:25 IL EST VINGT - CINQ DIX HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x09, 0x00, 0x08, 0x08, 0x00, 0x00, 0xB8, 0x01}, // 22:30 IL EST ET DEMIE DIX HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 22:35 IL EST MOINS VINGT - CINQ ONZE HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 22:40 IL EST MOINS VINGT ONZE HEURES
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 22:45 IL EST MOINS LE QUART ONZE HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 22:50 IL EST MOINS DIX ONZE HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 22:55 IL EST MOINS CINQ ONZE HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 23:00 IL EST ONZE HEURES
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 23:05 IL EST CINQ ONZE HEURES
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 23:10 IL EST DIX ONZE HEURES
+    {0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 23:15 IL EST ET QUART ONZE HEURES
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 23:20 IL EST VINGT ONZE HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 23:25 IL EST VINGT - CINQ ONZE HEURES
+    {0xF6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 23:30 IL EST ET DEMIE ONZE HEURES
+    {0x00, 0xE0, 0x7F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 23:35 IL EST MOINS VINGT - CINQ MINUIT
+    {0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 23:40 IL EST MOINS VINGT MINUIT
+    {0x00, 0x00, 0x00, 0xF8, 0xC0, 0x3E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 23:45 IL EST MOINS LE QUART MINUIT
+    {0x00, 0x00, 0x00, 0x00, 0x38, 0x3E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 23:50 IL EST MOINS DIX MINUIT
+    {0x00, 0xE0, 0x01, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x01}, // 23:55 IL EST MOINS CINQ MINUIT
+  };
+}
@@ -1,76 +1,218 @@
 // Always-on Web-enabled app entry
 #include <Arduino.h>
 #include "core/Config.hpp"
+#include "core/BootTrace.hpp"
+#include "core/Log.hpp"
+#include "core/Perf.hpp"
+#include "core/HeapTrack.hpp"
+#include "core/EventLoop.hpp"
 #include "hal/HalDriver.hpp"
 #include "services/WebService.hpp"
 #include "services/TimeService.hpp"
+#include "services/MqttService.hpp"
+#include "services/AmbientHistory.hpp"
+#include "services/RadioPolicy.hpp"
 #ifdef ARDUINO_ARCH_ESP32
 #include <ArduinoOTA.h>
 #include <WiFi.h>
 #endif
 
+#ifndef RENDER_TASK
+#ifdef ARDUINO_ARCH_ESP32
+#define RENDER_TASK 1 // run the HAL on its own render task (0 = on the loop task, as before)
+#else
+#define RENDER_TASK 0 // no FreeRTOS: the HAL runs on the loop task
+#endif
+#endif
+#if RENDER_TASK
+#ifndef ARDUINO_ARCH_ESP32
+#error "RENDER_TASK needs FreeRTOS (ARDUINO_ARCH_ESP32)"
+#endif
+#include "hal/HalTask.hpp"
+#endif
+
+#ifndef OTA_POLL_MS
+#define OTA_POLL_MS 500 // ArduinoOTA listens on UDP by polling; espota retries its invitation for seconds
+#endif
+#ifndef OTA_WINDOW_MS
+#define OTA_WINDOW_MS 600000 // poll that often for this long after OTA comes up or the last web request;
+                             // afterwards invitations are answered on passes the loop makes anyway
+#endif
+
 static HalDriver* g_hal = nullptr;
 static Config g_cfg;
 static WebService g_web;
 
 #ifdef ARDUINO_ARCH_ESP32
 static bool g_otaReady = false;
+static uint32_t g_otaReadyMs = 0;
 static void startOTAOnce() {
     if (g_otaReady) return;
     ArduinoOTA.setHostname("ezclock");
     ArduinoOTA.setPort(3232);
-    ArduinoOTA.onStart([](){ Serial.println("[OTA] Start"); });
-    ArduinoOTA.onEnd([](){ Serial.println("[OTA] End"); });
+    // The upload runs inside ArduinoOTA.handle() on the loop task: switch to full power before it
+    ArduinoOTA.onStart([](){ LOGI("[OTA] Start"); RadioPolicy::setOta(true); RadioPolicy::loop(); });
+    ArduinoOTA.onEnd([](){ LOGI("[OTA] End"); RadioPolicy::setOta(false); });
     ArduinoOTA.onProgress([](unsigned int progress, unsigned int total){
         static uint32_t last = 0; uint32_t now = millis();
-        if (now - last > 250) { last = now; Serial.printf("[OTA] %u%%\n", (progress * 100) / total); }
+        if (now - last > 250) { last = now; LOGI("[OTA] %u%%", (progress * 100) / total); }
     });
-    ArduinoOTA.onError([](ota_error_t err){ Serial.printf("[OTA] Error %u\n", (unsigned)err); });
+    ArduinoOTA.onError([](ota_error_t err){ LOGE("[OTA] Error %u", (unsigned)err); RadioPolicy::setOta(false); });
     ArduinoOTA.begin();
     g_otaReady = true;
+    g_otaReadyMs = millis();
     IPAddress ip = WiFi.localIP();
-    Serial.printf("[OTA] Ready at %s:3232\n", ip.toString().c_str());
+    LOGI("[OTA] Ready at %s:3232", ip.toString().c_str());
+}
+#endif
+
+// Route LED config changes to the HAL; each subscriber reacts only to its own fields
+static void bindHal(HalDriver* hal) {
+    using F = Config::Field;
+    Config::onChange(Config::bit(F::led_fadeMs), [hal](const Config& c){
+        hal->setSmoothing(c.led.fadeMs);
+    });
+    Config::onChange(Config::bit(F::led_colorHex), [hal](const Config& c){
+        uint8_t r, g, b;
+        if (parseHexColor(c.led.colorHex, r, g, b)) { hal->fill(r, g, b); hal->show(); }
+    });
+    Config::onChange(Config::bit(F::led_autoHue) | Config::bit(F::led_autoHueDegPerMin), [hal](const Config& c){
+        hal->setAutoHue(c.led.autoHue, c.led.autoHueDegPerMin);
+        // When disabled, go back to the persisted color frame
+        uint8_t r, g, b;
+        if (!c.led.autoHue && parseHexColor(c.led.colorHex, r, g, b)) { hal->fill(r, g, b); hal->show(); }
+    });
+    Config::onChange(Config::bit(F::led_ambientMinPct) | Config::bit(F::led_ambientMaxPct) | Config::bit(F::led_ambientFullPowerThreshold),
+                     [hal](const Config& c){
+        hal->setAmbientControl(c.led.ambientMinPct, c.led.ambientMaxPct, c.led.ambientFullPowerThreshold);
+    });
+    Config::onChange(Config::bit(F::led_ambientSampleMs) | Config::bit(F::led_ambientAvgCount), [hal](const Config& c){
+        hal->setAmbientSampling(c.led.ambientSampleMs, c.led.ambientAvgCount);
+    });
+    Config::onChange(Config::bit(F::led_ambientFilter), [hal](const Config& c){
+        hal->setAmbientFilter(c.led.ambientFilter);
+    });
+    Config::onChange(Config::bit(F::led_ambientCurve), [hal](const Config& c){
+        hal->setAmbientCurve(c.led.ambientCurve);
+    });
+    Config::onChange(Config::bit(F::led_paletteMode) | Config::bit(F::led_colorPrefix) |
+                     Config::bit(F::led_colorMinutes) | Config::bit(F::led_colorDots), [hal](const Config& c){
+        auto rgb = [](const String& hex) -> uint32_t {
+            uint8_t r = 0, g = 0, b = 0;
+            parseHexColor(hex, r, g, b);
+            return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+        };
+        hal->setPalette(c.led.paletteMode, rgb(c.led.colorPrefix), rgb(c.led.colorMinutes), rgb(c.led.colorDots));
+    });
 }
+
+// Network-facing services; in FAST_BOOT these start only after the first frame is on the display
+static bool g_servicesStarted = false;
+static void startServices() {
+    if (g_servicesStarted) return;
+    g_servicesStarted = true;
+#ifdef FAST_BOOT
+    // Web first: it owns the AP/STA bring-up; TimeSvc then follows the connection without waiting for it
+    { HeapTrack::Scope h(HeapTrack::Tag::Web); g_web.begin(g_cfg, g_hal); }
+    { HeapTrack::Scope h(HeapTrack::Tag::Time); TimeSvc::begin(g_cfg); }
+#else
+    { HeapTrack::Scope h(HeapTrack::Tag::Time); TimeSvc::begin(g_cfg); }
+    { HeapTrack::Scope h(HeapTrack::Tag::Web); g_web.begin(g_cfg, g_hal); }
+#endif
+    BootTrace::mark(BootTrace::Phase::Server);
+    { HeapTrack::Scope h(HeapTrack::Tag::Mqtt); MqttSvc::begin(g_cfg, g_hal); }
+
+#ifdef ARDUINO_ARCH_ESP32
+    // Start OTA after Wi-Fi STA gets an IP; also call once in case we're already up or AP-only
+    WiFi.onEvent([](WiFiEvent_t e){
+        if (e == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+            startOTAOnce();
+        }
+    });
+    { HeapTrack::Scope h(HeapTrack::Tag::Ota); startOTAOnce(); }
 #endif
+}
 
 void setup() {
     Serial.begin(115200);
+    Log::begin();
 #ifdef ARDUINO_ARCH_ESP32
     Serial.setDebugOutput(true);
 #endif
+#ifdef FAST_BOOT
+    // Only wait for USB CDC when a host is actually attached
+  #if ARDUINO_USB_CDC_ON_BOOT && ARDUINO_USB_MODE
+    if (Serial.isPlugged()) {
+        uint32_t _t0 = millis();
+        while (!Serial && millis() - _t0 < 500) {
+            delay(10);
+        }
+    }
+  #endif
+#else
     // Give USB CDC a moment to enumerate so early logs are visible
     uint32_t _t0 = millis();
     while (!Serial && millis() - _t0 < 2000) {
         delay(10);
     }
     delay(100);
-    Serial.println("\n[EzClock] Web mode starting...");
+#endif
+    BootTrace::mark(BootTrace::Phase::Serial);
+    LOGI("Web mode starting...");
+    EventLoop::begin();
 
     g_hal = createDefaultDriver();
-    g_hal->begin();
+#if RENDER_TASK
+    // Everyone else talks to the driver through the render task's command queue
+    static HalTask s_render(g_hal);
+    g_hal = &s_render;
+#endif
+    { HeapTrack::Scope h(HeapTrack::Tag::Hal); g_hal->begin(); }
+    BootTrace::mark(BootTrace::Phase::HalBegin);
 
     g_cfg.load();
-        Serial.printf("[EzClock] Loaded SSID='%s' TZ='%s' Hostname='%s'\n", g_cfg.wifi.ssid.c_str(), g_cfg.ntp.timezone.c_str(), g_cfg.net.hostname.c_str());
-    TimeSvc::begin(g_cfg);
-    g_web.begin(g_cfg, g_hal);
-
-#ifdef ARDUINO_ARCH_ESP32
-    // Start OTA after Wi-Fi STA gets an IP; also call once in case we're already up or AP-only
-    WiFi.onEvent([](WiFiEvent_t e){
-        if (e == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
-            startOTAOnce();
-        }
-    });
-    startOTAOnce();
+    BootTrace::mark(BootTrace::Phase::NvsLoad);
+    LOGI("Loaded SSID='%s' TZ='%s' Hostname='%s'", g_cfg.wifi.ssid.c_str(), g_cfg.ntp.timezone.c_str(), g_cfg.net.hostname.c_str());
+    // Apply saved LED settings, then keep the HAL in sync with later edits
+    bindHal(g_hal);
+    g_cfg.notify(Config::LED_MASK);
+#ifndef FAST_BOOT
+    startServices();
 #endif
 }
 
 void loop() {
-    g_web.loop();
-    TimeSvc::loop();
-    if (g_hal) g_hal->loop();
+    {
+        Perf::Scope loopScope(Perf::Stage::Loop);
+        if (g_servicesStarted) {
+            { Perf::Scope s(Perf::Stage::Web); HeapTrack::Scope h(HeapTrack::Tag::Web); g_web.loop(); }
+            { Perf::Scope s(Perf::Stage::Time); HeapTrack::Scope h(HeapTrack::Tag::Time); TimeSvc::loop(); }
+            { Perf::Scope s(Perf::Stage::Mqtt); HeapTrack::Scope h(HeapTrack::Tag::Mqtt); MqttSvc::loop(); }
+            RadioPolicy::loop();
+        }
+        if (g_hal) {
+#if RENDER_TASK
+            g_hal->loop(); // no-op while the render task runs
+#else
+            { Perf::Scope s(Perf::Stage::Hal); HeapTrack::Scope h(HeapTrack::Tag::Hal); g_hal->loop(); }
+            if (!BootTrace::reached(BootTrace::Phase::FirstFrame)) BootTrace::mark(BootTrace::Phase::FirstFrame);
+#endif
+            EventLoop::wakeIn(g_hal->idleMs(millis()));
+        }
+        AmbientHistory::loop(g_hal);
+        // FAST_BOOT: network services follow the first frame (the render task posts an event for it)
+        if (!g_servicesStarted && BootTrace::reached(BootTrace::Phase::FirstFrame)) startServices();
 #ifdef ARDUINO_ARCH_ESP32
-    ArduinoOTA.handle();
+        if (g_otaReady) {
+            { Perf::Scope s(Perf::Stage::Ota); HeapTrack::Scope h(HeapTrack::Tag::Ota); ArduinoOTA.handle(); }
+            // Fast polling only while someone is likely to push an update
+            const uint32_t nowMs = millis();
+            if (nowMs - g_otaReadyMs < OTA_WINDOW_MS || nowMs - RadioPolicy::lastTouchMs() < OTA_WINDOW_MS)
+                EventLoop::wakeIn(OTA_POLL_MS);
+        }
 #endif
-    delay(10);
+        HeapTrack::loop();
+    }
+    // Sleep until the earliest stage deadline or an event from another task
+    EventLoop::wait();
 }
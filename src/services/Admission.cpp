@@ -0,0 +1,82 @@
+#include "Admission.hpp"
+
+// Tunables (override with -D flags)
+#ifndef ADMIT_RATE_PER_S
+#define ADMIT_RATE_PER_S 5      // sustained requests per second per client
+#endif
+#ifndef ADMIT_BURST
+#define ADMIT_BURST 12          // bucket depth (page load + status + scan)
+#endif
+#ifndef ADMIT_MAX_INFLIGHT
+#define ADMIT_MAX_INFLIGHT 2    // concurrent expensive requests
+#endif
+#ifndef ADMIT_MAX_CLIENTS
+#define ADMIT_MAX_CLIENTS 8     // tracked client buckets
+#endif
+
+namespace Admission {
+  struct Bucket {
+    uint32_t ip;
+    uint32_t lastMs;
+    uint32_t milliTokens; // 1000 = one request
+  };
+
+  // All calls happen on the AsyncTCP task; no locking required
+  static Bucket s_buckets[ADMIT_MAX_CLIENTS];
+  static uint8_t s_used = 0;
+  static uint8_t s_inFlight = 0;
+  static uint8_t s_inFlightPeak = 0;
+  static uint32_t s_admitted = 0;
+  static uint32_t s_rateLimited = 0;
+  static uint32_t s_busy = 0;
+
+  static Bucket& bucketFor(uint32_t ip, uint32_t nowMs) {
+    uint8_t lru = 0;
+    for (uint8_t i = 0; i < s_used; ++i) {
+      if (s_buckets[i].ip == ip) return s_buckets[i];
+      if ((nowMs - s_buckets[i].lastMs) > (nowMs - s_buckets[lru].lastMs)) lru = i;
+    }
+    // New client: take a free slot or evict the least recently seen one
+    Bucket& b = (s_used < ADMIT_MAX_CLIENTS) ? s_buckets[s_used++] : s_buckets[lru];
+    b.ip = ip;
+    b.lastMs = nowMs;
+    b.milliTokens = (uint32_t)ADMIT_BURST * 1000UL;
+    return b;
+  }
+
+  Verdict admit(uint32_t clientIp, Cost cost) {
+    if (cost == Cost::Exempt) { s_admitted++; return Verdict::Admit; }
+    const uint32_t nowMs = millis();
+    Bucket& b = bucketFor(clientIp, nowMs);
+    // Refill: ADMIT_RATE_PER_S tokens per 1000 ms == ADMIT_RATE_PER_S milli-tokens per ms
+    const uint32_t elapsed = nowMs - b.lastMs;
+    b.lastMs = nowMs;
+    const uint32_t cap = (uint32_t)ADMIT_BURST * 1000UL;
+    const uint32_t refill = (elapsed >= cap) ? cap : elapsed * (uint32_t)ADMIT_RATE_PER_S;
+    b.milliTokens = (b.milliTokens + refill > cap) ? cap : b.milliTokens + refill;
+    if (b.milliTokens < 1000) { s_rateLimited++; return Verdict::RateLimited; }
+    if (cost == Cost::Expensive) {
+      if (s_inFlight >= ADMIT_MAX_INFLIGHT) { s_busy++; return Verdict::Busy; }
+      s_inFlight++;
+      if (s_inFlight > s_inFlightPeak) s_inFlightPeak = s_inFlight;
+    }
+    b.milliTokens -= 1000;
+    s_admitted++;
+    return Verdict::Admit;
+  }
+
+  void release() {
+    if (s_inFlight) s_inFlight--;
+  }
+
+  Stats stats() {
+    Stats s;
+    s.admitted = s_admitted;
+    s.rateLimited = s_rateLimited;
+    s.busy = s_busy;
+    s.inFlight = s_inFlight;
+    s.inFlightPeak = s_inFlightPeak;
+    s.clients = s_used;
+    return s;
+  }
+}
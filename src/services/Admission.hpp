@@ -0,0 +1,31 @@
+#pragma once
+#include <Arduino.h>
+
+// Lightweight admission control for the async web server:
+// - per-client token bucket (fixed table, LRU replacement)
+// - cap on concurrently in-flight expensive requests (released on disconnect)
+// Rejections are answered with a prebuilt 429 queued on the connection (no allocation).
+namespace Admission {
+  enum class Cost : uint8_t {
+    Exempt,    // never limited (OTA upload, health checks)
+    Cheap,     // rate-limited only
+    Expensive  // rate-limited and counted against the in-flight cap
+  };
+
+  enum class Verdict : uint8_t { Admit, RateLimited, Busy };
+
+  // Decide for a request from clientIp; on Admit with Cost::Expensive the caller
+  // must call release() once the request is finished.
+  Verdict admit(uint32_t clientIp, Cost cost);
+  void release();
+
+  struct Stats {
+    uint32_t admitted;
+    uint32_t rateLimited;
+    uint32_t busy;
+    uint8_t inFlight;
+    uint8_t inFlightPeak;
+    uint8_t clients;
+  };
+  Stats stats();
+}
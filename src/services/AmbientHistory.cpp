@@ -0,0 +1,160 @@
+#include "AmbientHistory.hpp"
+#include "../hal/HalDriver.hpp"
+#include "../core/EventLoop.hpp"
+#ifdef ARDUINO_ARCH_ESP32
+#include <freertos/FreeRTOS.h>
+#endif
+
+// Tunables (override with -D flags)
+#ifndef AMBIENT_HIST_SAMPLE_MS
+#define AMBIENT_HIST_SAMPLE_MS 5000  // reading period feeding the per-minute mean
+#endif
+
+namespace AmbientHistory {
+  // Ring of 12-bit values, two per 3 bytes
+  template <uint16_t N>
+  struct Ring12 {
+    static_assert(N % 2 == 0, "capacity must be even");
+    uint8_t data[N / 2 * 3];
+    uint16_t head{0};  // next write slot
+    uint16_t count{0};
+    uint32_t pushes{0}; // lets a reader tell which slots were overwritten since it looked
+
+    void push(uint16_t v) {
+      if (v > 0x0FFF) v = 0x0FFF;
+      uint8_t* p = data + (head / 2) * 3;
+      if (head & 1) { p[1] = (uint8_t)((p[1] & 0x0F) | ((v & 0x0F) << 4)); p[2] = (uint8_t)(v >> 4); }
+      else          { p[0] = (uint8_t)v; p[1] = (uint8_t)((p[1] & 0xF0) | (v >> 8)); }
+      head = (uint16_t)((head + 1) % N);
+      if (count < N) count++;
+      pushes++;
+    }
+
+    uint16_t oldest() const { return (uint16_t)((head + N - count) % N); }
+
+    uint16_t get(uint16_t slot) const {
+      const uint8_t* p = data + (slot / 2) * 3;
+      return (slot & 1) ? (uint16_t)((p[1] >> 4) | (p[2] << 4)) : (uint16_t)(p[0] | ((p[1] & 0x0F) << 8));
+    }
+  };
+
+  static Ring12<1440> s_minute;
+  static Ring12<1008> s_tenMinute;
+  static uint32_t s_lastSampleMs = 0;
+  static uint32_t s_minuteStartMs = 0;
+  static uint32_t s_sampleSum = 0;
+  static uint16_t s_sampleCount = 0;
+  static uint32_t s_minuteSum = 0;   // per-minute means feeding the ten-minute ring
+  static uint8_t s_minuteCount = 0;
+  static bool s_started = false;
+  // Appends run on the loop task, CSV streaming on the AsyncTCP task
+#ifdef ARDUINO_ARCH_ESP32
+  static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+  #define AH_LOCK() portENTER_CRITICAL(&s_mux)
+  #define AH_UNLOCK() portEXIT_CRITICAL(&s_mux)
+#else
+  #define AH_LOCK() do { } while(0)
+  #define AH_UNLOCK() do { } while(0)
+#endif
+
+  // Fold the minute's samples into the rings
+  static void closeMinute() {
+    if (!s_sampleCount) return; // ambient not supported by this driver
+    const uint16_t mean = (uint16_t)((s_sampleSum + s_sampleCount / 2) / s_sampleCount);
+    s_sampleSum = 0;
+    s_sampleCount = 0;
+    AH_LOCK();
+    s_minute.push(mean);
+    AH_UNLOCK();
+    s_minuteSum += mean;
+    if (++s_minuteCount == 10) {
+      const uint16_t tenMean = (uint16_t)((s_minuteSum + 5) / 10);
+      AH_LOCK();
+      s_tenMinute.push(tenMean);
+      AH_UNLOCK();
+      s_minuteSum = 0;
+      s_minuteCount = 0;
+    }
+  }
+
+  void loop(HalDriver* hal) {
+    const uint32_t nowMs = millis();
+    if (!s_started) { s_started = true; s_minuteStartMs = nowMs; s_lastSampleMs = nowMs - AMBIENT_HIST_SAMPLE_MS; }
+    // Close the minute first: a sample taken on the boundary starts the next one
+    if (nowMs - s_minuteStartMs >= 60000UL) {
+      s_minuteStartMs += 60000UL;
+      closeMinute();
+    }
+    if (nowMs - s_lastSampleMs >= AMBIENT_HIST_SAMPLE_MS) {
+      s_lastSampleMs = nowMs;
+      uint16_t raw = 0, avg = 0;
+      if (hal && hal->getAmbientReading(raw, avg)) { s_sampleSum += avg; s_sampleCount++; }
+    }
+    // Next sample or minute boundary, whichever comes first
+    const uint32_t toSample = AMBIENT_HIST_SAMPLE_MS - min<uint32_t>(nowMs - s_lastSampleMs, AMBIENT_HIST_SAMPLE_MS);
+    const uint32_t toMinute = 60000UL - min<uint32_t>(nowMs - s_minuteStartMs, 60000UL);
+    EventLoop::wakeIn(min(toSample, toMinute));
+  }
+
+  uint16_t count(Series s) {
+    AH_LOCK();
+    const uint16_t n = s == Series::Minute ? s_minute.count : s_tenMinute.count;
+    AH_UNLOCK();
+    return n;
+  }
+
+  void beginCsv(Cursor& c, Series s) {
+    c = Cursor();
+    c.series = s;
+    // Rows are indexed from this snapshot, so appends during the stream don't shift them
+    AH_LOCK();
+    if (s == Series::Minute) { c.total = s_minute.count; c.start = s_minute.oldest(); c.pushes = s_minute.pushes; }
+    else { c.total = s_tenMinute.count; c.start = s_tenMinute.oldest(); c.pushes = s_tenMinute.pushes; }
+    AH_UNLOCK();
+  }
+
+  // Row i of the snapshot; false once appends have overwritten it (oldest rows first)
+  template <uint16_t N>
+  static bool readRow(const Ring12<N>& r, const Cursor& c, uint16_t i, uint16_t& v) {
+    AH_LOCK();
+    const uint32_t appended = r.pushes - c.pushes;
+    const uint32_t spare = N - c.total; // appends that fit without overwriting the snapshot
+    const bool ok = appended <= spare || i >= appended - spare;
+    if (ok) v = r.get((uint16_t)((c.start + i) % N));
+    AH_UNLOCK();
+    return ok;
+  }
+
+  static bool nextLine(Cursor& c) {
+    int n;
+    if (!c.header) {
+      c.header = true;
+      n = snprintf(c.line, sizeof(c.line), "age_s,value\n");
+    } else {
+      const bool minute = c.series == Series::Minute;
+      uint16_t v = 0;
+      // Skip rows the live ring has overwritten since beginCsv()
+      while (c.index < c.total && !(minute ? readRow(s_minute, c, c.index, v) : readRow(s_tenMinute, c, c.index, v))) c.index++;
+      if (c.index >= c.total) return false;
+      // Age of the bucket end relative to the newest stored value
+      const uint32_t age = (uint32_t)(c.total - 1 - c.index) * (minute ? 60UL : 600UL);
+      n = snprintf(c.line, sizeof(c.line), "%lu,%u\n", (unsigned long)age, (unsigned)v);
+      c.index++;
+    }
+    c.len = (uint8_t)((n > 0 && n < (int)sizeof(c.line)) ? n : 0);
+    c.off = 0;
+    return true;
+  }
+
+  size_t renderChunk(Cursor& c, uint8_t* buf, size_t maxLen) {
+    size_t written = 0;
+    while (written < maxLen) {
+      if (c.off >= c.len && !nextLine(c)) break;
+      const size_t take = min((size_t)(c.len - c.off), maxLen - written);
+      memcpy(buf + written, c.line + c.off, take);
+      c.off += take;
+      written += take;
+    }
+    return written;
+  }
+}
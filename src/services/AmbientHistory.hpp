@@ -0,0 +1,34 @@
+#pragma once
+#include <Arduino.h>
+
+class HalDriver;
+
+// Fixed-memory ambient light history for tuning the brightness mapping.
+// Two rings of 12-bit ADC values packed two per 3 bytes:
+//   Minute   - 1440 one-minute means (24 h)      2160 bytes
+//   TenMinute - 1008 ten-minute means (7 days)    1512 bytes
+// Total static footprint ~3.7 KB. Appends are O(1) and overwrite the oldest value.
+// The driver's filtered reading is sampled every AMBIENT_HIST_SAMPLE_MS and averaged.
+namespace AmbientHistory {
+  enum class Series : uint8_t { Minute, TenMinute };
+
+  void loop(HalDriver* hal);
+  uint16_t count(Series s);
+
+  // CSV streaming ("age_s,value\n" rows, oldest first), one row buffer of state.
+  // Rows come from a snapshot taken in beginCsv(); values appended while
+  // streaming are left for the next export.
+  struct Cursor {
+    Series series{Series::Minute};
+    uint16_t index{0};
+    uint16_t total{0};   // rows at beginCsv()
+    uint16_t start{0};   // ring slot of the oldest row at beginCsv()
+    uint32_t pushes{0};  // ring appends at beginCsv()
+    bool header{false};
+    uint8_t len{0};
+    uint8_t off{0};
+    char line[24];
+  };
+  void beginCsv(Cursor& c, Series s);
+  size_t renderChunk(Cursor& c, uint8_t* buf, size_t maxLen);
+}
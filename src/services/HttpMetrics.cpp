@@ -0,0 +1,150 @@
+#include "HttpMetrics.hpp"
+
+namespace HttpMetrics {
+  // Latency bucket upper bounds in microseconds (Prometheus "le" labels)
+  static const uint32_t BUCKET_US[] = { 500, 1000, 5000, 10000, 50000, 100000, 500000 };
+  static constexpr uint8_t BUCKETS = sizeof(BUCKET_US) / sizeof(BUCKET_US[0]);
+
+  struct RouteStats {
+    const char* path;
+    const char* method;
+    uint32_t count;
+    uint32_t buckets[BUCKETS + 1]; // last = +Inf overflow
+    uint64_t latencySumUs;
+    uint64_t bytes;
+    int64_t heapDeltaSum;
+  };
+
+  // Handlers and the /metrics stream all run on the AsyncTCP task, so plain counters suffice
+  static RouteStats s_routes[MAX_ROUTES];
+  static uint8_t s_routeCount = 0;
+  static uint8_t s_current = NO_ROUTE;
+
+  uint8_t registerRoute(const char* path, const char* method) {
+    if (s_routeCount >= MAX_ROUTES) return NO_ROUTE;
+    RouteStats& r = s_routes[s_routeCount];
+    memset(&r, 0, sizeof(r));
+    r.path = path;
+    r.method = method;
+    return s_routeCount++;
+  }
+
+  Scope::Scope(uint8_t id) : _id(id), _prev(s_current), _t0(micros()), _heap0(ESP.getFreeHeap()) {
+    s_current = id;
+  }
+
+  Scope::~Scope() {
+    const uint32_t dt = micros() - _t0;
+    const int32_t heapDelta = (int32_t)_heap0 - (int32_t)ESP.getFreeHeap();
+    s_current = _prev;
+    if (_id >= s_routeCount) return;
+    RouteStats& r = s_routes[_id];
+    r.count++;
+    r.latencySumUs += dt;
+    r.heapDeltaSum += heapDelta;
+    uint8_t b = 0;
+    while (b < BUCKETS && dt > BUCKET_US[b]) ++b;
+    r.buckets[b]++;
+  }
+
+  void addResponseBytes(size_t n) {
+    if (s_current < s_routeCount) s_routes[s_current].bytes += n;
+  }
+
+  // ---- Prometheus exposition ----
+
+  enum Family : uint8_t { F_REQUESTS = 0, F_LATENCY, F_BYTES, F_HEAP, FAMILY_COUNT };
+
+  static const char* const FAMILY_NAME[FAMILY_COUNT] = {
+    "ezclock_http_requests_total",
+    "ezclock_http_request_duration_seconds",
+    "ezclock_http_response_bytes_total",
+    "ezclock_http_heap_delta_bytes",
+  };
+  static const char* const FAMILY_HELP[FAMILY_COUNT] = {
+    "Requests handled per route.",
+    "Handler latency per route.",
+    "Response payload bytes per route.",
+    "Sum of free-heap decrease across handler calls (negative = freed).",
+  };
+  static const char* const FAMILY_TYPE[FAMILY_COUNT] = { "counter", "histogram", "counter", "gauge" };
+
+  // Formats the next sample line for the current (family, route, sub) and advances the cursor
+  static void formatSample(Cursor& c) {
+    const RouteStats& r = s_routes[c.route];
+    const char* name = FAMILY_NAME[c.family];
+    int n = 0;
+    bool routeDone = true;
+    switch (c.family) {
+      case F_REQUESTS:
+        n = snprintf(c.line, sizeof(c.line), "%s{route=\"%s\",method=\"%s\"} %lu\n",
+                     name, r.path, r.method, (unsigned long)r.count);
+        break;
+      case F_LATENCY:
+        if (c.sub <= BUCKETS) {
+          uint32_t cum = 0;
+          for (uint8_t i = 0; i <= c.sub; ++i) cum += r.buckets[i];
+          if (c.sub < BUCKETS) {
+            n = snprintf(c.line, sizeof(c.line), "%s_bucket{route=\"%s\",method=\"%s\",le=\"%g\"} %lu\n",
+                         name, r.path, r.method, BUCKET_US[c.sub] / 1e6, (unsigned long)cum);
+          } else {
+            n = snprintf(c.line, sizeof(c.line), "%s_bucket{route=\"%s\",method=\"%s\",le=\"+Inf\"} %lu\n",
+                         name, r.path, r.method, (unsigned long)cum);
+          }
+          routeDone = false;
+        } else if (c.sub == BUCKETS + 1) {
+          n = snprintf(c.line, sizeof(c.line), "%s_sum{route=\"%s\",method=\"%s\"} %.6f\n",
+                       name, r.path, r.method, (double)r.latencySumUs / 1e6);
+          routeDone = false;
+        } else {
+          n = snprintf(c.line, sizeof(c.line), "%s_count{route=\"%s\",method=\"%s\"} %lu\n",
+                       name, r.path, r.method, (unsigned long)r.count);
+        }
+        break;
+      case F_BYTES:
+        n = snprintf(c.line, sizeof(c.line), "%s{route=\"%s\",method=\"%s\"} %llu\n",
+                     name, r.path, r.method, (unsigned long long)r.bytes);
+        break;
+      case F_HEAP:
+        n = snprintf(c.line, sizeof(c.line), "%s{route=\"%s\",method=\"%s\"} %lld\n",
+                     name, r.path, r.method, (long long)r.heapDeltaSum);
+        break;
+    }
+    if (routeDone) { c.route++; c.sub = 0; } else { c.sub++; }
+    c.len = (n < 0) ? 0 : (uint16_t)min((int)sizeof(c.line) - 1, n);
+    c.off = 0;
+  }
+
+  static bool nextLine(Cursor& c) {
+    while (c.family < FAMILY_COUNT) {
+      if (c.header < 2) {
+        int n = (c.header == 0)
+          ? snprintf(c.line, sizeof(c.line), "# HELP %s %s\n", FAMILY_NAME[c.family], FAMILY_HELP[c.family])
+          : snprintf(c.line, sizeof(c.line), "# TYPE %s %s\n", FAMILY_NAME[c.family], FAMILY_TYPE[c.family]);
+        c.header++;
+        c.len = (n < 0) ? 0 : (uint16_t)min((int)sizeof(c.line) - 1, n);
+        c.off = 0;
+        return true;
+      }
+      if (c.route >= s_routeCount) {
+        c.family++; c.header = 0; c.route = 0; c.sub = 0;
+        continue;
+      }
+      formatSample(c);
+      return true;
+    }
+    return false;
+  }
+
+  size_t renderChunk(Cursor& c, uint8_t* buf, size_t maxLen) {
+    size_t written = 0;
+    while (written < maxLen) {
+      if (c.off >= c.len && !nextLine(c)) break;
+      size_t take = min((size_t)(c.len - c.off), maxLen - written);
+      memcpy(buf + written, c.line + c.off, take);
+      c.off += take;
+      written += take;
+    }
+    return written;
+  }
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <Arduino.h>
+
+// Per-route HTTP instrumentation for the async web server.
+// Routes are registered once at startup; each handler invocation is wrapped in a
+// Scope that records count, latency histogram and heap delta. Response bytes are
+// attributed to the route currently being handled.
+namespace HttpMetrics {
+  static constexpr uint8_t MAX_ROUTES = 40;
+  static constexpr uint8_t NO_ROUTE = 0xFF;
+
+  // Register a route label; returns its id (NO_ROUTE when the table is full)
+  uint8_t registerRoute(const char* path, const char* method);
+
+  // RAII wrapper around a handler invocation
+  class Scope {
+  public:
+    explicit Scope(uint8_t id);
+    ~Scope();
+  private:
+    uint8_t _id;
+    uint8_t _prev;
+    uint32_t _t0;
+    uint32_t _heap0;
+  };
+
+  // Attribute response payload bytes to the route currently in scope
+  void addResponseBytes(size_t n);
+
+  // Streaming Prometheus text exposition; keeps heap usage to one line buffer
+  struct Cursor {
+    uint8_t family{0};
+    uint8_t header{0};
+    uint8_t route{0};
+    uint8_t sub{0};
+    uint16_t len{0};
+    uint16_t off{0};
+    char line[160];
+  };
+  size_t renderChunk(Cursor& c, uint8_t* buf, size_t maxLen);
+}
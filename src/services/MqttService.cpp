@@ -0,0 +1,608 @@
+#include "MqttService.hpp"
+#include "../core/Config.hpp"
+#include "../core/Log.hpp"
+#include "../core/EventLoop.hpp"
+#include "../hal/HalDriver.hpp"
+#include "TimeService.hpp"
+
+#ifdef ARDUINO_ARCH_ESP32
+  #include <WiFi.h>
+  #include <AsyncTCP.h>
+#endif
+
+#ifndef MQTT_KEEPALIVE_S
+#define MQTT_KEEPALIVE_S 120      // broker keepalive; a PINGREQ goes out at 3/4 of it when idle
+#endif
+#ifndef MQTT_MIN_BATCH_MS
+#define MQTT_MIN_BATCH_MS 500     // minimum spacing between outgoing batches
+#endif
+#ifndef MQTT_AMBIENT_MIN_MS
+#define MQTT_AMBIENT_MIN_MS 60000 // ambient sensor published at most once per minute
+#endif
+#ifndef MQTT_AMBIENT_DELTA
+#define MQTT_AMBIENT_DELTA 32     // ADC counts of change required before republishing
+#endif
+#ifndef MQTT_CONNECT_TIMEOUT_MS
+#define MQTT_CONNECT_TIMEOUT_MS 10000
+#endif
+#ifndef MQTT_BACKOFF_MAX_MS
+#define MQTT_BACKOFF_MAX_MS 300000
+#endif
+#ifndef MQTT_IDLE_POLL_MS
+#define MQTT_IDLE_POLL_MS 5000    // sensor/sync polling while online and idle, Wi-Fi polling while offline
+                                  // (light changes and inbound data wake the loop with an event)
+#endif
+
+#ifdef ARDUINO_ARCH_ESP32
+namespace MqttSvc {
+  enum class State : uint8_t { Disabled, Idle, Connecting, WaitConnAck, Online };
+
+  static Config* s_cfg = nullptr;
+  static HalDriver* s_hal = nullptr;
+  static AsyncClient* s_client = nullptr;
+  static State s_state = State::Disabled;
+  static uint32_t s_stateSinceMs = 0;
+  static uint32_t s_nextAttemptMs = 0;
+  static uint32_t s_backoffMs = 0;
+  static uint32_t s_lastTxMs = 0;
+  static uint32_t s_lastRxMs = 0;
+  static uint32_t s_lastBatchMs = 0;
+  static bool s_pingPending = false; // PINGREQ sent, nothing received since
+  static uint32_t s_sent = 0;
+  static volatile bool s_reconfigure = false; // set by Config subscribers on the committing task
+  static uint8_t s_sessionStep = 0; // post-CONNACK sequence: subscribe, discovery x3, then steady state
+  static String s_id;   // unique object id, e.g. ezclock_a1b2c3
+  static String s_root; // <baseTopic>/<id>
+
+  // Settings copied under Config::Lock on the loop task; the web server may
+  // rewrite the Config strings at any time
+  static MqttConfig s_mqtt;
+  static String s_hostname;
+  static volatile bool s_autoHue = false;
+
+  // Events raised from AsyncTCP callbacks, consumed in loop()
+  static volatile bool s_evConnected = false;
+  static volatile bool s_evDisconnected = false;
+  static volatile bool s_evConnAck = false;
+  static volatile bool s_evRx = false;
+
+  // Inbound command mailbox (filled on the AsyncTCP task)
+  struct Inbound { char topic[80]; char payload[48]; };
+  static constexpr uint8_t INBOX_SIZE = 4;
+  static Inbound s_inbox[INBOX_SIZE];
+  static uint8_t s_inHead = 0, s_inCount = 0;
+  static portMUX_TYPE s_inMux = portMUX_INITIALIZER_UNLOCKED;
+
+  // Receive reassembly buffer (AsyncTCP task only)
+  static uint8_t s_rx[192];
+  static size_t s_rxLen = 0;
+
+  // Outgoing batch; flushed as one TCP write
+  static uint8_t s_tx[768];
+  static size_t s_txLen = 0;
+
+  // Light state as commanded, and the last values actually published
+  struct LightState { bool on; uint8_t bri; uint8_t r, g, b; bool autoHue; };
+  static LightState s_light{true, 255, 0, 0, 0, false};
+  static LightState s_pubLight{};
+  static bool s_pubLightValid = false;
+  static int32_t s_pubAmbient = -1;
+  static uint32_t s_lastAmbientPubMs = 0;
+  static int8_t s_pubSynced = -1;
+
+  // ---- packet encoding ----
+
+  static size_t encodeHeader(uint8_t* out, uint8_t type, size_t remaining) {
+    size_t n = 0;
+    out[n++] = type;
+    do {
+      uint8_t d = remaining % 128;
+      remaining /= 128;
+      if (remaining) d |= 0x80;
+      out[n++] = d;
+    } while (remaining && n < 5);
+    return n;
+  }
+
+  static bool txFits(size_t n) { return s_txLen + n <= sizeof(s_tx); }
+
+  static void txBytes(const void* p, size_t n) { memcpy(s_tx + s_txLen, p, n); s_txLen += n; }
+
+  static void txStr(const char* s) {
+    const size_t n = strlen(s);
+    const uint8_t len[2] = { (uint8_t)(n >> 8), (uint8_t)(n & 0xFF) };
+    txBytes(len, 2);
+    txBytes(s, n);
+  }
+
+  static bool queuePublish(const char* topic, const char* payload, bool retain) {
+    const size_t tl = strlen(topic), pl = strlen(payload);
+    const size_t rem = 2 + tl + pl;
+    uint8_t hdr[5];
+    const size_t hl = encodeHeader(hdr, 0x30 | (retain ? 0x01 : 0x00), rem);
+    if (!txFits(hl + rem)) return false;
+    txBytes(hdr, hl);
+    txStr(topic);
+    txBytes(payload, pl);
+    s_sent++;
+    return true;
+  }
+
+  static bool queueControl(uint8_t type) {
+    if (!txFits(2)) return false;
+    const uint8_t pkt[2] = { type, 0 };
+    txBytes(pkt, 2);
+    s_sent++;
+    return true;
+  }
+
+  static void flush() {
+    if (!s_txLen || !s_client || !s_client->connected()) return;
+    if (s_client->space() < s_txLen) return; // retry next loop; batch stays queued
+    s_client->add((const char*)s_tx, s_txLen);
+    s_client->send();
+    s_txLen = 0;
+    s_lastTxMs = millis();
+  }
+
+  static String topic(const char* suffix) { return s_root + suffix; }
+
+  static void queueConnect() {
+    const MqttConfig& m = s_mqtt;
+    const String will = topic("/status");
+    uint8_t flags = 0x02 /*clean*/ | 0x04 /*will*/ | 0x20 /*will retain*/;
+    size_t rem = 10 + 2 + s_id.length() + 2 + will.length() + 2 + 7 /*"offline"*/;
+    if (m.user.length()) { flags |= 0x80; rem += 2 + m.user.length(); }
+    if (m.pass.length()) { flags |= 0x40; rem += 2 + m.pass.length(); }
+    uint8_t hdr[5];
+    const size_t hl = encodeHeader(hdr, 0x10, rem);
+    s_txLen = 0;
+    if (!txFits(hl + rem)) return;
+    txBytes(hdr, hl);
+    const uint8_t vh[] = { 0, 4, 'M', 'Q', 'T', 'T', 4, flags,
+                           (uint8_t)(MQTT_KEEPALIVE_S >> 8), (uint8_t)(MQTT_KEEPALIVE_S & 0xFF) };
+    txBytes(vh, sizeof(vh));
+    txStr(s_id.c_str());
+    txStr(will.c_str());
+    txStr("offline");
+    if (m.user.length()) txStr(m.user.c_str());
+    if (m.pass.length()) txStr(m.pass.c_str());
+    s_sent++;
+  }
+
+  static const char* const CMD_SUFFIX[] = { "/light/set", "/light/bri/set", "/light/rgb/set", "/light/fx/set" };
+
+  static bool queueSubscribe() {
+    size_t rem = 2;
+    for (const char* sfx : CMD_SUFFIX) rem += 2 + s_root.length() + strlen(sfx) + 1;
+    uint8_t hdr[5];
+    const size_t hl = encodeHeader(hdr, 0x82, rem);
+    if (!txFits(hl + rem)) return false;
+    txBytes(hdr, hl);
+    const uint8_t pid[2] = { 0, 1 };
+    txBytes(pid, 2);
+    for (const char* sfx : CMD_SUFFIX) {
+      txStr(topic(sfx).c_str());
+      const uint8_t qos = 0;
+      txBytes(&qos, 1);
+    }
+    s_sent++;
+    return true;
+  }
+
+  // ---- Home Assistant discovery ----
+
+  static String deviceJson() {
+    String host = s_hostname.length() ? s_hostname : String("ezQlock");
+    return String("\"dev\":{\"ids\":[\"") + s_id + "\"],\"name\":\"" + host + "\",\"mf\":\"EzClock\",\"mdl\":\"EzClock\"}";
+  }
+
+  static bool queueDiscovery(uint8_t which) {
+    String t, p;
+    p.reserve(480);
+    const String common = String("\"~\":\"") + s_root + "\",\"avty_t\":\"~/status\"," + deviceJson();
+    switch (which) {
+      case 0:
+        t = String("homeassistant/light/") + s_id + "/config";
+        p = String("{\"name\":\"Display\",\"uniq_id\":\"") + s_id + "_light\","
+            "\"cmd_t\":\"~/light/set\",\"stat_t\":\"~/light/state\","
+            "\"bri_cmd_t\":\"~/light/bri/set\",\"bri_stat_t\":\"~/light/bri\","
+            "\"rgb_cmd_t\":\"~/light/rgb/set\",\"rgb_stat_t\":\"~/light/rgb\","
+            "\"fx_cmd_t\":\"~/light/fx/set\",\"fx_stat_t\":\"~/light/fx\",\"fx_list\":[\"none\",\"autohue\"],"
+            + common + "}";
+        break;
+      case 1:
+        t = String("homeassistant/sensor/") + s_id + "_ambient/config";
+        p = String("{\"name\":\"Ambient\",\"uniq_id\":\"") + s_id + "_ambient\","
+            "\"stat_t\":\"~/ambient\",\"stat_cla\":\"measurement\",\"ic\":\"mdi:brightness-6\","
+            + common + "}";
+        break;
+      default:
+        t = String("homeassistant/binary_sensor/") + s_id + "_sync/config";
+        p = String("{\"name\":\"Time synced\",\"uniq_id\":\"") + s_id + "_sync\","
+            "\"stat_t\":\"~/synced\",\"dev_cla\":\"connectivity\",\"ent_cat\":\"diagnostic\","
+            + common + "}";
+        break;
+    }
+    return queuePublish(t.c_str(), p.c_str(), true);
+  }
+
+  // ---- state publishing (only what changed) ----
+
+  static void publishChanges(uint32_t nowMs) {
+    char buf[16];
+    LightState cur = s_light;
+    cur.autoHue = s_autoHue; // web UI may change it too
+    const bool all = !s_pubLightValid;
+    if (all || cur.on != s_pubLight.on) {
+      if (!queuePublish(topic("/light/state").c_str(), cur.on ? "ON" : "OFF", true)) return;
+      s_pubLight.on = cur.on;
+    }
+    if (all || cur.bri != s_pubLight.bri) {
+      snprintf(buf, sizeof(buf), "%u", (unsigned)cur.bri);
+      if (!queuePublish(topic("/light/bri").c_str(), buf, true)) return;
+      s_pubLight.bri = cur.bri;
+    }
+    if (all || cur.r != s_pubLight.r || cur.g != s_pubLight.g || cur.b != s_pubLight.b) {
+      snprintf(buf, sizeof(buf), "%u,%u,%u", (unsigned)cur.r, (unsigned)cur.g, (unsigned)cur.b);
+      if (!queuePublish(topic("/light/rgb").c_str(), buf, true)) return;
+      s_pubLight.r = cur.r; s_pubLight.g = cur.g; s_pubLight.b = cur.b;
+    }
+    if (all || cur.autoHue != s_pubLight.autoHue) {
+      if (!queuePublish(topic("/light/fx").c_str(), cur.autoHue ? "autohue" : "none", true)) return;
+      s_pubLight.autoHue = cur.autoHue;
+    }
+    s_pubLightValid = true;
+
+    const int8_t synced = TimeSvc::isSynced() ? 1 : 0;
+    if (synced != s_pubSynced) {
+      if (!queuePublish(topic("/synced").c_str(), synced ? "ON" : "OFF", true)) return;
+      s_pubSynced = synced;
+    }
+
+    uint16_t raw = 0, avg = 0;
+    if (s_hal && s_hal->getAmbientReading(raw, avg)) {
+      const int32_t delta = (int32_t)avg - s_pubAmbient;
+      const bool first = (s_pubAmbient < 0);
+      if (first || ((delta >= MQTT_AMBIENT_DELTA || delta <= -MQTT_AMBIENT_DELTA) &&
+                    nowMs - s_lastAmbientPubMs >= MQTT_AMBIENT_MIN_MS)) {
+        snprintf(buf, sizeof(buf), "%u", (unsigned)avg);
+        if (!queuePublish(topic("/ambient").c_str(), buf, false)) return;
+        s_pubAmbient = avg;
+        s_lastAmbientPubMs = nowMs;
+      }
+    }
+  }
+
+  // ---- inbound commands (applied on the loop task) ----
+
+  static void applyCommand(const char* t, const char* payload) {
+    const size_t rl = s_root.length();
+    if (strncmp(t, s_root.c_str(), rl) != 0) return;
+    const char* sfx = t + rl;
+    if (!strcmp(sfx, "/light/set")) {
+      s_light.on = (strcasecmp(payload, "ON") == 0);
+      if (s_hal) s_hal->setBrightness(s_light.on ? s_light.bri : 0);
+    } else if (!strcmp(sfx, "/light/bri/set")) {
+      int v = atoi(payload);
+      if (v < 0) v = 0;
+      if (v > 255) v = 255;
+      s_light.bri = (uint8_t)v;
+      s_light.on = (v > 0);
+      if (s_hal) s_hal->setBrightness(s_light.bri);
+    } else if (!strcmp(sfx, "/light/rgb/set")) {
+      unsigned r = 0, g = 0, b = 0;
+      if (sscanf(payload, "%u,%u,%u", &r, &g, &b) != 3) return;
+      s_light.r = (uint8_t)min(r, 255u); s_light.g = (uint8_t)min(g, 255u); s_light.b = (uint8_t)min(b, 255u);
+      if (s_hal) { s_hal->fill(s_light.r, s_light.g, s_light.b); s_hal->show(); }
+    } else if (!strcmp(sfx, "/light/fx/set")) {
+      const bool en = (strcmp(payload, "autohue") == 0);
+      {
+        Config::Lock lock; // the web server commits from the AsyncTCP task
+        if (s_cfg->set(Config::Field::led_autoHue, en ? "1" : "0") != Config::SetResult::Changed) return;
+        s_cfg->commit(); // HAL follows through its Config subscription
+      }
+      // Keep the color last commanded over MQTT rather than the persisted default
+      if (!en && s_hal) { s_hal->fill(s_light.r, s_light.g, s_light.b); s_hal->show(); }
+    }
+    LOGI("MQTT cmd %s = %s", sfx, payload);
+  }
+
+  static void drainInbox() {
+    for (;;) {
+      Inbound in;
+      portENTER_CRITICAL(&s_inMux);
+      const bool have = s_inCount > 0;
+      if (have) {
+        in = s_inbox[s_inHead];
+        s_inHead = (s_inHead + 1) % INBOX_SIZE;
+        s_inCount--;
+      }
+      portEXIT_CRITICAL(&s_inMux);
+      if (!have) return;
+      applyCommand(in.topic, in.payload);
+    }
+  }
+
+  // ---- AsyncTCP callbacks ----
+
+  static void handlePacket(uint8_t type, const uint8_t* body, size_t len) {
+    switch (type >> 4) {
+      case 2: // CONNACK
+        if (len >= 2 && body[1] == 0) s_evConnAck = true;
+        break;
+      case 3: { // PUBLISH (QoS 0 only; we subscribe at QoS 0)
+        if (len < 2) return;
+        const size_t tl = ((size_t)body[0] << 8) | body[1];
+        if (2 + tl > len) return;
+        const size_t pl = len - 2 - tl;
+        portENTER_CRITICAL(&s_inMux);
+        if (s_inCount < INBOX_SIZE) {
+          Inbound& in = s_inbox[(s_inHead + s_inCount) % INBOX_SIZE];
+          const size_t tc = min(tl, sizeof(in.topic) - 1);
+          const size_t pc = min(pl, sizeof(in.payload) - 1);
+          memcpy(in.topic, body + 2, tc); in.topic[tc] = 0;
+          memcpy(in.payload, body + 2 + tl, pc); in.payload[pc] = 0;
+          s_inCount++;
+        }
+        portEXIT_CRITICAL(&s_inMux);
+        break;
+      }
+      default: // SUBACK, PINGRESP: liveness only
+        break;
+    }
+  }
+
+  static void onData(void*, AsyncClient* c, void* data, size_t len) {
+    s_evRx = true;
+    EventLoop::post(EventLoop::Event::Mqtt); // runs once this callback returns
+    const uint8_t* p = (const uint8_t*)data;
+    while (len) {
+      const size_t take = min(len, sizeof(s_rx) - s_rxLen);
+      memcpy(s_rx + s_rxLen, p, take);
+      s_rxLen += take; p += take; len -= take;
+      // Parse complete packets
+      for (;;) {
+        if (s_rxLen < 2) break;
+        size_t rem = 0, mul = 1, i = 1;
+        bool complete = false;
+        while (i < s_rxLen && i < 5) {
+          rem += (s_rx[i] & 0x7F) * mul;
+          mul *= 128;
+          if (!(s_rx[i++] & 0x80)) { complete = true; break; }
+        }
+        // A fifth length byte is malformed; left alone it would fill s_rx and stall this loop
+        if (!complete && i < 5) break;
+        if (!complete || i + rem > sizeof(s_rx)) { s_rxLen = 0; c->close(true); return; } // oversized: not ours
+        if (s_rxLen < i + rem) break;
+        handlePacket(s_rx[0], s_rx + i, rem);
+        memmove(s_rx, s_rx + i + rem, s_rxLen - i - rem);
+        s_rxLen -= i + rem;
+      }
+    }
+  }
+
+  // ---- connection management ----
+
+  static void setState(State st) { s_state = st; s_stateSinceMs = millis(); }
+
+  static void scheduleRetry(uint32_t nowMs) {
+    s_backoffMs = s_backoffMs ? min<uint32_t>(s_backoffMs * 2, MQTT_BACKOFF_MAX_MS) : 2000;
+    s_nextAttemptMs = nowMs + s_backoffMs + (uint32_t)random(0, (long)(s_backoffMs / 4) + 1);
+    LOGW("MQTT retry in %lu ms", (unsigned long)(s_nextAttemptMs - nowMs));
+  }
+
+  static bool configured() {
+    return s_mqtt.enabled && s_mqtt.host.length();
+  }
+
+  static void loadSettings() {
+    Config::Lock lock;
+    s_mqtt = s_cfg->mqtt;
+    s_hostname = s_cfg->net.hostname;
+    s_autoHue = s_cfg->led.autoHue;
+    s_root = s_mqtt.baseTopic + "/" + s_id;
+  }
+
+  static void resetSession() {
+    s_txLen = 0;
+    s_rxLen = 0;
+    s_sessionStep = 0;
+    s_pingPending = false;
+    s_pubLightValid = false;
+    s_pubAmbient = -1;
+    s_pubSynced = -1;
+    s_evConnected = s_evDisconnected = s_evConnAck = s_evRx = false;
+  }
+
+  // Give up on the connection without waiting for its disconnect callback,
+  // which may never come (e.g. closed while the DNS lookup is pending). A
+  // late onDisconnect/onError finds the state Idle and is ignored, and the
+  // next connect() clears it through resetSession().
+  static void dropConnection(uint32_t nowMs, const char* why) {
+    LOGW("MQTT %s", why);
+    s_client->close(true);
+    resetSession();
+    setState(State::Idle);
+    scheduleRetry(nowMs);
+  }
+
+  void begin(Config& cfg, HalDriver* hal) {
+    s_cfg = &cfg;
+    s_hal = hal;
+    char id[16];
+    snprintf(id, sizeof(id), "ezclock_%06lx", (unsigned long)(ESP.getEfuseMac() & 0xFFFFFF));
+    s_id = id;
+    loadSettings();
+    // Initial light color mirrors the persisted default
+    parseHexColor(cfg.led.colorHex, s_light.r, s_light.g, s_light.b);
+    // Broker or topic edits restart the session; step() copies the new settings
+    Config::onChange(Config::MQTT_MASK | Config::NET_MASK, [](const Config&){ reconfigure(); });
+    Config::onChange(Config::bit(Config::Field::led_autoHue), [](const Config& c){ s_autoHue = c.led.autoHue; });
+
+    s_client = new AsyncClient();
+    s_client->setNoDelay(true);
+    s_client->onConnect([](void*, AsyncClient*){ s_evConnected = true; EventLoop::post(EventLoop::Event::Mqtt); });
+    s_client->onDisconnect([](void*, AsyncClient*){ s_evDisconnected = true; EventLoop::post(EventLoop::Event::Mqtt); });
+    s_client->onError([](void*, AsyncClient*, int8_t){ s_evDisconnected = true; EventLoop::post(EventLoop::Event::Mqtt); });
+    s_client->onData(onData);
+    setState(configured() ? State::Idle : State::Disabled);
+    if (s_state == State::Idle) LOGI("MQTT enabled: %s:%u as %s", s_mqtt.host.c_str(), (unsigned)s_mqtt.port, s_id.c_str());
+  }
+
+  void reconfigure() { s_reconfigure = true; }
+
+  bool isConnected() { return s_state == State::Online; }
+
+  uint32_t messagesSent() { return s_sent; }
+
+  static void step() {
+    const uint32_t nowMs = millis();
+
+    if (s_reconfigure) {
+      s_reconfigure = false;
+      if (s_state == State::Online && queueControl(0xE0 /*DISCONNECT*/)) flush();
+      if (s_state != State::Disabled && s_state != State::Idle) s_client->close(true);
+      resetSession();
+      loadSettings();
+      s_backoffMs = 0;
+      s_nextAttemptMs = nowMs;
+      setState(configured() ? State::Idle : State::Disabled);
+      return;
+    }
+    if (s_state == State::Disabled) return;
+
+    if (s_evRx) { s_evRx = false; s_lastRxMs = nowMs; s_pingPending = false; }
+    if (s_evDisconnected) {
+      s_evDisconnected = false;
+      if (s_state != State::Idle) {
+        LOGW("MQTT disconnected");
+        resetSession();
+        setState(State::Idle);
+        scheduleRetry(nowMs);
+      }
+    }
+
+    switch (s_state) {
+      case State::Idle:
+        if (WiFi.status() != WL_CONNECTED) return;
+        if ((int32_t)(nowMs - s_nextAttemptMs) < 0) return;
+        resetSession();
+        // Hostname resolution and TCP connect are asynchronous; completion arrives via s_evConnected
+        if (s_client->connect(s_mqtt.host.c_str(), s_mqtt.port)) {
+          setState(State::Connecting);
+        } else {
+          scheduleRetry(nowMs);
+        }
+        return;
+      case State::Connecting:
+        if (s_evConnected) {
+          s_evConnected = false;
+          queueConnect();
+          flush();
+          setState(State::WaitConnAck);
+        } else if (nowMs - s_stateSinceMs > MQTT_CONNECT_TIMEOUT_MS) {
+          dropConnection(nowMs, "connect timeout");
+        }
+        return;
+      case State::WaitConnAck:
+        if (s_evConnAck) {
+          s_evConnAck = false;
+          s_backoffMs = 0;
+          s_lastRxMs = nowMs;
+          setState(State::Online);
+          LOGI("MQTT online as %s", s_id.c_str());
+        } else if (nowMs - s_stateSinceMs > MQTT_CONNECT_TIMEOUT_MS) {
+          dropConnection(nowMs, "CONNACK timeout");
+        }
+        return;
+      case State::Online:
+        break;
+      default:
+        return;
+    }
+
+    drainInbox();
+
+    // Broker silent for 1.5x keepalive: drop and reconnect
+    if (nowMs - s_lastRxMs > (uint32_t)MQTT_KEEPALIVE_S * 1500UL) {
+      dropConnection(nowMs, "keepalive timeout");
+      return;
+    }
+
+    // Rate-limited batches: everything queued within one window goes out as a single write
+    if (nowMs - s_lastBatchMs < MQTT_MIN_BATCH_MS) return;
+    s_lastBatchMs = nowMs;
+    if (s_txLen == 0) {
+      if (s_sessionStep == 0) {
+        if (queueSubscribe() && queuePublish(topic("/status").c_str(), "online", true)) s_sessionStep++;
+      } else if (s_sessionStep <= 3) {
+        if (queueDiscovery(s_sessionStep - 1)) s_sessionStep++;
+      } else {
+        publishChanges(nowMs);
+        // QoS 0 publishes get no reply: ping when either direction has been quiet,
+        // or steady publishing would starve the keepalive timeout above
+        const uint32_t pingMs = (uint32_t)MQTT_KEEPALIVE_S * 750UL;
+        if (!s_pingPending && (nowMs - s_lastTxMs >= pingMs || nowMs - s_lastRxMs >= pingMs) &&
+            queueControl(0xC0 /*PINGREQ*/))
+          s_pingPending = true;
+      }
+    }
+    flush();
+  }
+
+  // Time until step() next has work; connection progress and inbound data post events
+  static uint32_t untilDue(uint32_t nowMs, uint32_t dueMs) {
+    return (int32_t)(dueMs - nowMs) > 0 ? dueMs - nowMs : 0;
+  }
+
+  // Light state not yet published (set from the web task or by a command)
+  static bool lightChanged() {
+    const LightState& a = s_light;
+    const LightState& p = s_pubLight;
+    return !s_pubLightValid || a.on != p.on || a.bri != p.bri || a.r != p.r || a.g != p.g || a.b != p.b ||
+           s_autoHue != p.autoHue;
+  }
+
+  static uint32_t nextWakeMs(uint32_t nowMs) {
+    switch (s_state) {
+      case State::Idle:
+        if (WiFi.status() != WL_CONNECTED) return MQTT_IDLE_POLL_MS;
+        return untilDue(nowMs, s_nextAttemptMs);
+      case State::Connecting:
+      case State::WaitConnAck:
+        return untilDue(nowMs, s_stateSinceMs + MQTT_CONNECT_TIMEOUT_MS + 1);
+      case State::Online: {
+        // Queued output, session setup, inbound commands or a light change go out with the next batch
+        const bool busy = s_txLen || s_sessionStep <= 3 || s_inCount || lightChanged();
+        const uint32_t toBatch = untilDue(nowMs, s_lastBatchMs + MQTT_MIN_BATCH_MS);
+        uint32_t ms = busy ? toBatch : untilDue(nowMs, s_lastBatchMs + max<uint32_t>(MQTT_MIN_BATCH_MS, MQTT_IDLE_POLL_MS));
+        // Keepalive: the next PINGREQ (sent with a batch) and the broker timeout
+        if (!s_pingPending) {
+          const uint32_t pingMs = (uint32_t)MQTT_KEEPALIVE_S * 750UL;
+          const uint32_t quietMs = max<uint32_t>(nowMs - s_lastTxMs, nowMs - s_lastRxMs);
+          ms = min<uint32_t>(ms, max<uint32_t>(pingMs - min<uint32_t>(quietMs, pingMs), toBatch));
+        }
+        return min<uint32_t>(ms, untilDue(nowMs, s_lastRxMs + (uint32_t)MQTT_KEEPALIVE_S * 1500UL + 1));
+      }
+      default:
+        return UINT32_MAX;
+    }
+  }
+
+  void loop() {
+    if (!s_client) return;
+    step();
+    EventLoop::wakeIn(nextWakeMs(millis()));
+  }
+}
+#else
+// Other targets (ESP8266): no MQTT client, the service stays disabled
+namespace MqttSvc {
+  void begin(Config&, HalDriver*) { LOGW("MQTT not supported on this target"); }
+  void loop() {}
+  void reconfigure() {}
+  bool isConnected() { return false; }
+  uint32_t messagesSent() { return 0; }
+}
+#endif
@@ -0,0 +1,17 @@
+#pragma once
+#include <Arduino.h>
+
+class HalDriver;
+struct Config;
+
+// Non-blocking MQTT client (3.1.1, QoS 0) with Home Assistant discovery.
+// Exposes a light (on/off, brightness, RGB, "autohue" effect) plus ambient and
+// time-sync sensors. All network I/O is asynchronous; loop() never blocks.
+namespace MqttSvc {
+  void begin(Config& cfg, HalDriver* hal);
+  void loop();
+  // Drop the current session and reconnect using the (updated) MqttConfig
+  void reconfigure();
+  bool isConnected();
+  uint32_t messagesSent();
+}
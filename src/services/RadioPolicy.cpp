@@ -0,0 +1,160 @@
+#include "RadioPolicy.hpp"
+#include "Admission.hpp"
+#include "../core/EventLoop.hpp"
+#include "../core/Log.hpp"
+#ifdef ARDUINO_ARCH_ESP32
+  #include <WiFi.h>
+#elif defined(ARDUINO_ARCH_ESP8266)
+  #include <ESP8266WiFi.h>
+#endif
+
+// Tunables (override with -D flags)
+#ifndef RADIO_POWER_SAVE
+#define RADIO_POWER_SAVE 1        // 0 = radio always at full power (previous behaviour)
+#endif
+#ifndef RADIO_UI_HOLD_MS
+#define RADIO_UI_HOLD_MS 30000    // the UI fetches /api/status once on load, then one request per user
+                                  // action (color, save); this bridges the pauses between actions
+#endif
+#ifndef RADIO_IDLE_MS
+#define RADIO_IDLE_MS 10000       // no demand for this long before modem sleep resumes
+#endif
+#ifndef RADIO_MIN_DWELL_MS
+#define RADIO_MIN_DWELL_MS 5000   // minimum time between two switches
+#endif
+
+namespace RadioPolicy {
+  static constexpr uint8_t REASONS = (uint8_t)Reason::Count;
+  static const char* const NAMES[REASONS] = { "ui", "ota", "channel", "ap" };
+
+  static volatile uint32_t s_lastTouchMs = 0;
+  static volatile bool s_ota = false;
+  static volatile uint32_t s_endMs = 0;        // last OTA end or channel close (demand gone between passes)
+  static volatile uint32_t s_requestsSave = 0; // requests that arrived while in modem sleep
+  static volatile uint32_t s_requestsFull = 0;
+  static bool s_started = false;
+  static bool s_save = false;
+  static uint32_t s_switchMs = 0;      // last switch
+  static uint32_t s_lastDemandMs = 0;
+  static uint8_t s_demand = 0;         // bit per Reason, last evaluation
+  static uint32_t s_toSave = 0;
+  static uint32_t s_toFull = 0;
+  static uint64_t s_fullMs = 0;        // closed spans per state
+  static uint64_t s_saveMs = 0;
+  static uint32_t s_wakeBy[REASONS] = {};
+
+  static uint8_t demand(uint32_t nowMs) {
+    uint8_t bits = 0;
+    if (nowMs - s_lastTouchMs < RADIO_UI_HOLD_MS) bits |= 1u << (uint8_t)Reason::Ui;
+    if (s_ota) bits |= 1u << (uint8_t)Reason::Ota;
+    if (Admission::stats().inFlight) bits |= 1u << (uint8_t)Reason::Channel;
+    if (WiFi.getMode() & WIFI_AP) bits |= 1u << (uint8_t)Reason::Ap;
+    return bits;
+  }
+
+  static void apply(bool save, uint32_t nowMs) {
+    (s_save ? s_saveMs : s_fullMs) += nowMs - s_switchMs;
+    s_save = save;
+    s_switchMs = nowMs;
+    WiFi.setSleep(save);
+    EventLoop::allowLightSleep(save); // light sleep needs modem sleep
+  }
+
+  void begin() {
+    const uint32_t nowMs = millis();
+    s_lastTouchMs = nowMs;
+    s_lastDemandMs = nowMs;
+    s_switchMs = nowMs;
+    s_save = false;
+    s_started = true;
+    WiFi.setSleep(false);
+    EventLoop::allowLightSleep(false);
+    LOGI("radio: full power, power save %s", RADIO_POWER_SAVE ? "adaptive" : "off");
+  }
+
+  void loop() {
+    if (!s_started || !RADIO_POWER_SAVE) return;
+    const uint32_t nowMs = millis();
+    s_demand = demand(nowMs);
+    if (s_demand) {
+      s_lastDemandMs = nowMs;
+      if (s_save) {
+        for (uint8_t i = 0; i < REASONS; ++i) if (s_demand & (1u << i)) s_wakeBy[i]++;
+        s_toFull++;
+        apply(false, nowMs);
+        LOGD("radio: full power (demand 0x%02x)", (unsigned)s_demand);
+      }
+    } else if (!s_save) {
+      // Demand that went away between passes lasted until it ended, not until the last pass that saw it:
+      // the UI hold runs out RADIO_UI_HOLD_MS after the last touch, OTA ends and channel closes are stamped
+      const uint32_t uiEndMs = s_lastTouchMs + RADIO_UI_HOLD_MS;
+      if (nowMs - uiEndMs < nowMs - s_lastDemandMs) s_lastDemandMs = uiEndMs;
+      if (nowMs - s_endMs < nowMs - s_lastDemandMs) s_lastDemandMs = s_endMs;
+      // Hysteresis: stay up for RADIO_IDLE_MS after the last demand and RADIO_MIN_DWELL_MS after the last switch
+      const uint32_t idleFor = nowMs - s_lastDemandMs;
+      const uint32_t dwelt = nowMs - s_switchMs;
+      if (idleFor >= RADIO_IDLE_MS && dwelt >= RADIO_MIN_DWELL_MS) {
+        s_toSave++;
+        apply(true, nowMs);
+        LOGD("radio: modem sleep");
+      } else {
+        const uint32_t waitIdle = RADIO_IDLE_MS - (idleFor < RADIO_IDLE_MS ? idleFor : RADIO_IDLE_MS);
+        const uint32_t waitDwell = RADIO_MIN_DWELL_MS - (dwelt < RADIO_MIN_DWELL_MS ? dwelt : RADIO_MIN_DWELL_MS);
+        EventLoop::wakeIn(waitIdle > waitDwell ? waitIdle : waitDwell);
+      }
+    }
+    // UI hold expiry is only noticed here: come back when it lapses
+    if (s_demand & (1u << (uint8_t)Reason::Ui)) EventLoop::wakeIn(RADIO_UI_HOLD_MS - (nowMs - s_lastTouchMs));
+  }
+
+  void touch() {
+    s_lastTouchMs = millis();
+    if (s_save) s_requestsSave++;
+    else s_requestsFull++;
+  }
+
+  uint32_t lastTouchMs() { return s_lastTouchMs; }
+
+  void setOta(bool active) {
+    if (!active && s_ota) s_endMs = millis();
+    s_ota = active;
+    EventLoop::post(EventLoop::Event::Web);
+  }
+
+  void channelClosed() {
+    s_endMs = millis();
+  }
+
+  bool powerSave() { return s_save; }
+
+  void appendJson(String& out) {
+    const uint32_t nowMs = millis();
+    const uint32_t openMs = nowMs - s_switchMs;
+    const uint64_t fullMs = s_fullMs + (s_save ? 0 : openMs);
+    const uint64_t saveMs = s_saveMs + (s_save ? openMs : 0);
+    const uint64_t total = fullMs + saveMs;
+    const uint32_t savePct = total ? (uint32_t)(saveMs * 100ULL / total) : 0;
+    char buf[240];
+    snprintf(buf, sizeof(buf),
+             "{\"enabled\":%s,\"powerSave\":%s,\"sinceMs\":%lu,\"toSave\":%lu,\"toFull\":%lu,"
+             "\"fullMs\":%llu,\"saveMs\":%llu,\"savePct\":%lu,\"requestsSave\":%lu,\"requestsFull\":%lu,\"demand\":[",
+             RADIO_POWER_SAVE ? "true" : "false", s_save ? "true" : "false", (unsigned long)openMs,
+             (unsigned long)s_toSave, (unsigned long)s_toFull,
+             (unsigned long long)fullMs, (unsigned long long)saveMs, (unsigned long)savePct,
+             (unsigned long)s_requestsSave, (unsigned long)s_requestsFull);
+    out += buf;
+    bool first = true;
+    for (uint8_t i = 0; i < REASONS; ++i) {
+      if (!(s_demand & (1u << i))) continue;
+      if (!first) out += ',';
+      out += '"'; out += NAMES[i]; out += '"';
+      first = false;
+    }
+    out += "],\"wakeBy\":{";
+    for (uint8_t i = 0; i < REASONS; ++i) {
+      if (i) out += ',';
+      out += '"'; out += NAMES[i]; out += "\":"; out += String((unsigned long)s_wakeBy[i]);
+    }
+    out += "}}";
+  }
+}
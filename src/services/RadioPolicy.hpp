@@ -0,0 +1,35 @@
+#pragma once
+#include <Arduino.h>
+
+// Adaptive Wi-Fi power save. The radio stays in modem sleep (waking for DTIM
+// beacons) while nobody uses the clock, and runs at full power while there is
+// demand:
+//   Ui      - a non-exempt web request within the last RADIO_UI_HOLD_MS
+//   Ota     - an OTA update in progress (ArduinoOTA or /ManualOTA upload)
+//   Channel - an expensive request (status, settings, CSV/metrics stream) still open
+//   Ap      - the setup soft AP is up (modem sleep only applies to STA mode)
+// Full power starts as soon as demand appears; power save resumes only after
+// RADIO_IDLE_MS without demand (counted from an OTA end or channel close, even
+// if the loop notices later) and RADIO_MIN_DWELL_MS after the last switch.
+// EventLoop light sleep follows power save.
+namespace RadioPolicy {
+  enum class Reason : uint8_t { Ui, Ota, Channel, Ap, Count };
+
+  // After WiFi.mode(); starts at full power
+  void begin();
+  // Loop task: evaluate demand and switch
+  void loop();
+  // Any task: web client activity
+  void touch();
+  // millis() of the last touch()
+  uint32_t lastTouchMs();
+  // Any task: OTA started / finished
+  void setOta(bool active);
+  // Any task: an expensive request finished (after Admission::release())
+  void channelClosed();
+  bool powerSave();
+
+  // {"enabled":..,"powerSave":..,"sinceMs":..,"toSave":..,"toFull":..,"fullMs":..,"saveMs":..,"savePct":..,
+  //  "requestsSave":..,"requestsFull":..,"demand":[..],"wakeBy":{"ui":..,"ota":..,"channel":..,"ap":..}}
+  void appendJson(String& out);
+}
@@ -1,6 +1,7 @@
 #include "TimeService.hpp"
 #include "../core/Config.hpp"
 #include "../core/Log.hpp"
+#include "../core/EventLoop.hpp"
 
 #ifdef ARDUINO_ARCH_ESP32
   #include <WiFi.h>
@@ -8,6 +9,10 @@
   #error "TimeService currently supports ESP32 only"
 #endif
 
+#ifndef TIME_POLL_MS
+#define TIME_POLL_MS 500 // connection / first-sync polling while not yet synced
+#endif
+
 namespace TimeSvc {
   static bool wifiConnected = false;
   static bool synced = false;
@@ -16,6 +21,7 @@ namespace TimeSvc {
   static String tzCached;
   static String ntpCached;
 
+#ifndef FAST_BOOT
   static void ensureWifi(const Config& cfg) {
     if (wifiConnected) return;
     if (cfg.wifi.ssid.isEmpty()) {
@@ -36,6 +42,7 @@ namespace TimeSvc {
       LOGW("WiFi connect timeout");
     }
   }
+#endif
 
   void begin(const Config& cfg) {
     wifiConnected = false;
@@ -44,10 +51,18 @@ namespace TimeSvc {
     lastLog = 0;
     tzCached = cfg.ntp.timezone;
     ntpCached = cfg.ntp.server;
+    // Follow NTP server / timezone edits from the web UI
+    Config::onChange(Config::NTP_MASK, [](const Config& c){
+      applyNtpConfig(c.ntp.server, c.ntp.timezone);
+      LOGI("Timezone set to %s", c.ntp.timezone.c_str());
+    });
     // Apply timezone immediately so localtime() uses it even before sync, and set NTP when Wi‑Fi is ready
     setenv("TZ", tzCached.c_str(), 1);
     tzset();
+#ifndef FAST_BOOT
     ensureWifi(cfg);
+#endif
+    // FAST_BOOT: WebService has already started the STA connect; loop() picks up the connection and starts NTP
     if (wifiConnected) {
       // Configure NTP and timezone together (Arduino helper)
       configTzTime(tzCached.c_str(), ntpCached.c_str());
@@ -70,25 +85,30 @@ namespace TimeSvc {
       LOGI("[DBG] INHIBIT_TIME_SYNC active (simulating unsynced)");
       lastAttempt = msDbg;
     }
+    EventLoop::wakeIn(TIME_POLL_MS);
     return;
     #endif
     // Detect late WiFi connection and start NTP
     if (!wifiConnected && WiFi.status() == WL_CONNECTED) {
       wifiConnected = true;
       LOGI("WiFi connected: %s", WiFi.localIP().toString().c_str());
-      // Re-init NTP with cached config and timezone
+      // Re-init NTP with cached config and timezone (rewritten by the Config subscriber under its lock)
+      Config::Lock lock;
       setenv("TZ", tzCached.c_str(), 1);
       tzset();
       configTzTime(tzCached.c_str(), ntpCached.c_str());
     }
-    if (!wifiConnected) return;
+    if (!wifiConnected) { EventLoop::wakeIn(TIME_POLL_MS); return; }
     if (synced) {
       uint32_t msSync = millis();
-      if (msSync - lastLog >= 10000) {
+      if (msSync - lastLog < 10000) {
+        EventLoop::wakeIn(10000 - (msSync - lastLog));
+      } else {
         lastLog = msSync;
         time_t t = time(nullptr);
         struct tm tmv; localtime_r(&t, &tmv);
         LOGI("Time: %04d-%02d-%02d %02d:%02d:%02d", tmv.tm_year+1900, tmv.tm_mon+1, tmv.tm_mday, tmv.tm_hour, tmv.tm_min, tmv.tm_sec);
+        EventLoop::wakeIn(10000);
       }
       return;
     }
@@ -100,6 +120,7 @@ namespace TimeSvc {
       return;
     }
     // throttle logs/attempts
+    EventLoop::wakeIn(TIME_POLL_MS);
     uint32_t msThrottle = millis();
     if (msThrottle - lastAttempt > 3000) {
       LOGI("Waiting for NTP...");
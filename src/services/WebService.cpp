@@ -1,12 +1,22 @@
 #include "WebService.hpp"
 #include "../core/Log.hpp"
 #include "../core/Config.hpp"
+#include "../core/BootTrace.hpp"
+#include "../core/Perf.hpp"
+#include "../core/HeapTrack.hpp"
+#include "../core/EventLoop.hpp"
 #include "../hal/HalDriver.hpp"
 #include "../ui/WebUI.hpp"
 #include "../services/TimeService.hpp"
+#include "MqttService.hpp"
+#include "HttpMetrics.hpp"
+#include "Admission.hpp"
+#include "AmbientHistory.hpp"
+#include "RadioPolicy.hpp"
 #include <time.h>
 #include <ctype.h>
 #include <functional>
+#include <memory>
 
 #ifdef ARDUINO_ARCH_ESP32
   #include <WiFi.h>
@@ -33,10 +43,95 @@ static Config* g_cfgPtr = nullptr; // to access configuration in WiFi callbacks
 #define LOGV_CMD(...) do { } while(0)
 #endif
 
+static const char* methodName(WebRequestMethodComposite m) {
+  return (m == HTTP_GET) ? "GET" : (m == HTTP_POST) ? "POST" : "ANY";
+}
+
+// Answer a request rejected by admission control without allocating: a
+// prebuilt response is queued straight on the connection (no copy, lwIP
+// references the flash constant) and the connection is closed, which frees
+// the request. No AsyncWebServerResponse or String is created.
+static const char k429Busy[] =
+  "HTTP/1.1 429 Too Many Requests\r\nContent-Type: text/plain\r\nContent-Length: 4\r\n"
+  "Retry-After: 1\r\nConnection: close\r\n\r\nbusy";
+static const char k429Rate[] =
+  "HTTP/1.1 429 Too Many Requests\r\nContent-Type: text/plain\r\nContent-Length: 12\r\n"
+  "Retry-After: 1\r\nConnection: close\r\n\r\nrate limited";
+
+static void rejectFast(AsyncWebServerRequest* req, Admission::Verdict v) {
+  AsyncClient* c = req->client();
+  const bool busy = v == Admission::Verdict::Busy;
+  c->add(busy ? k429Busy : k429Rate, busy ? sizeof(k429Busy) - 1 : sizeof(k429Rate) - 1, 0);
+  c->send();
+  c->close();
+}
+
+// Run a handler behind admission control, per-route metrics (count, latency, heap delta)
+// and the Http stage of the loop profiler
+static void dispatch(const char* uri, uint8_t id, Admission::Cost cost, AsyncWebServerRequest* req, const ArRequestHandlerFunction& fn) {
+  Perf::Scope perf(Perf::Stage::Http, uri);
+  HeapTrack::Scope heapTag(HeapTrack::Tag::Web);
+  HttpMetrics::Scope scope(id);
+  const Admission::Verdict v = Admission::admit((uint32_t)req->client()->remoteIP(), cost);
+  if (v != Admission::Verdict::Admit) { rejectFast(req, v); return; }
+  if (cost == Admission::Cost::Expensive) req->onDisconnect([](){ Admission::release(); RadioPolicy::channelClosed(); });
+  if (cost != Admission::Cost::Exempt) RadioPolicy::touch(); // health probes don't keep the radio up
+  fn(req);
+  // The handler may have changed settings or pushed to the HAL: let the loop apply it now
+  EventLoop::post(EventLoop::Event::Web);
+}
+
+static void route(const char* uri, WebRequestMethodComposite method, Admission::Cost cost, ArRequestHandlerFunction fn) {
+  const uint8_t id = HttpMetrics::registerRoute(uri, methodName(method));
+  server.on(uri, method, [uri, id, cost, fn](AsyncWebServerRequest* req){ dispatch(uri, id, cost, req, fn); });
+}
+
+static void route(const char* uri, WebRequestMethodComposite method, Admission::Cost cost, ArRequestHandlerFunction fn, ArUploadHandlerFunction upload) {
+  const uint8_t id = HttpMetrics::registerRoute(uri, methodName(method));
+  server.on(uri, method, [uri, id, cost, fn](AsyncWebServerRequest* req){ dispatch(uri, id, cost, req, fn); }, upload);
+}
+
+// Send a response and account its payload size to the current route
+static void reply(AsyncWebServerRequest* req, int code, const char* type, const char* body) {
+  HttpMetrics::addResponseBytes(strlen(body));
+  req->send(code, type, body);
+}
+
+static void reply(AsyncWebServerRequest* req, int code, const char* type, const String& body) {
+  HttpMetrics::addResponseBytes(body.length());
+  req->send(code, type, body);
+}
+
+// POST handler that applies form params to registry fields; all values are validated
+// before anything is staged, so a bad value leaves the config untouched
+static void configRoute(const char* uri, Config& cfg, Config::FieldMask fields) {
+  route(uri, HTTP_POST, Admission::Cost::Expensive, [&cfg, fields, uri](AsyncWebServerRequest* req){
+    Config::Lock lock; // MQTT commands commit from the loop task
+    for (int pass = 0; pass < 2; ++pass) {
+      for (uint8_t i = 0; i < (uint8_t)Config::Field::Count; ++i) {
+        const Config::Field f = (Config::Field)i;
+        if (!(fields & Config::bit(f))) continue;
+        const char* key = Config::paramKey(f);
+        if (!req->hasParam(key, true)) continue;
+        const String& v = req->getParam(key, true)->value();
+        if (cfg.set(f, v, pass == 1) == Config::SetResult::Invalid) {
+          reply(req, 400, "application/json", String("{\"ok\":false,\"err\":\"bad ") + key + "\"}");
+          return;
+        }
+      }
+    }
+    LOGV_CMD("UI: POST %s", uri);
+    const bool ok = cfg.commit();
+    reply(req, ok ? 200 : 500, "application/json", ok ? "{\"ok\":true}" : "{\"ok\":false}");
+  });
+}
+
 #ifdef ARDUINO_ARCH_ESP32
 static void onWifiEvent(arduino_event_id_t event, arduino_event_info_t /*info*/){
   LOGI("WiFi event: %d", (int)event);
+  EventLoop::post(EventLoop::Event::Net);
   if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+    BootTrace::mark(BootTrace::Phase::Wifi);
     if (apEnabled) {
       WiFi.softAPdisconnect(true);
       apEnabled = false;
@@ -44,9 +139,14 @@ static void onWifiEvent(arduino_event_id_t event, arduino_event_info_t /*info*/)
     }
     // Start/Restart mDNS with current hostname
     MDNS.end();
-    String host = (g_cfgPtr && g_cfgPtr->net.hostname.length()) ? g_cfgPtr->net.hostname : String("ezQlock");
+    String host("ezQlock");
+    if (g_cfgPtr) {
+      Config::Lock lock;
+      if (g_cfgPtr->net.hostname.length()) host = g_cfgPtr->net.hostname;
+    }
     if (MDNS.begin(host.c_str())) {
       MDNS.addService("http", "tcp", 80);
+      BootTrace::mark(BootTrace::Phase::Mdns);
       LOGI("mDNS started: %s.local", host.c_str());
     } else {
       LOGW("mDNS start failed");
@@ -65,7 +165,7 @@ void WebService::begin(Config& cfg, HalDriver* hal) {
   g_cfgPtr = &cfg;
 
   WiFi.mode(WIFI_AP_STA);
-  WiFi.setSleep(false); // improve responsiveness on C3
+  RadioPolicy::begin(); // full power now; modem sleep once nobody is using the clock
   // Set hostname early for STA
 #ifdef ARDUINO_ARCH_ESP32
   if (!cfg.net.hostname.isEmpty()) {
@@ -95,6 +195,7 @@ void WebService::begin(Config& cfg, HalDriver* hal) {
     LOGW("mDNS start failed; ezclock.local may not resolve");
   } else {
     MDNS.addService("http", "tcp", 80);
+    BootTrace::mark(BootTrace::Phase::Mdns);
     LOGI("mDNS started: http://ezclock.local/");
   }
 #endif
@@ -105,45 +206,33 @@ void WebService::begin(Config& cfg, HalDriver* hal) {
 
   DefaultHeaders::Instance().addHeader("Access-Control-Allow-Origin", "*");
 
-  server.on("/", HTTP_GET, [](AsyncWebServerRequest* req){
+  route("/", HTTP_GET, Admission::Cost::Cheap, [](AsyncWebServerRequest* req){
     LOGV_CMD("UI: GET /");
-    req->send(200, "text/html", WEB_UI);
+    reply(req, 200, "text/html", WEB_UI);
   });
 
-  // Apply saved LED defaults (color and smoothing) at startup
-  if (hal) {
-    // smoothing
-    hal->setSmoothing(cfg.led.fadeMs);
-    // color
-    String hex0 = cfg.led.colorHex;
-    if (hex0.startsWith("#")) hex0.remove(0,1);
-    if (hex0.length() == 6) {
-      long v = strtol(hex0.c_str(), nullptr, 16);
-      uint8_t r = (v >> 16) & 0xFF;
-      uint8_t g = (v >> 8) & 0xFF;
-      uint8_t b = (v >> 0) & 0xFF;
-      hal->fill(r,g,b);
-      hal->show();
-    }
-    // AutoHue
-    hal->setAutoHue(cfg.led.autoHue, cfg.led.autoHueDegPerMin);
-    // Ambient brightness control
-    hal->setAmbientControl(cfg.led.ambientMinPct, cfg.led.ambientMaxPct, cfg.led.ambientFullPowerThreshold);
-    // Ambient sampling parameters
-    hal->setAmbientSampling(cfg.led.ambientSampleMs, cfg.led.ambientAvgCount);
-  }
-
-  server.on("/health", HTTP_GET, [](AsyncWebServerRequest* req){
-    req->send(200, "text/plain", "OK");
+  route("/health", HTTP_GET, Admission::Cost::Exempt, [](AsyncWebServerRequest* req){
+    reply(req, 200, "text/plain", "OK");
   });
 
-  server.on("/heap", HTTP_GET, [](AsyncWebServerRequest* req){
+  route("/heap", HTTP_GET, Admission::Cost::Cheap, [](AsyncWebServerRequest* req){
     char buf[64];
     snprintf(buf, sizeof(buf), "heap=%u", (unsigned)ESP.getFreeHeap());
-    req->send(200, "text/plain", buf);
+    reply(req, 200, "text/plain", buf);
+  });
+
+  // Admission control counters
+  route("/api/admission", HTTP_GET, Admission::Cost::Exempt, [](AsyncWebServerRequest* req){
+    const Admission::Stats st = Admission::stats();
+    char buf[160];
+    snprintf(buf, sizeof(buf),
+             "{\"admitted\":%lu,\"rateLimited\":%lu,\"busy\":%lu,\"inFlight\":%u,\"inFlightPeak\":%u,\"clients\":%u}",
+             (unsigned long)st.admitted, (unsigned long)st.rateLimited, (unsigned long)st.busy,
+             (unsigned)st.inFlight, (unsigned)st.inFlightPeak, (unsigned)st.clients);
+    reply(req, 200, "application/json", buf);
   });
 
-  server.on("/api/status", HTTP_GET, [&cfg](AsyncWebServerRequest* req){
+  route("/api/status", HTTP_GET, Admission::Cost::Expensive, [&cfg](AsyncWebServerRequest* req){
     LOGV_CMD("UI: GET /api/status");
     const bool sta = (WiFi.status() == WL_CONNECTED);
     const String staIp = sta ? WiFi.localIP().toString() : String("");
@@ -156,7 +245,7 @@ void WebService::begin(Config& cfg, HalDriver* hal) {
     snprintf(iso, sizeof(iso), "%04d-%02d-%02dT%02d:%02d:%02d",
              tmv.tm_year+1900, tmv.tm_mon+1, tmv.tm_mday, tmv.tm_hour, tmv.tm_min, tmv.tm_sec);
     String json;
-    json.reserve(320);
+    json.reserve(640);
     json += "{\"ok\":true,\"wifi\":{";
     json += "\"mode\":\"AP_STA\",";
     json += "\"ap_ip\":\"" + apIp + "\",";
@@ -167,191 +256,65 @@ void WebService::begin(Config& cfg, HalDriver* hal) {
     json += "\"synced\":" + String(synced ? "true" : "false") + ",";
     json += "\"epoch\":" + String((unsigned long)now) + ",";
     json += "\"iso\":\""; json += iso; json += "\"},";
-  // NTP configuration (server + timezone)
-  String tz = cfg.ntp.timezone; if (tz.length()==0) tz = "";
-  String ntps = cfg.ntp.server; if (ntps.length()==0) ntps = "";
-  json += "\"ntp\":{";
-  json += "\"server\":\"" + ntps + "\",";
-  json += "\"timezone\":\"" + tz + "\"},";
-    // network info
-    String host = cfg.net.hostname.length() ? cfg.net.hostname : String("ezQlock");
-    json += "\"net\":{\"hostname\":\"" + host + "\"},";
-    String hex = cfg.led.colorHex;
-    if (!hex.startsWith("#")) hex = String("#") + hex;
-    json += "\"led\":{";
-    json += "\"hex\":\"" + hex + "\",";
-  json += "\"fade\":" + String(cfg.led.fadeMs) + ",";
-  json += "\"autoHue\":" + String(cfg.led.autoHue ? "true" : "false") + ",";
-  json += "\"autoHueDegPerMin\":" + String((unsigned)cfg.led.autoHueDegPerMin) + ",";
-  json += "\"ambientMinPct\":" + String((unsigned)cfg.led.ambientMinPct) + ",";
-  json += "\"ambientMaxPct\":" + String((unsigned)cfg.led.ambientMaxPct) + ",";
-  json += "\"ambientFullPowerThreshold\":" + String((unsigned)cfg.led.ambientFullPowerThreshold) + ",";
-  json += "\"ambientSampleMs\":" + String((unsigned)cfg.led.ambientSampleMs) + ",";
-  json += "\"ambientAvgCount\":" + String((unsigned)cfg.led.ambientAvgCount) + "}}";
-    req->send(200, "application/json", json);
+    json += "\"mqttState\":{";
+    json += "\"connected\":" + String(MqttSvc::isConnected() ? "true" : "false") + ",";
+    json += "\"sent\":" + String((unsigned long)MqttSvc::messagesSent()) + "},";
+    // Persisted settings (ntp, net, mqtt, led), generated from the Config registry
+    { Config::Lock lock; cfg.appendJson(json); }
+    json += "}";
+    reply(req, 200, "application/json", json);
   });
 
-  server.on("/api/color", HTTP_GET, [hal](AsyncWebServerRequest* req){
-    if (!req->hasParam("hex")) { req->send(400, "text/plain", "missing hex"); return; }
-    String hex = req->getParam("hex")->value();
-    if (hex.startsWith("#")) hex.remove(0,1);
-    if (hex.length() != 6) { req->send(400, "text/plain", "bad hex"); return; }
-    long v = strtol(hex.c_str(), nullptr, 16);
-    uint8_t r = (v >> 16) & 0xFF;
-    uint8_t g = (v >> 8) & 0xFF;
-    uint8_t b = (v >> 0) & 0xFF;
-    LOGI("/api/color hex=#%s -> rgb(%u,%u,%u)", hex.c_str(), (unsigned)r, (unsigned)g, (unsigned)b);
+  route("/api/color", HTTP_GET, Admission::Cost::Cheap, [hal](AsyncWebServerRequest* req){
+    if (!req->hasParam("hex")) { reply(req, 400, "text/plain", "missing hex"); return; }
+    const String& hex = req->getParam("hex")->value();
+    uint8_t r, g, b;
+    if (!parseHexColor(hex, r, g, b)) { reply(req, 400, "text/plain", "bad hex"); return; }
+    LOGI("/api/color hex=%s -> rgb(%u,%u,%u)", hex.c_str(), (unsigned)r, (unsigned)g, (unsigned)b);
     if (hal) { hal->fill(r,g,b); hal->show(); }
-    req->send(200, "application/json", "{\"ok\":true}");
+    reply(req, 200, "application/json", "{\"ok\":true}");
   });
 
-  // Persist default color
-  server.on("/api/color/default", HTTP_POST, [&cfg, hal](AsyncWebServerRequest* req){
-    String hex = req->hasParam("hex", true) ? req->getParam("hex", true)->value() : String("");
-    hex.trim();
-    if (hex.startsWith("#")) hex.remove(0,1);
-    if (hex.length() != 6) { req->send(400, "application/json", "{\"ok\":false,\"err\":\"bad hex\"}"); return; }
-    LOGV_CMD("UI: POST /api/color/default hex=#%s", hex.c_str());
-    cfg.led.colorHex = String("#") + hex;
-    bool ok = cfg.save();
-    if (hal) {
-      long v = strtol(hex.c_str(), nullptr, 16);
-      uint8_t r = (v >> 16) & 0xFF;
-      uint8_t g = (v >> 8) & 0xFF;
-      uint8_t b = (v >> 0) & 0xFF;
-      hal->fill(r,g,b);
-      hal->show();
-    }
-    req->send(ok ? 200 : 500, "application/json", ok ? "{\"ok\":true}" : "{\"ok\":false}");
-  });
+  // Persisted settings: each route maps its form params onto Config registry fields.
+  // Only fields whose value actually changed are saved and propagated to subscribers.
+  configRoute("/api/color/default", cfg, Config::bit(Config::Field::led_colorHex));
+  configRoute("/api/fade", cfg, Config::bit(Config::Field::led_fadeMs));
+  configRoute("/api/autohue", cfg, Config::bit(Config::Field::led_autoHue) | Config::bit(Config::Field::led_autoHueDegPerMin));
+  configRoute("/api/hostname", cfg, Config::NET_MASK);
+  configRoute("/api/ambient", cfg,
+              Config::bit(Config::Field::led_ambientMinPct) | Config::bit(Config::Field::led_ambientMaxPct) |
+              Config::bit(Config::Field::led_ambientFullPowerThreshold) | Config::bit(Config::Field::led_ambientSampleMs) |
+              Config::bit(Config::Field::led_ambientAvgCount) | Config::bit(Config::Field::led_ambientFilter) |
+              Config::bit(Config::Field::led_ambientCurve));
+  configRoute("/api/palette", cfg,
+              Config::bit(Config::Field::led_paletteMode) | Config::bit(Config::Field::led_colorPrefix) |
+              Config::bit(Config::Field::led_colorMinutes) | Config::bit(Config::Field::led_colorDots));
+  configRoute("/api/wifi", cfg, Config::WIFI_MASK);
+  configRoute("/api/mqtt", cfg, Config::MQTT_MASK);
+  configRoute("/api/timezone", cfg, Config::bit(Config::Field::ntp_timezone));
 
-  // Adjust smoothing time (ms)
-  server.on("/api/fade", HTTP_POST, [&cfg, hal](AsyncWebServerRequest* req){
-    String msStr = req->hasParam("ms", true) ? req->getParam("ms", true)->value() : String("0");
-    uint16_t ms = (uint16_t) msStr.toInt();
-    if (ms > 5000) ms = 5000; // clamp
-    LOGV_CMD("UI: POST /api/fade ms=%u", (unsigned)ms);
-    cfg.led.fadeMs = ms;
-    bool ok = cfg.save();
-    if (hal) hal->setSmoothing(ms);
-    req->send(ok ? 200 : 500, "application/json", ok ? "{\"ok\":true}" : "{\"ok\":false}");
+  // Apply config changes owned by the network layer
+  Config::onChange(Config::WIFI_MASK, [](const Config& c){
+    LOGI("WiFi config saved. ssid='%s' len(pwd)=%u", c.wifi.ssid.c_str(), (unsigned)c.wifi.password.length());
+    WiFi.begin(c.wifi.ssid.c_str(), c.wifi.password.c_str());
   });
-
-  // Update AutoHue settings
-  server.on("/api/autohue", HTTP_POST, [&cfg, hal](AsyncWebServerRequest* req){
-    String enStr = req->hasParam("enabled", true) ? req->getParam("enabled", true)->value() : String("false");
-    String dpmStr = req->hasParam("degPerMin", true) ? req->getParam("degPerMin", true)->value() : String("2");
-    enStr.trim(); dpmStr.trim();
-    bool enabled = (enStr == "1" || enStr.equalsIgnoreCase("true") || enStr == "on");
-    int dpm = dpmStr.toInt();
-    if (dpm < 0) dpm = 0; if (dpm > 360) dpm = 360;
-    LOGV_CMD("UI: POST /api/autohue enabled=%s degPerMin=%d", enabled?"true":"false", dpm);
-    cfg.led.autoHue = enabled;
-    cfg.led.autoHueDegPerMin = (uint16_t)dpm;
-    bool ok = cfg.save();
-    // Apply to HAL immediately
-    if (hal) {
-      hal->setAutoHue(cfg.led.autoHue, cfg.led.autoHueDegPerMin);
-    }
-    // If disabled, immediately apply persisted color frame
-    if (!enabled && hal) {
-      String hex = cfg.led.colorHex; String s = hex;
-      if (s.startsWith("#")) s.remove(0,1);
-      if (s.length() == 6) {
-        long v = strtol(s.c_str(), nullptr, 16);
-        uint8_t r = (v >> 16) & 0xFF;
-        uint8_t g = (v >> 8) & 0xFF;
-        uint8_t b = (v >> 0) & 0xFF;
-        hal->fill(r,g,b); hal->show();
-      }
-    }
-    String resp = String("{\"ok\":") + (ok?"true":"false") + 
-                  ",\"enabled\":" + (cfg.led.autoHue?"true":"false") +
-                  ",\"degPerMin\":" + String((unsigned)cfg.led.autoHueDegPerMin) + "}";
-    req->send(ok ? 200 : 500, "application/json", resp);
-  });
-
-  // Update hostname (persist and apply). Also restarts mDNS if STA has IP.
-  server.on("/api/hostname", HTTP_POST, [&cfg](AsyncWebServerRequest* req){
-    String hn = req->hasParam("hostname", true) ? req->getParam("hostname", true)->value() : String("");
-    hn.trim();
-    // Basic validation: 1..23 chars, alnum & dash only (mDNS label rules)
-    if (hn.length() == 0) hn = "ezQlock";
-    if (hn.length() > 23) hn = hn.substring(0,23);
-    for (size_t i=0;i<hn.length();++i){ char c = hn[i]; if (!(isalnum((unsigned char)c) || c=='-')) { hn.setCharAt(i, '-'); } }
-  LOGV_CMD("UI: POST /api/hostname hostname=%s", hn.c_str());
-    cfg.net.hostname = hn;
-    bool ok = cfg.save();
+  Config::onChange(Config::NET_MASK, [](const Config& c){
 #ifdef ARDUINO_ARCH_ESP32
-    WiFi.setHostname(cfg.net.hostname.c_str());
+    WiFi.setHostname(c.net.hostname.c_str());
 #else
-    WiFi.hostname(cfg.net.hostname);
+    WiFi.hostname(c.net.hostname);
 #endif
     // If STA connected, restart mDNS
     if (WiFi.status() == WL_CONNECTED) {
       MDNS.end();
-      if (MDNS.begin(cfg.net.hostname.c_str())) {
+      if (MDNS.begin(c.net.hostname.c_str())) {
         MDNS.addService("http", "tcp", 80);
       }
     }
-    req->send(ok ? 200 : 500, "application/json", ok ? "{\"ok\":true}" : "{\"ok\":false}");
-  });
-
-  // Update ambient brightness control parameters
-  server.on("/api/ambient", HTTP_POST, [&cfg, hal](AsyncWebServerRequest* req){
-    String minStr = req->hasParam("minPct", true) ? req->getParam("minPct", true)->value() : String("10");
-    String maxStr = req->hasParam("maxPct", true) ? req->getParam("maxPct", true)->value() : String("100");
-    String thrStr = req->hasParam("threshold", true) ? req->getParam("threshold", true)->value() : String("1000");
-    String perStr = req->hasParam("periodMs", true) ? req->getParam("periodMs", true)->value() : String("250");
-    String cntStr = req->hasParam("avgCount", true) ? req->getParam("avgCount", true)->value() : String("20");
-    int minPct = minStr.toInt();
-    int maxPct = maxStr.toInt();
-    int thr = thrStr.toInt();
-    int per = perStr.toInt();
-    int cnt = cntStr.toInt();
-    if (minPct < 0) minPct = 0; if (minPct > 100) minPct = 100;
-    if (maxPct < 0) maxPct = 0; if (maxPct > 100) maxPct = 100;
-    if (maxPct < minPct) maxPct = minPct; // ensure ordering
-    if (thr < 0) thr = 0; if (thr > 4095) thr = 4095;
-    if (per < 50) per = 50; if (per > 5000) per = 5000;
-    if (cnt < 1) cnt = 1; if (cnt > 60) cnt = 60;
-    LOGV_CMD("UI: POST /api/ambient min=%d max=%d thr=%d periodMs=%d avgCount=%d", minPct, maxPct, thr, per, cnt);
-    cfg.led.ambientMinPct = (uint8_t)minPct;
-    cfg.led.ambientMaxPct = (uint8_t)maxPct;
-    cfg.led.ambientFullPowerThreshold = (uint16_t)thr;
-    cfg.led.ambientSampleMs = (uint16_t)per;
-    cfg.led.ambientAvgCount = (uint8_t)cnt;
-    bool ok = cfg.save();
-    if (hal) {
-      hal->setAmbientControl(cfg.led.ambientMinPct, cfg.led.ambientMaxPct, cfg.led.ambientFullPowerThreshold);
-      hal->setAmbientSampling(cfg.led.ambientSampleMs, cfg.led.ambientAvgCount);
-    }
-    req->send(ok ? 200 : 500, "application/json", ok ? "{\"ok\":true}" : "{\"ok\":false}");
-  });
-
-  server.on("/api/wifi", HTTP_POST, [&cfg](AsyncWebServerRequest* req){
-    String ssid;
-    String password;
-    if (req->hasParam("ssid", true)) ssid = req->getParam("ssid", true)->value();
-    if (req->hasParam("password", true)) password = req->getParam("password", true)->value();
-    ssid.trim();
-    LOGV_CMD("UI: POST /api/wifi ssid='%s' pwd.len=%u", ssid.c_str(), (unsigned)password.length());
-    if (ssid.length() == 0) { req->send(400, "application/json", "{\"ok\":false,\"err\":\"empty ssid\"}"); return; }
-    cfg.wifi.ssid = ssid;
-    cfg.wifi.password = password;
-    bool ok = cfg.save();
-    LOGI("WiFi config saved. ssid='%s' len(pwd)=%u", ssid.c_str(), (unsigned)password.length());
-    if (ok) {
-      // Try to connect STA
-      WiFi.begin(cfg.wifi.ssid.c_str(), cfg.wifi.password.c_str());
-      req->send(200, "application/json", "{\"ok\":true}");
-    } else {
-      req->send(500, "application/json", "{\"ok\":false}");
-    }
   });
 
   // Scan nearby Wi‑Fi networks
-  server.on("/api/wifi/scan", HTTP_GET, [](AsyncWebServerRequest* req){
+  route("/api/wifi/scan", HTTP_GET, Admission::Cost::Expensive, [](AsyncWebServerRequest* req){
     LOGV_CMD("UI: GET /api/wifi/scan");
     // Synchronous scan; typical duration ~1-3s
     int n = WiFi.scanNetworks(/*async=*/false, /*hidden=*/true);
@@ -376,25 +339,11 @@ void WebService::begin(Config& cfg, HalDriver* hal) {
     json += "]}";
     // Free scan results
     WiFi.scanDelete();
-    req->send(200, "application/json", json);
-  });
-
-  server.on("/api/timezone", HTTP_POST, [&cfg](AsyncWebServerRequest* req){
-    String tz;
-    if (req->hasParam("tz", true)) tz = req->getParam("tz", true)->value();
-    tz.trim();
-    if (tz.isEmpty()) { req->send(400, "application/json", "{\"ok\":false,\"err\":\"empty tz\"}"); return; }
-    LOGV_CMD("UI: POST /api/timezone tz=%s", tz.c_str());
-    cfg.ntp.timezone = tz;
-    bool ok = cfg.save();
-    // Apply immediately and update TimeSvc cache so reconnects keep this TZ
-    TimeSvc::applyNtpConfig(cfg.ntp.server, cfg.ntp.timezone);
-    LOGI("Timezone set to %s", cfg.ntp.timezone.c_str());
-    req->send(ok ? 200 : 500, "application/json", ok ? "{\"ok\":true}" : "{\"ok\":false}");
+    reply(req, 200, "application/json", json);
   });
 
   // Read current ambient ADC value from the driver (if supported)
-  server.on("/api/ambient/read", HTTP_GET, [hal](AsyncWebServerRequest* req){
+  route("/api/ambient/read", HTTP_GET, Admission::Cost::Cheap, [hal](AsyncWebServerRequest* req){
     LOGV_CMD("UI: GET /api/ambient/read");
     uint16_t raw = 0, avg = 0;
     bool have = false;
@@ -402,12 +351,122 @@ void WebService::begin(Config& cfg, HalDriver* hal) {
       have = hal->getAmbientReading(raw, avg);
     }
     String json = String("{\"ok\":true,\"supported\":") + (have?"true":"false") + ",\"raw\":" + String(raw) + ",\"avg\":" + String(avg) + "}";
-    req->send(200, "application/json", json);
+    reply(req, 200, "application/json", json);
+  });
+
+  // Ambient history as CSV: res=1m (24 h of minute means, default) or res=10m (7 days)
+  route("/api/ambient/history", HTTP_GET, Admission::Cost::Expensive, [](AsyncWebServerRequest* req){
+    const bool tenMin = req->hasParam("res") && req->getParam("res")->value() == "10m";
+    auto cursor = std::make_shared<AmbientHistory::Cursor>();
+    AmbientHistory::beginCsv(*cursor, tenMin ? AmbientHistory::Series::TenMinute : AmbientHistory::Series::Minute);
+    req->send(req->beginChunkedResponse("text/csv", [cursor](uint8_t* buf, size_t maxLen, size_t){
+      return AmbientHistory::renderChunk(*cursor, buf, maxLen);
+    }));
+  });
+
+  // Recent log lines (drained output, oldest first)
+  route("/api/log", HTTP_GET, Admission::Cost::Expensive, [](AsyncWebServerRequest* req){
+#ifdef LOG_BINARY
+    // Raw frames; decode with tools/logdecode.py
+    reply(req, 200, "application/octet-stream", Log::tail());
+#else
+    reply(req, 200, "text/plain", Log::tail());
+#endif
+  });
+
+  // Runtime log level (0 = off .. 4 = debug, capped at the compiled LOG_LEVEL) and logger counters
+  route("/api/log/level", HTTP_POST, Admission::Cost::Cheap, [](AsyncWebServerRequest* req){
+    if (req->hasParam("level", true)) {
+      Log::setLevel((uint8_t)constrain((int)req->getParam("level", true)->value().toInt(), 0, 4));
+    }
+    const Log::Stats st = Log::stats();
+    char buf[96];
+    snprintf(buf, sizeof(buf), "{\"ok\":true,\"level\":%u,\"written\":%lu,\"dropped\":%lu,\"highWater\":%u}",
+             (unsigned)Log::level(), (unsigned long)st.written, (unsigned long)st.dropped, (unsigned)st.highWater);
+    reply(req, 200, "application/json", buf);
+  });
+
+  // Heap health: min free, largest block, fragmentation and per-subsystem allocation counts
+  route("/api/heap", HTTP_GET, Admission::Cost::Cheap, [](AsyncWebServerRequest* req){
+    String json; json.reserve(640);
+    HeapTrack::appendJson(json);
+    reply(req, 200, "application/json", json);
+  });
+
+  // Render-pipeline telemetry from the display driver (if supported)
+  route("/api/hal/telemetry", HTTP_GET, Admission::Cost::Cheap, [hal](AsyncWebServerRequest* req){
+    HalTelemetry t{};
+    const bool have = hal && hal->getTelemetry(t);
+    char buf[400];
+    snprintf(buf, sizeof(buf),
+             "{\"supported\":%s,\"framesRendered\":%lu,\"framesShown\":%lu,\"showMeanUs\":%lu,\"showMaxUs\":%lu,"
+             "\"transitions\":%lu,\"lastFadeFrames\":%u,\"meanFadeFrames\":%u,\"lateFrames\":%lu,"
+             "\"fadeGapMeanUs\":%lu,\"fadeGapMaxUs\":%lu,\"fadeJitterUs\":%lu,\"brightness\":%u}",
+             have ? "true" : "false", (unsigned long)t.framesRendered, (unsigned long)t.framesShown,
+             (unsigned long)t.showMeanUs, (unsigned long)t.showMaxUs, (unsigned long)t.transitions,
+             (unsigned)t.lastFadeFrames, (unsigned)t.meanFadeFrames, (unsigned long)t.lateFrames,
+             (unsigned long)t.fadeGapMeanUs, (unsigned long)t.fadeGapMaxUs, (unsigned long)t.fadeJitterUs, (unsigned)t.brightness);
+    reply(req, 200, "application/json", buf);
+  });
+
+  // Loop profiler: per-stage timing histograms and budget violations
+  route("/api/perf", HTTP_GET, Admission::Cost::Cheap, [](AsyncWebServerRequest* req){
+    String json; json.reserve(1024);
+    Perf::appendJson(json);
+    reply(req, 200, "application/json", json);
+  });
+
+  route("/api/perf/budget", HTTP_POST, Admission::Cost::Cheap, [](AsyncWebServerRequest* req){
+    if (!req->hasParam("stage", true) || !req->hasParam("us", true)) {
+      reply(req, 400, "application/json", "{\"ok\":false,\"err\":\"missing stage/us\"}");
+      return;
+    }
+    const long us = req->getParam("us", true)->value().toInt();
+    const bool ok = us >= 0 && Perf::setBudget(req->getParam("stage", true)->value().c_str(), (uint32_t)us);
+    reply(req, ok ? 200 : 400, "application/json", ok ? "{\"ok\":true}" : "{\"ok\":false,\"err\":\"bad stage\"}");
+  });
+
+  route("/api/perf/reset", HTTP_POST, Admission::Cost::Cheap, [](AsyncWebServerRequest* req){
+    Perf::reset();
+    reply(req, 200, "application/json", "{\"ok\":true}");
+  });
+
+  // Main-loop wakeups per cause and per minute, light-sleep state
+  route("/api/loop", HTTP_GET, Admission::Cost::Cheap, [](AsyncWebServerRequest* req){
+    String json; json.reserve(400);
+    EventLoop::appendJson(json);
+    reply(req, 200, "application/json", json);
+  });
+
+  // Radio power state, switches and duty cycle
+  route("/api/radio", HTTP_GET, Admission::Cost::Cheap, [](AsyncWebServerRequest* req){
+    String json; json.reserve(320);
+    RadioPolicy::appendJson(json);
+    reply(req, 200, "application/json", json);
+  });
+
+  // Boot-phase timestamps
+  route("/api/boot", HTTP_GET, Admission::Cost::Cheap, [](AsyncWebServerRequest* req){
+    String json; json.reserve(160);
+    BootTrace::appendJson(json);
+    reply(req, 200, "application/json", json);
+  });
+
+  // Prometheus exposition of the per-route counters, streamed line by line
+  route("/metrics", HTTP_GET, Admission::Cost::Expensive, [](AsyncWebServerRequest* req){
+    auto cursor = std::make_shared<HttpMetrics::Cursor>();
+    req->send(req->beginChunkedResponse("text/plain; version=0.0.4", [cursor](uint8_t* buf, size_t maxLen, size_t){
+      return HttpMetrics::renderChunk(*cursor, buf, maxLen);
+    }));
   });
 
   // Register OTA routes before starting the server
   setupManualOTA();
-  server.onNotFound([](AsyncWebServerRequest* req){ req->send(404, "text/plain", "Not found"); });
+  static const uint8_t notFoundId = HttpMetrics::registerRoute("(not_found)", "ANY");
+  server.onNotFound([](AsyncWebServerRequest* req){
+    HttpMetrics::Scope scope(notFoundId);
+    reply(req, 404, "text/plain", "Not found");
+  });
   server.begin();
 }
 
@@ -422,8 +481,8 @@ void WebService::loop() {
 
 void WebService::setupManualOTA() {
 #ifdef ARDUINO_ARCH_ESP32
-  server.on("/ManualOTA", HTTP_GET, [](AsyncWebServerRequest* req){
-    req->send(200, "text/html",
+  route("/ManualOTA", HTTP_GET, Admission::Cost::Exempt, [](AsyncWebServerRequest* req){
+    reply(req, 200, "text/html",
       "<h2>Manual OTA Update</h2>"
       "<form method='POST' action='/ManualOTA' enctype='multipart/form-data'>"
       "<input type='file' name='firmware'>"
@@ -431,17 +490,21 @@ void WebService::setupManualOTA() {
       "</form>"
     );
   });
-  server.on("/ManualOTA", HTTP_POST,
+  route("/ManualOTA", HTTP_POST, Admission::Cost::Exempt,
     [](AsyncWebServerRequest* req){
       bool ok = !Update.hasError();
-      req->send(200, "text/html", ok ? "Update Success. Rebooting..." : "Update Failed!");
+      reply(req, 200, "text/html", ok ? "Update Success. Rebooting..." : "Update Failed!");
       if (ok) {
         delay(1000);
         ESP.restart();
       }
     },
     [](AsyncWebServerRequest* req, String filename, size_t index, uint8_t *data, size_t len, bool final){
+      HeapTrack::Scope heapTag(HeapTrack::Tag::Ota);
       if (!index) {
+        // Exempt route: dispatch() did not claim onDisconnect
+        RadioPolicy::setOta(true);
+        req->onDisconnect([](){ RadioPolicy::setOta(false); });
         Update.begin(UPDATE_SIZE_UNKNOWN);
       }
       Update.write(data, len);
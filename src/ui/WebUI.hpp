@@ -64,6 +64,22 @@ static const char WEB_UI[] PROGMEM = R"HTML(
       <input id="autohue_dpm" type="number" min="0" max="360" step="1" value="2" style="width:5rem;" />
       <button onclick="saveAutoHue()">Save</button>
     </div>
+    <div class="row" style="display:flex;align-items:center;gap:.5rem;flex-wrap:wrap;">
+      <label for="pal_mode">Word colors</label>
+      <select id="pal_mode">
+        <option value="0">Single color</option>
+        <option value="1">Per word group</option>
+        <option value="2">Gradient</option>
+      </select>
+      <label for="pal_pre">Prefix</label>
+      <input id="pal_pre" type="color" value="#ffffff" />
+      <label for="pal_min">Minutes / gradient end</label>
+      <input id="pal_min" type="color" value="#33ccff" />
+      <label for="pal_dot">Dots</label>
+      <input id="pal_dot" type="color" value="#ff9933" />
+      <button onclick="savePalette()">Save</button>
+    </div>
+    <small>Hours use the main color (and follow AutoHue).</small>
   </div>
   <fieldset class="row">
     <legend>Ambient brightness</legend>
@@ -78,11 +94,30 @@ static const char WEB_UI[] PROGMEM = R"HTML(
       <input id="amb_ms" type="number" min="50" max="5000" step="50" value="250" style="width:6rem;" />
       <label for="amb_cnt">Avg count</label>
       <input id="amb_cnt" type="number" min="1" max="60" step="1" value="20" style="width:5rem;" />
+      <label for="amb_flt">Filter</label>
+      <select id="amb_flt">
+        <option value="0">Average</option>
+        <option value="1">EMA</option>
+        <option value="2">Median</option>
+      </select>
+      <label for="amb_crv">Curve</label>
+      <select id="amb_crv">
+        <option value="0">Linear</option>
+        <option value="1">Gamma 2.2</option>
+        <option value="2">CIE L*</option>
+      </select>
       <button onclick="saveAmbient()">Save</button>
       <button onclick="readAmbient()">Read now</button>
       <span id="amb_readout" style="opacity:.8;"></span>
     </div>
     <small>Below threshold → Max brightness. Above threshold → brightness scales down to Min by 4095.</small>
+    <div class="row" style="display:flex;align-items:center;gap:.5rem;">
+      <strong>History</strong>
+      <button onclick="loadAmbientHistory('1m')">24 h</button>
+      <button onclick="loadAmbientHistory('10m')">7 days</button>
+      <span id="amb_hist_info" style="opacity:.8;"></span>
+    </div>
+    <canvas id="amb_hist" width="600" height="140" style="width:100%;max-width:600px;border:1px solid #ddd;border-radius:4px;"></canvas>
   </fieldset>
   <fieldset class="row">
     <legend>Wi‑Fi</legend>
@@ -96,6 +131,16 @@ static const char WEB_UI[] PROGMEM = R"HTML(
     <div class="row"><button onclick="saveWifi()">Save Wi‑Fi</button></div>
     <small>Device stays in AP+STA; after saving, it will try to connect to your Wi‑Fi.</small>
   </fieldset>
+  <fieldset class="row">
+    <legend>MQTT / Home Assistant</legend>
+    <div class="row"><label for="mq_en">Enabled</label> <input id="mq_en" type="checkbox"> <span id="mq_state" style="opacity:.8;"></span></div>
+    <div class="row"><label for="mq_host">Broker</label> <input id="mq_host" type="text" placeholder="192.168.1.10"> <input id="mq_port" type="number" min="1" max="65535" value="1883" style="width:6rem;"></div>
+    <div class="row"><label for="mq_user">User</label> <input id="mq_user" type="text"></div>
+    <div class="row"><label for="mq_pass">Password</label> <input id="mq_pass" type="password" placeholder="(unchanged)"></div>
+    <div class="row"><label for="mq_base">Base topic</label> <input id="mq_base" type="text" placeholder="ezclock"></div>
+    <div class="row"><button onclick="saveMqtt()">Save MQTT</button></div>
+    <small>Entities are announced through Home Assistant MQTT discovery.</small>
+  </fieldset>
   <fieldset class="row">
     <legend>Time & Network</legend>
     <div class="row"><label for="hostname">Hostname</label> <input id="hostname" type="text" placeholder="ezQlock"></div>
@@ -248,6 +293,19 @@ static const char WEB_UI[] PROGMEM = R"HTML(
             document.getElementById('autohue_dpm').value = js.led.autoHueDegPerMin;
           }
           applyAutoHueUI();
+          if (typeof js.led.paletteMode === 'number') document.getElementById('pal_mode').value = js.led.paletteMode;
+          if (typeof js.led.colorPrefix === 'string') document.getElementById('pal_pre').value = js.led.colorPrefix.toLowerCase();
+          if (typeof js.led.colorMinutes === 'string') document.getElementById('pal_min').value = js.led.colorMinutes.toLowerCase();
+          if (typeof js.led.colorDots === 'string') document.getElementById('pal_dot').value = js.led.colorDots.toLowerCase();
+        }
+        if (js && js.mqtt){
+          document.getElementById('mq_en').checked = !!js.mqtt.enabled;
+          document.getElementById('mq_host').value = js.mqtt.host || '';
+          document.getElementById('mq_port').value = js.mqtt.port || 1883;
+          document.getElementById('mq_user').value = js.mqtt.user || '';
+          document.getElementById('mq_base').value = js.mqtt.baseTopic || 'ezclock';
+          const up = js.mqttState && js.mqttState.connected;
+          document.getElementById('mq_state').textContent = js.mqtt.enabled ? (up ? 'connected' : 'not connected') : '';
         }
         if (js && js.ntp && typeof js.ntp.timezone === 'string'){
           document.getElementById('tz').value = js.ntp.timezone;
@@ -258,6 +316,8 @@ static const char WEB_UI[] PROGMEM = R"HTML(
           if (typeof js.led.ambientFullPowerThreshold === 'number') document.getElementById('amb_thr').value = js.led.ambientFullPowerThreshold;
           if (typeof js.led.ambientSampleMs === 'number') document.getElementById('amb_ms').value = js.led.ambientSampleMs;
           if (typeof js.led.ambientAvgCount === 'number') document.getElementById('amb_cnt').value = js.led.ambientAvgCount;
+          if (typeof js.led.ambientFilter === 'number') document.getElementById('amb_flt').value = js.led.ambientFilter;
+          if (typeof js.led.ambientCurve === 'number') document.getElementById('amb_crv').value = js.led.ambientCurve;
         }
       } catch(e) {
         console.warn('[UI] loadStatus error', e);
@@ -285,6 +345,23 @@ static const char WEB_UI[] PROGMEM = R"HTML(
       }
     }
 
+    async function savePalette(){
+      const body = new URLSearchParams({
+        mode: document.getElementById('pal_mode').value,
+        prefix: document.getElementById('pal_pre').value,
+        minutes: document.getElementById('pal_min').value,
+        dots: document.getElementById('pal_dot').value
+      });
+      try {
+        const res = await fetch('/api/palette', { method: 'POST', headers: { 'Content-Type':'application/x-www-form-urlencoded' }, body });
+        if (!res.ok) throw new Error(await res.text());
+        alert('Word colors saved.');
+      } catch(e){
+        console.error('[UI] /api/palette error', e);
+        alert('Failed to save word colors');
+      }
+    }
+
   // initialize preview on load and fetch status
     updatePreview();
     loadStatus();
@@ -383,6 +460,25 @@ static const char WEB_UI[] PROGMEM = R"HTML(
       }
     }
 
+    async function saveMqtt(){
+      const body = new URLSearchParams({
+        enabled: document.getElementById('mq_en').checked,
+        host: document.getElementById('mq_host').value.trim(),
+        port: document.getElementById('mq_port').value,
+        user: document.getElementById('mq_user').value,
+        pass: document.getElementById('mq_pass').value,
+        baseTopic: document.getElementById('mq_base').value.trim()
+      });
+      try {
+        const res = await fetch('/api/mqtt', { method: 'POST', headers: { 'Content-Type':'application/x-www-form-urlencoded' }, body });
+        console.log('[UI] /api/mqtt', res.status);
+        alert(res.ok ? 'MQTT settings saved.' : 'Failed to save MQTT settings');
+      } catch(e){
+        console.error('[UI] /api/mqtt error', e);
+        alert('Error while saving MQTT settings');
+      }
+    }
+
     async function saveAmbient(){
       let minPct = parseInt(document.getElementById('amb_min').value,10);
       let maxPct = parseInt(document.getElementById('amb_max').value,10);
@@ -396,7 +492,9 @@ static const char WEB_UI[] PROGMEM = R"HTML(
       threshold = Math.min(4095, Math.max(0, threshold));
       periodMs = Math.min(5000, Math.max(50, periodMs));
       avgCount = Math.min(60, Math.max(1, avgCount));
-      const body = new URLSearchParams({ minPct, maxPct, threshold, periodMs, avgCount });
+      const filter = document.getElementById('amb_flt').value;
+      const curve = document.getElementById('amb_crv').value;
+      const body = new URLSearchParams({ minPct, maxPct, threshold, periodMs, avgCount, filter, curve });
       try {
         const res = await fetch('/api/ambient', { method: 'POST', headers: { 'Content-Type':'application/x-www-form-urlencoded' }, body });
         const ok = res.ok;
@@ -408,6 +506,36 @@ static const char WEB_UI[] PROGMEM = R"HTML(
       }
     }
 
+    // Plot the ambient history CSV (age_s,value) with the full-power threshold as a reference line
+    async function loadAmbientHistory(res){
+      const info = document.getElementById('amb_hist_info');
+      const cv = document.getElementById('amb_hist');
+      const g = cv.getContext('2d');
+      g.clearRect(0, 0, cv.width, cv.height);
+      info.textContent = '…';
+      try {
+        const r = await fetch('/api/ambient/history?res=' + res);
+        if (!r.ok) throw new Error(await r.text());
+        const rows = (await r.text()).trim().split('\n').slice(1).map(l => l.split(',').map(Number));
+        if (!rows.length) { info.textContent = 'no data yet'; return; }
+        const span = Math.max(rows[0][0], 1);
+        const x = age => cv.width - 1 - (age / span) * (cv.width - 2);
+        const y = v => cv.height - 1 - (v / 4095) * (cv.height - 2);
+        const thr = parseInt(document.getElementById('amb_thr').value, 10);
+        if (!isNaN(thr)) {
+          g.strokeStyle = '#e88'; g.beginPath(); g.moveTo(0, y(thr)); g.lineTo(cv.width, y(thr)); g.stroke();
+        }
+        g.strokeStyle = '#36c'; g.beginPath();
+        rows.forEach(([age, v], i) => i ? g.lineTo(x(age), y(v)) : g.moveTo(x(age), y(v)));
+        g.stroke();
+        const vals = rows.map(r => r[1]);
+        info.textContent = `${rows.length} points, min=${Math.min(...vals)} max=${Math.max(...vals)}`;
+      } catch(e){
+        console.error('[UI] /api/ambient/history error', e);
+        info.textContent = 'error';
+      }
+    }
+
     async function readAmbient(){
       const out = document.getElementById('amb_readout');
       out.textContent = '…';
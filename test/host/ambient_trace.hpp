@@ -0,0 +1,57 @@
+#pragma once
+// Ambient light ADC traces for the sampler and brightness tests.
+// The built-in trace is synthetic, shaped after what the photoresistor divider
+// on A2 reads indoors: slow daylight drift, lamp switching steps, sample noise
+// of a few counts and isolated spikes (flicker caught at the wrong phase).
+// Set AMBIENT_TRACE=<file> to replay a recorded trace instead: one ADC value
+// per line, optionally as the last comma-separated field ("t,value"); lines
+// that do not end in a number (headers) are skipped.
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+namespace AmbientTrace {
+  // One sample per periodMs over the given duration
+  inline std::vector<uint16_t> synthetic(uint32_t seconds, uint32_t periodMs, uint32_t seed = 1) {
+    std::vector<uint16_t> out;
+    uint32_t rng = seed;
+    auto uniform = [&rng]() { rng = rng * 1664525u + 1013904223u; return (rng >> 8) / 16777216.0f; };
+    const uint32_t n = seconds * 1000 / periodMs;
+    out.reserve(n);
+    float lamp = 0;
+    for (uint32_t i = 0; i < n; ++i) {
+      const float t = (float)i * periodMs / 1000.0f;
+      // Daylight: 300..2300 counts over a 2 h cycle
+      const float day = 1300.0f + 1000.0f * sinf(t * 6.2831853f / 7200.0f);
+      // A lamp toggled roughly every 10 minutes adds 900 counts
+      if (uniform() < periodMs / 600000.0f) lamp = lamp > 0 ? 0 : 900.0f;
+      // Triangular noise, +-12 counts
+      float v = day + lamp + 12.0f * (uniform() + uniform() - 1.0f);
+      if (uniform() < 0.004f) v += uniform() < 0.5f ? 1500.0f : -800.0f; // isolated spike
+      out.push_back((uint16_t)(v < 0 ? 0 : (v > 4095 ? 4095 : v)));
+    }
+    return out;
+  }
+
+  // AMBIENT_TRACE if set, the synthetic trace otherwise
+  inline std::vector<uint16_t> load(uint32_t seconds, uint32_t periodMs) {
+    const char* path = getenv("AMBIENT_TRACE");
+    if (!path) return synthetic(seconds, periodMs);
+    std::vector<uint16_t> out;
+    FILE* f = fopen(path, "r");
+    if (!f) { perror(path); exit(2); }
+    char line[128];
+    while (fgets(line, sizeof(line), f)) {
+      const char* field = line;
+      for (const char* p = line; *p; ++p) if (*p == ',') field = p + 1;
+      char* end;
+      const long v = strtol(field, &end, 10);
+      if (end != field && v >= 0 && v <= 4095) out.push_back((uint16_t)v);
+    }
+    fclose(f);
+    printf("replaying %zu samples from %s\n", out.size(), path);
+    return out;
+  }
+}
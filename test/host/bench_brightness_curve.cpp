@@ -0,0 +1,45 @@
+// Per-sample cost of mapping an ambient ADC value to a brightness: the table
+// lookup against the float interpolation it replaced and against evaluating
+// the perceptual curves per sample. The ESP32-C3 has no FPU, so the float
+// paths cost far more there than on the host.
+#include "hal/BrightnessCurve.hpp"
+#include "host_test.hpp"
+
+static uint8_t floatLinear(uint16_t a, uint8_t minPct, uint8_t maxPct, uint16_t thr) {
+  if (a <= thr) return (uint8_t)lroundf((maxPct / 100.0f) * 255.0f);
+  const float t = (float)(a - thr) / (float)(4095 - thr);
+  const float pct = (float)maxPct + t * ((float)minPct - (float)maxPct);
+  return (uint8_t)lroundf((pct / 100.0f) * 255.0f);
+}
+
+static uint8_t floatCurve(uint16_t a, uint8_t minPct, uint8_t maxPct, uint16_t thr, BrightnessCurve::Curve c) {
+  float level = maxPct;
+  if (a > thr) level = (float)maxPct + (float)(a - thr) / (float)(4095 - thr) * ((float)minPct - (float)maxPct);
+  return (uint8_t)lroundf(BrightnessCurve::duty(level, c) * 255.0f);
+}
+
+int main() {
+  const uint32_t N = 20000000;
+  // ADC values spread over the range, above and below the threshold
+  auto adc = [](uint32_t i) { return (uint16_t)((i * 2654435761u) >> 20); };
+  uint8_t lut[BrightnessCurve::LUT_SIZE];
+  const double build = HostTest::nsPerCall(2000, [&](uint32_t i) {
+    BrightnessCurve::build(lut, 10, 100, (uint16_t)(1000 + (i & 1)), BrightnessCurve::CieL);
+    KEEP(lut[0]);
+  });
+  BrightnessCurve::build(lut, 10, 100, 1000, BrightnessCurve::CieL);
+  const double table = HostTest::nsPerCall(N, [&](uint32_t i) { KEEP(BrightnessCurve::lookup(lut, adc(i))); });
+  const double linear = HostTest::nsPerCall(N, [&](uint32_t i) { KEEP(floatLinear(adc(i), 10, 100, 1000)); });
+  const double gamma = HostTest::nsPerCall(N / 4, [&](uint32_t i) {
+    KEEP(floatCurve(adc(i), 10, 100, 1000, BrightnessCurve::Gamma));
+  });
+  const double cie = HostTest::nsPerCall(N / 4, [&](uint32_t i) {
+    KEEP(floatCurve(adc(i), 10, 100, 1000, BrightnessCurve::CieL));
+  });
+  printf("table lookup        %6.2f ns/sample\n", table);
+  printf("float linear (old)  %6.2f ns/sample\n", linear);
+  printf("float gamma 2.2     %6.2f ns/sample\n", gamma);
+  printf("float CIE L*        %6.2f ns/sample\n", cie);
+  printf("table rebuild       %6.2f us (on settings change)\n", build / 1000);
+  return HostTest::done();
+}
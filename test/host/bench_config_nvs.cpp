@@ -0,0 +1,118 @@
+// Config persistence: the single CRC-checked record against the per-field keys
+// it replaced. Reports NVS key searches, entries written and entries used per
+// load/save (the flash-bound costs on the device) and the host time of each.
+// Also checks migration from the per-field keys and the corrupt-record fallback.
+#include "core/Config.cpp"
+#include "host_test.hpp"
+
+// Per-field save as done before the single record
+static void legacyPut(Preferences& p, const char* key, const String& v) { p.putString(key, v); }
+static void legacyPut(Preferences& p, const char* key, bool v) { p.putBool(key, v); }
+static void legacyPut(Preferences& p, const char* key, uint8_t v) { p.putUChar(key, v); }
+static void legacyPut(Preferences& p, const char* key, uint16_t v) { p.putUShort(key, v); }
+#define EZ_CFG_LEGACY_PUT(g, m, kind, def, lo, hi, json, param, legacy) legacyPut(p, legacy, c.g.m);
+
+static void saveLegacy(const Config& c) {
+  Preferences p;
+  p.begin(NS, false);
+  EZ_CONFIG_FIELDS(EZ_CFG_LEGACY_PUT)
+  p.end();
+}
+
+static void readLegacy(Config& c) {
+  Preferences p;
+  p.begin(NS, true);
+  loadLegacy(p, c);
+  p.end();
+}
+
+// A typical configured clock
+static Config sample() {
+  Config c;
+  c.wifi.ssid = "HomeNetwork";
+  c.wifi.password = "correct horse battery";
+  c.ntp.timezone = "CET-1CEST,M3.5.0,M10.5.0/3";
+  c.mqtt.enabled = true;
+  c.mqtt.host = "192.168.1.10";
+  c.mqtt.user = "clock";
+  c.mqtt.pass = "secret";
+  c.net.hostname = "kitchen-clock";
+  c.led.colorHex = "#FF8800";
+  c.led.brightness = 120;
+  c.led.ambientFilter = 2;
+  return c;
+}
+
+static bool sameAs(const Config& a, const Config& b) {
+  String ja, jb;
+  a.appendJson(ja);
+  b.appendJson(jb);
+  return ja == jb && a.wifi.ssid == b.wifi.ssid && a.wifi.password == b.wifi.password && a.mqtt.pass == b.mqtt.pass;
+}
+
+struct Cost { Host::NvsStats ops; double ns; };
+
+template <typename Fn>
+static Cost measure(Fn&& fn) {
+  Host::nvsStats = {};
+  fn(0);
+  Cost c{Host::nvsStats, 0};
+  c.ns = HostTest::nsPerCall(20000, fn);
+  return c;
+}
+
+static void row(const char* what, const Cost& c) {
+  printf("%-30s %8u %8u %8u %10.0f\n", what, (unsigned)c.ops.lookups, (unsigned)c.ops.writes,
+         (unsigned)c.ops.entriesWritten, c.ns);
+}
+
+int main() {
+  const Config want = sample();
+
+  // Migration: a clock upgraded from the per-field format
+  saveLegacy(want);
+  const uint32_t legacyEntries = Host::nvsUsedEntries(NS);
+  const size_t legacyKeys = Host::nvs[NS].size();
+  Config migrated;
+  CHECK(migrated.load());
+  CHECK(sameAs(migrated, want));
+  CHECK(Host::nvs[NS].size() == 1 && Host::nvs[NS].count(BLOB_KEY) == 1);
+  const uint32_t blobEntries = Host::nvsUsedEntries(NS);
+  Config reloaded;
+  CHECK(reloaded.load() && sameAs(reloaded, want));
+
+  printf("fields %u: per-field keys %zu using %u entries, one record of %zu bytes using %u entries\n\n",
+         (unsigned)Config::Field::Count, legacyKeys, (unsigned)legacyEntries,
+         Host::nvs[NS][BLOB_KEY].bytes.size(), (unsigned)blobEntries);
+  printf("%-30s %8s %8s %8s %10s\n", "", "lookups", "writes", "entries", "host ns");
+
+  row("load, record", measure([](uint32_t) { Config c; c.load(); KEEP(c.led.brightness); }));
+  saveLegacy(want); // the legacy keys next to the record: isolated read cost
+  row("load, per-field keys", measure([](uint32_t) { Config c; readLegacy(c); KEEP(c.led.brightness); }));
+
+  // Saves that change one field, as a settings request does
+  Config c = want;
+  row("save one change, record", measure([&](uint32_t i) { c.led.brightness = (uint8_t)i; c.save(); }));
+  row("save one change, per-field", measure([&](uint32_t i) { c.led.brightness = (uint8_t)i; saveLegacy(c); }));
+  row("save all changed, record", measure([&](uint32_t i) { c.led.fadeMs = (uint16_t)i; c.save(); }));
+  row("save all changed, per-field", measure([&](uint32_t i) {
+    c.led.fadeMs = (uint16_t)i; c.wifi.ssid = i & 1 ? "a" : "b"; c.mqtt.host = i & 1 ? "h1" : "h2";
+    saveLegacy(c);
+  }));
+
+  // A commit whose changes cancel out leaves the stored record as it is
+  c.save();
+  const Cost same = measure([&](uint32_t) { c.save(); });
+  CHECK(same.ops.writes == 0);
+  row("save unchanged, record", same);
+
+  // A damaged record is ignored and the defaults stay in place
+  Host::nvs[NS].erase(BLOB_KEY);
+  CHECK(want.save());
+  Host::nvs[NS][BLOB_KEY].bytes[BLOB_HEADER + 3] ^= 0x40;
+  Config damaged;
+  damaged.led.brightness = 77;
+  Host::nvs[NS].erase("w_ssid"); Host::nvs[NS].erase("l_hex"); Host::nvs[NS].erase("n_tz");
+  CHECK(damaged.load() && damaged.led.brightness == 77);
+  return HostTest::done();
+}
@@ -0,0 +1,98 @@
+// Logger cost per message: what a LOG* call costs the caller (format into a
+// ring slot, or encode into the byte ring), what the drain task pays per
+// message, the cost of filtered and dropped messages, and the ring memory each
+// message takes. The last check runs 4 writers against one drainer and
+// verifies every message is either drained or counted as dropped.
+// host-build:
+// host-build: -DLOG_BINARY=1
+#include "core/Log.cpp"
+#include "host_test.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#define MSG(i) LOGI("color hex=%s -> rgb(%u,%u,%u)", "#FF8800", (unsigned)((i) & 255), 136u, 0u)
+
+#ifdef LOG_BINARY
+static const size_t RING_BYTES = sizeof(Log::s_bytes);
+#else
+static const size_t RING_BYTES = sizeof(Log::s_ring);
+#endif
+
+int main() {
+  const uint32_t N = 2000000;
+  // How many of these messages the ring holds: log until the first drop
+  const uint32_t dropped0 = Log::stats().dropped;
+  uint32_t perRing = 0;
+  while (Log::stats().dropped == dropped0) MSG(perRing++);
+  perRing--;
+  const uint64_t serial0 = Host::serialBytes;
+  CHECK(Log::drain() == perRing);
+  const double drainedBytes = (double)(Host::serialBytes - serial0) / perRing;
+
+  // Caller cost with the drain keeping up (drained every ring's worth)
+  const double caller = HostTest::nsPerCall(N, [&](uint32_t i) {
+    MSG(i);
+    if (i % perRing == perRing - 1) Log::drain();
+  });
+  // Drain alone: fill the ring, time the drain
+  double drainNs = 0;
+  const uint32_t rounds = 50000;
+  for (uint32_t r = 0; r < rounds; ++r) {
+    for (uint32_t i = 0; i < perRing; ++i) MSG(i);
+    const auto t0 = std::chrono::steady_clock::now();
+    Log::drain();
+    drainNs += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+  }
+  const double callerOnly = caller - drainNs / rounds / perRing;
+  // The macros this logger replaced: three Serial.printf calls per message. The
+  // stub Serial never blocks, so this is their formatting cost only.
+  const double previous = HostTest::nsPerCall(N, [](uint32_t i) {
+    Serial.printf("[I] %s: ", LOG_TAG);
+    Serial.printf("color hex=%s -> rgb(%u,%u,%u)", "#FF8800", (unsigned)(i & 255), 136u, 0u);
+    Serial.println();
+  });
+  Log::setLevel(Log::Warn);
+  const double filtered = HostTest::nsPerCall(N, [](uint32_t i) {
+    LOGI("color hex=%s -> rgb(%u,%u,%u)", "#FF8800", (unsigned)(i & 255), 136u, 0u);
+  });
+  Log::setLevel(LOG_LEVEL);
+  uint32_t droppedBefore = Log::stats().dropped;
+  for (uint32_t i = 0; Log::stats().dropped == droppedBefore; ++i) LOGI("ring full %u", (unsigned)i);
+  droppedBefore = Log::stats().dropped;
+  const double dropped = HostTest::nsPerCall(N, [](uint32_t i) { LOGI("ring full %u", (unsigned)i); });
+  CHECK(Log::stats().dropped - droppedBefore == N + N / 10 + 1);
+  Log::drain();
+
+  printf("caller (format into slot)  %6.1f ns/msg\n", callerOnly);
+  printf("drain (to Serial)          %6.1f ns/msg\n", drainNs / rounds / perRing);
+  printf("previous Serial macros     %6.1f ns/msg (without blocking)\n", previous);
+  printf("below runtime level        %6.1f ns/msg\n", filtered);
+  printf("ring full (dropped)        %6.1f ns/msg\n", dropped);
+  printf("ring memory                %6zu bytes, holds %u of these messages (%.1f bytes each)\n", RING_BYTES,
+         (unsigned)perRing, (double)RING_BYTES / perRing);
+  printf("output per message         %6.1f bytes\n", drainedBytes);
+
+  // Concurrent writers: nothing lost without being counted, nothing duplicated
+  const Log::Stats before = Log::stats();
+  std::atomic<bool> stop{false};
+  uint32_t got = 0;
+  std::thread drainer([&] { while (!stop) got += Log::drain(); got += Log::drain(); });
+  std::vector<std::thread> writers;
+  for (int k = 0; k < 4; ++k) {
+    writers.emplace_back([k] {
+      for (int i = 0; i < 100000; ++i) {
+        LOGI("writer %d msg %d", k, i);
+        if ((i & 7) == 0) std::this_thread::yield();
+      }
+    });
+  }
+  for (auto& w : writers) w.join();
+  stop = true;
+  drainer.join();
+  const Log::Stats after = Log::stats();
+  CHECK(after.written - before.written == got);
+  CHECK(after.written - before.written + after.dropped - before.dropped == 400000);
+  printf("4 writers x 100000: drained %u, dropped %u\n", (unsigned)got, (unsigned)(after.dropped - before.dropped));
+  return HostTest::done();
+}
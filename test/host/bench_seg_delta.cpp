@@ -0,0 +1,103 @@
+// Per-frame cost of the 7-segment crossfade: the change-list path (only LEDs
+// that switch are repainted) against a full repaint of the strip every frame,
+// for time changes that switch a few or many segments. Runs the real driver;
+// show() before each loop() makes it rebuild the change list and repaint the
+// whole frame, as it does for a new transition or a color change.
+// Both paths include FrameStats on every show (the driver says whether the
+// frame changed); that cost is measured on its own and taken out in the
+// "paint" columns. Delta frames that repeat a fade step must not count as
+// rendered.
+// host-build: -DUSE_7SEGSTRIP=1 -DDISABLE_STARTUP_ANIM=1 -DLEDS_PER_SEG=2
+// host-build: -DUSE_7SEGSTRIP=1 -DDISABLE_STARTUP_ANIM=1 -DLEDS_PER_SEG=60
+#include "hal/Driver_7SegStrip.cpp"
+#include "host_test.hpp"
+#include <vector>
+
+static struct tm s_now{};
+namespace TimeSvc {
+  bool isSynced() { return true; }
+  bool getLocal(struct tm& out) { out = s_now; return true; }
+}
+
+static uint16_t changedSegments(uint8_t h0, uint8_t m0, uint8_t h1, uint8_t m1) {
+  static bool a[STRIP_LENGTH], b[STRIP_LENGTH];
+  for (uint16_t i = 0; i < STRIP_LENGTH; ++i) a[i] = b[i] = false;
+  for (uint8_t d = 0; d < Layout::DIGITS; ++d) {
+    Layout::writeDigit(a, d, Layout::digitValue(d, h0, m0, 0));
+    Layout::writeDigit(b, d, Layout::digitValue(d, h1, m1, 0));
+  }
+  uint16_t n = 0;
+  for (uint16_t i = 0; i < STRIP_LENGTH; ++i) n += a[i] != b[i];
+  return n / LEDS_PER_SEG;
+}
+
+// Best of three runs: the paint differences are small next to timer noise
+template <typename Fn>
+static double best(uint32_t n, Fn&& fn) {
+  double ns = HostTest::nsPerCall(n, fn);
+  for (int i = 0; i < 2; ++i) ns = min(ns, HostTest::nsPerCall(n, fn));
+  return ns;
+}
+
+static void setTime(uint8_t hh, uint8_t mm) {
+  s_now.tm_hour = hh;
+  s_now.tm_min = mm;
+  Host::advanceMs(250); // past the driver's 200 ms time poll
+}
+
+int main() {
+  HalDriver* drv = createDefaultDriver();
+  drv->begin();
+  drv->fill(255, 120, 40);
+  printf("%u LEDs (%u per segment), %u digits\n", (unsigned)STRIP_LENGTH, (unsigned)LEDS_PER_SEG,
+         (unsigned)Layout::DIGITS);
+  FrameStats stats;
+  const double frameStats = best(LEDS_PER_SEG > 8 ? 50000 : 500000, [&](uint32_t) {
+    stats.shown(stats.start(), true, 128, FrameStats::Kind::Static);
+    KEEP(&stats);
+  });
+  printf("FrameStats per show: %.1f ns\n", frameStats);
+  printf("%-13s %8s %10s %10s %11s %11s\n", "change", "segments", "delta ns", "full ns", "delta paint",
+         "full paint");
+
+  struct Change { uint8_t h0, m0, h1, m1; };
+  static const Change CHANGES[] = { { 12, 34, 12, 35 }, { 12, 39, 12, 40 }, { 12, 59, 13, 0 }, { 19, 59, 20, 0 },
+                                    { 10, 58, 21, 47 } };
+  const uint32_t N = LEDS_PER_SEG > 8 ? 50000 : 500000;
+  for (const Change& c : CHANGES) {
+    drv->setSmoothing(0);
+    setTime(c.h0, c.m0);
+    drv->loop();
+    drv->setSmoothing(60000); // the fade outlasts the measurement
+    setTime(c.h1, c.m1);
+    drv->loop();              // starts the transition
+
+    HalTelemetry before{};
+    drv->getTelemetry(before);
+    const double delta = best(N, [&](uint32_t) { Host::nowUs += 1; drv->loop(); });
+    HalTelemetry held{};
+    drv->getTelemetry(held);
+    // 1 us per frame through a 60 s fade: only frames that reach a new progress step are rendered
+    const uint32_t shown = held.framesShown - before.framesShown;
+    CHECK(shown > N);
+    CHECK(held.framesRendered - before.framesRendered <= shown / 1000 * 255 / 60000 + 2);
+    std::vector<CRGB> frame(Host::leds, Host::leds + Host::ledCount);
+    const double full = best(N, [&](uint32_t) { Host::nowUs += 1; drv->show(); drv->loop(); });
+    // Same frame either way once both have painted the same progress
+    Host::nowUs += 300000;
+    drv->loop();
+    frame.assign(Host::leds, Host::leds + Host::ledCount);
+    drv->show();
+    drv->loop();
+    CHECK(std::equal(frame.begin(), frame.end(), Host::leds));
+    HalTelemetry after{};
+    drv->getTelemetry(after);
+    CHECK(after.transitions == before.transitions); // still fading throughout
+
+    char label[24];
+    snprintf(label, sizeof(label), "%02u:%02u->%02u:%02u", c.h0, c.m0, c.h1, c.m1);
+    printf("%-13s %8u %10.1f %10.1f %11.1f %11.1f\n", label, (unsigned)changedSegments(c.h0, c.m0, c.h1, c.m1), delta,
+           full, delta - frameStats, full - frameStats);
+  }
+  return HostTest::done();
+}
@@ -0,0 +1,29 @@
+#pragma once
+// Shared helpers for the host tests and benchmarks (see run.sh)
+#include <chrono>
+#include <stdio.h>
+
+namespace HostTest {
+  inline int failures = 0;
+
+  // Wall-clock nanoseconds per call of fn over n calls (after a short warm-up)
+  template <typename Fn>
+  double nsPerCall(uint32_t n, Fn&& fn) {
+    for (uint32_t i = 0; i < n / 10 + 1; ++i) fn(i);
+    const auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < n; ++i) fn(i);
+    const auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+  }
+
+  inline int done() {
+    if (failures) fprintf(stderr, "%d check(s) failed\n", failures);
+    return failures ? 1 : 0;
+  }
+}
+
+#define CHECK(cond) do { if (!(cond)) { \
+  fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); HostTest::failures++; } } while (0)
+
+// Keeps a computed value alive so the optimiser cannot drop the measured work
+#define KEEP(v) do { asm volatile("" : : "g"(v) : "memory"); } while (0)
@@ -0,0 +1,48 @@
+#!/usr/bin/env bash
+# Host (Linux) tests and benchmarks for firmware modules that do not need the
+# hardware. Every test_*.cpp / bench_*.cpp is one translation unit that
+# #includes the sources it exercises; stubs/ stands in for the Arduino core.
+#
+#   test/host/run.sh                 build and run the tests
+#   test/host/run.sh --bench         tests, then the benchmarks
+#   test/host/run.sh bench_log ...   only the named files (tests or benchmarks)
+#
+# A "// host-build: <flags>" line in a file adds compiler flags; a file with
+# several such lines is built and run once per line. Exit status is the
+# number of failed files.
+set -u
+cd "$(dirname "$0")"
+CXX=${CXX:-g++}
+OUT=${OUT:-${TMPDIR:-/tmp}/ezclock-host}
+CXXFLAGS=${CXXFLAGS:--O2 -g}
+mkdir -p "$OUT"
+
+files=()
+if [ $# -gt 0 ] && [ "$1" != "--bench" ]; then
+  for name in "$@"; do files+=("${name%.cpp}.cpp"); done
+else
+  files=(test_*.cpp)
+  [ "${1:-}" = "--bench" ] && files+=(bench_*.cpp)
+fi
+
+failed=0
+for src in "${files[@]}"; do
+  [ -f "$src" ] || { echo "no such file: $src"; failed=$((failed + 1)); continue; }
+  name=${src%.cpp}
+  mapfile -t builds < <(sed -n 's|^// host-build: *||p' "$src")
+  [ ${#builds[@]} -eq 0 ] && builds=("")
+  for i in "${!builds[@]}"; do
+    flags=${builds[$i]}
+    bin="$OUT/$name.$i"
+    echo "== $name ${flags}"
+    # shellcheck disable=SC2086
+    if ! $CXX -std=gnu++17 $CXXFLAGS -Wall -Istubs -I../../src $flags -o "$bin" "$src" -lpthread; then
+      failed=$((failed + 1)); continue
+    fi
+    if ! (cd ../.. && "$bin"); then
+      echo "FAILED: $name ${flags}"
+      failed=$((failed + 1))
+    fi
+  done
+done
+exit $failed
@@ -0,0 +1,176 @@
+#pragma once
+// Host (Linux) stand-in for the parts of the Arduino-ESP32 core the firmware
+// modules under test use. Time, ADC and heap figures come from the Host
+// namespace so tests can drive them; ARDUINO_ARCH_ESP32 stays undefined, so
+// modules take their single-task paths (no FreeRTOS).
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+using std::min;
+using std::max;
+
+namespace Host {
+  inline uint64_t nowUs = 0;                        // millis()/micros() source; tests advance it
+  inline int (*adc)(uint8_t pin) = nullptr;         // analogRead() source
+  inline uint32_t heapFree = 200000;                // ESP.getFreeHeap() and friends
+  inline uint32_t heapMinFree = 200000;
+  inline uint32_t heapLargest = 200000;
+  inline uint32_t (*largestBlock)() = nullptr;      // overrides heapLargest (allocator models)
+  inline uint32_t heapSize = 320000;
+  inline std::string serial;                        // Serial output when captureSerial is set
+  inline bool captureSerial = false;
+  inline uint64_t serialBytes = 0;
+  inline uint64_t efuseMac = 0x0000C3B2A1F0E0D0ULL; // ESP.getEfuseMac()
+  inline uint32_t randomSeed = 1;                   // random(); fixed so runs repeat
+
+  inline void advanceMs(uint32_t ms) { nowUs += (uint64_t)ms * 1000; }
+}
+
+inline unsigned long millis() { return (uint32_t)(Host::nowUs / 1000); }
+inline unsigned long micros() { return (uint32_t)Host::nowUs; }
+inline void delay(uint32_t ms) { Host::advanceMs(ms); }
+inline void yield() {}
+inline int analogRead(uint8_t pin) { return Host::adc ? Host::adc(pin) : 0; }
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline long random(long lo, long hi) {
+  Host::randomSeed = Host::randomSeed * 1103515245u + 12345u;
+  return hi > lo ? lo + (long)((Host::randomSeed >> 8) % (uint32_t)(hi - lo)) : lo;
+}
+inline long random(long hi) { return random(0, hi); }
+template <class T> T constrain(T v, T lo, T hi) { return v < lo ? lo : (v > hi ? hi : v); }
+
+#define INPUT 0
+#define OUTPUT 1
+#define LOW 0
+#define HIGH 1
+
+// Arduino String over std::string (same small-string and growth behaviour is
+// not attempted; allocation counts differ from the device)
+class String {
+public:
+  String(const char* s = "") : _s(s ? s : "") {}
+  String(const std::string& s) : _s(s) {}
+  explicit String(char c) : _s(1, c) {}
+  explicit String(int v) : _s(std::to_string(v)) {}
+  explicit String(unsigned v) : _s(std::to_string(v)) {}
+  explicit String(long v) : _s(std::to_string(v)) {}
+  explicit String(unsigned long v) : _s(std::to_string(v)) {}
+  explicit String(double v, unsigned decimals = 2) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+    _s = buf;
+  }
+
+  String& operator=(const char* s) { _s = s ? s : ""; return *this; }
+  String& operator+=(const String& s) { _s += s._s; return *this; }
+  String& operator+=(const char* s) { _s += s; return *this; }
+  String& operator+=(char c) { _s += c; return *this; }
+  String& operator+=(int v) { _s += std::to_string(v); return *this; }
+  String& operator+=(unsigned v) { _s += std::to_string(v); return *this; }
+  String& operator+=(long v) { _s += std::to_string(v); return *this; }
+  String& operator+=(unsigned long v) { _s += std::to_string(v); return *this; }
+  friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+  friend String operator+(const String& a, const char* b) { return String(a._s + b); }
+  friend String operator+(const char* a, const String& b) { return String(a + b._s); }
+  bool operator==(const String& o) const { return _s == o._s; }
+  bool operator==(const char* o) const { return _s == o; }
+  bool operator!=(const String& o) const { return _s != o._s; }
+  bool operator!=(const char* o) const { return _s != o; }
+  char operator[](unsigned i) const { return i < _s.size() ? _s[i] : 0; }
+  char& operator[](unsigned i) { return _s[i]; }
+
+  const char* c_str() const { return _s.c_str(); }
+  unsigned length() const { return (unsigned)_s.size(); }
+  bool isEmpty() const { return _s.empty(); }
+  bool reserve(unsigned n) { _s.reserve(n); return true; }
+  bool concat(const char* s, unsigned n) { _s.append(s, n); return true; }
+  bool concat(const char* s) { _s += s; return true; }
+  bool concat(const String& s) { _s += s._s; return true; }
+  bool concat(char c) { _s += c; return true; }
+  bool startsWith(const String& p) const { return _s.compare(0, p._s.size(), p._s) == 0; }
+  bool endsWith(const String& p) const {
+    return _s.size() >= p._s.size() && _s.compare(_s.size() - p._s.size(), p._s.size(), p._s) == 0;
+  }
+  bool equalsIgnoreCase(const String& o) const {
+    if (_s.size() != o._s.size()) return false;
+    for (size_t i = 0; i < _s.size(); ++i) if (tolower((unsigned char)_s[i]) != tolower((unsigned char)o._s[i])) return false;
+    return true;
+  }
+  int indexOf(char c, unsigned from = 0) const { const size_t p = _s.find(c, from); return p == std::string::npos ? -1 : (int)p; }
+  int indexOf(const String& s, unsigned from = 0) const { const size_t p = _s.find(s._s, from); return p == std::string::npos ? -1 : (int)p; }
+  String substring(unsigned from, unsigned to = ~0u) const {
+    if (from > _s.size()) return String();
+    return String(_s.substr(from, (to > _s.size() ? _s.size() : to) - from));
+  }
+  void remove(unsigned index, unsigned count = ~0u) { if (index < _s.size()) _s.erase(index, count); }
+  void setCharAt(unsigned i, char c) { if (i < _s.size()) _s[i] = c; }
+  void replace(const String& from, const String& to) {
+    if (from._s.empty()) return;
+    for (size_t p = 0; (p = _s.find(from._s, p)) != std::string::npos; p += to._s.size()) _s.replace(p, from._s.size(), to._s);
+  }
+  void trim() {
+    const size_t b = _s.find_first_not_of(" \t\r\n");
+    if (b == std::string::npos) { _s.clear(); return; }
+    _s = _s.substr(b, _s.find_last_not_of(" \t\r\n") - b + 1);
+  }
+  void toLowerCase() { for (char& c : _s) c = (char)tolower((unsigned char)c); }
+  long toInt() const { return strtol(_s.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(_s.c_str(), nullptr); }
+
+private:
+  std::string _s;
+};
+
+class Print {
+public:
+  virtual ~Print() = default;
+  virtual size_t write(const uint8_t* buf, size_t n) {
+    Host::serialBytes += n;
+    if (Host::captureSerial) Host::serial.append((const char*)buf, n);
+    return n;
+  }
+  size_t write(uint8_t c) { return write(&c, 1); }
+  size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+  size_t print(const String& s) { return print(s.c_str()); }
+  size_t println(const char* s = "") { return print(s) + print("\n"); }
+  size_t println(const String& s) { return println(s.c_str()); }
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    const int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    return n > 0 ? write((const uint8_t*)buf, min((size_t)n, sizeof(buf) - 1)) : 0;
+  }
+};
+
+class HWCDC : public Print {
+public:
+  void begin(unsigned long) {}
+  explicit operator bool() const { return true; }
+  int availableForWrite() { return 64; }
+  void flush() {}
+};
+inline HWCDC Serial;
+
+class EspClass {
+public:
+  uint32_t getFreeHeap() { return Host::heapFree; }
+  uint32_t getMinFreeHeap() { return Host::heapMinFree; }
+  uint32_t getMaxAllocHeap() { return Host::largestBlock ? Host::largestBlock() : Host::heapLargest; }
+  uint32_t getHeapSize() { return Host::heapSize; }
+  uint32_t getCycleCount() { return (uint32_t)(Host::nowUs * 160); } // 160 MHz
+  uint32_t getCpuFreqMHz() { return 160; }
+  uint64_t getEfuseMac() { return Host::efuseMac; }
+  void restart() {}
+};
+inline EspClass ESP;
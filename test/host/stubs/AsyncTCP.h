@@ -0,0 +1,55 @@
+#pragma once
+// AsyncClient with the test as the network: bytes the firmware sends collect
+// in tx, and the peer*() calls raise the callbacks AsyncTCP would. close()
+// fires nothing, like a close while the DNS lookup is still pending; a test
+// that wants the disconnect callback calls peerDisconnected().
+#include <Arduino.h>
+#include <functional>
+
+class AsyncClient;
+typedef std::function<void(void*, AsyncClient*)> AcConnectHandler;
+typedef std::function<void(void*, AsyncClient*, void* data, size_t len)> AcDataHandler;
+typedef std::function<void(void*, AsyncClient*, int8_t error)> AcErrorHandler;
+
+#define ASYNC_WRITE_FLAG_COPY 0x01
+
+class AsyncClient {
+public:
+  // Test side
+  std::string tx;          // everything sent, in order
+  std::string host;        // last connect() target
+  uint16_t port = 0;
+  bool connectOk = true;   // connect() result
+  size_t sendSpace = 5744; // space() while connected (one TCP window)
+  uint32_t connects = 0, closes = 0;
+
+  void peerConnected() { _state = Connected; if (_onConnect) _onConnect(_arg, this); }
+  void peerData(const void* p, size_t n) { if (_onData) _onData(_arg, this, (void*)p, n); }
+  void peerDisconnected() { _state = Closed; if (_onDisconnect) _onDisconnect(_arg, this); }
+  bool connecting() const { return _state == Connecting; }
+
+  // Firmware side
+  void setNoDelay(bool) {}
+  void onConnect(AcConnectHandler cb, void* arg = nullptr) { _onConnect = cb; _arg = arg; }
+  void onDisconnect(AcConnectHandler cb, void* arg = nullptr) { _onDisconnect = cb; _arg = arg; }
+  void onError(AcErrorHandler cb, void* arg = nullptr) { _onError = cb; _arg = arg; }
+  void onData(AcDataHandler cb, void* arg = nullptr) { _onData = cb; _arg = arg; }
+  bool connect(const char* h, uint16_t p) {
+    host = h; port = p; connects++;
+    if (connectOk) _state = Connecting;
+    return connectOk;
+  }
+  void close(bool = false) { closes++; _state = Closed; _pending.clear(); }
+  bool connected() const { return _state == Connected; }
+  size_t space() const { return connected() ? sendSpace : 0; }
+  size_t add(const char* data, size_t n, uint8_t = ASYNC_WRITE_FLAG_COPY) { _pending.append(data, n); return n; }
+  bool send() { tx += _pending; _pending.clear(); return true; }
+
+private:
+  enum { Closed, Connecting, Connected } _state = Closed;
+  std::string _pending;
+  void* _arg = nullptr;
+  AcConnectHandler _onConnect, _onDisconnect;
+  AcErrorHandler _onError;
+  AcDataHandler _onData;
+};
@@ -0,0 +1,124 @@
+#pragma once
+// The part of FastLED the 7-segment and word-clock drivers use. scale8, sin8,
+// beat8 and blend8 follow the FastLED C implementations; HSV conversions are a
+// plain spectrum mapping and its inverse.
+// show() pushes nothing: Host::ledShows counts frames, Host::leds is the
+// last strip added.
+#include <Arduino.h>
+
+struct CRGB {
+  uint8_t r, g, b;
+  CRGB() : r(0), g(0), b(0) {}
+  constexpr CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+  constexpr CRGB(uint32_t rgb) : r((uint8_t)(rgb >> 16)), g((uint8_t)(rgb >> 8)), b((uint8_t)rgb) {}
+  CRGB(const struct CHSV& hsv);
+  CRGB& setRGB(uint8_t ir, uint8_t ig, uint8_t ib) { r = ir; g = ig; b = ib; return *this; }
+  CRGB& nscale8(uint8_t scale);
+  bool operator==(const CRGB& o) const { return r == o.r && g == o.g && b == o.b; }
+  bool operator!=(const CRGB& o) const { return !(*this == o); }
+  enum : uint32_t { Black = 0x000000, White = 0xFFFFFF };
+};
+
+struct CHSV {
+  uint8_t h, s, v;
+  CHSV() : h(0), s(0), v(0) {}
+  CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+};
+
+inline uint8_t scale8(uint8_t i, uint8_t scale) { return (uint8_t)(((uint16_t)i * (1 + (uint16_t)scale)) >> 8); }
+
+inline CRGB::CRGB(const CHSV& hsv) {
+  const uint8_t sector = (uint8_t)(hsv.h / 43), rise = (uint8_t)((hsv.h - sector * 43) * 6);
+  const uint8_t fall = (uint8_t)(255 - rise), low = (uint8_t)(255 - hsv.s);
+  uint8_t c[3];
+  switch (sector) {
+    case 0: c[0] = 255; c[1] = rise; c[2] = 0; break;
+    case 1: c[0] = fall; c[1] = 255; c[2] = 0; break;
+    case 2: c[0] = 0; c[1] = 255; c[2] = rise; break;
+    case 3: c[0] = 0; c[1] = fall; c[2] = 255; break;
+    case 4: c[0] = rise; c[1] = 0; c[2] = 255; break;
+    default: c[0] = 255; c[1] = 0; c[2] = fall; break;
+  }
+  for (uint8_t& x : c) x = scale8((uint8_t)(x + scale8((uint8_t)(255 - x), low)), hsv.v);
+  r = c[0]; g = c[1]; b = c[2];
+}
+
+inline CRGB& CRGB::nscale8(uint8_t scale) {
+  r = scale8(r, scale); g = scale8(g, scale); b = scale8(b, scale);
+  return *this;
+}
+
+inline void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb) { rgb = CRGB(hsv); }
+
+inline CHSV rgb2hsv_approximate(const CRGB& rgb) {
+  const uint8_t hi = max(rgb.r, max(rgb.g, rgb.b)), lo = min(rgb.r, min(rgb.g, rgb.b));
+  if (hi == 0) return CHSV(0, 0, 0);
+  const int d = hi - lo;
+  const uint8_t s = (uint8_t)(d * 255 / hi);
+  if (d == 0) return CHSV(0, 0, hi);
+  int h;
+  if (hi == rgb.r) h = 43 * (rgb.g - rgb.b) / d;
+  else if (hi == rgb.g) h = 85 + 43 * (rgb.b - rgb.r) / d;
+  else h = 171 + 43 * (rgb.r - rgb.g) / d;
+  return CHSV((uint8_t)(h & 0xFF), s, hi);
+}
+
+inline uint8_t blend8(uint8_t a, uint8_t b, uint8_t amountOfB) {
+  uint16_t partial = (uint16_t)((a << 8) | b);
+  partial = (uint16_t)(partial + b * amountOfB - a * amountOfB);
+  return (uint8_t)(partial >> 8);
+}
+
+inline CRGB& nblend(CRGB& existing, const CRGB& overlay, uint8_t amountOfOverlay) {
+  existing.r = blend8(existing.r, overlay.r, amountOfOverlay);
+  existing.g = blend8(existing.g, overlay.g, amountOfOverlay);
+  existing.b = blend8(existing.b, overlay.b, amountOfOverlay);
+  return existing;
+}
+
+inline CRGB blend(const CRGB& a, const CRGB& b, uint8_t amountOfB) {
+  CRGB c = a;
+  return nblend(c, b, amountOfB);
+}
+
+inline uint8_t sin8(uint8_t theta) {
+  static const uint8_t b_m16_interleave[] = { 0, 49, 49, 41, 90, 27, 117, 10 };
+  uint8_t offset = theta;
+  if (theta & 0x40) offset = (uint8_t)(255 - offset);
+  offset &= 0x3F;
+  uint8_t secoffset = offset & 0x0F;
+  if (theta & 0x40) ++secoffset;
+  const uint8_t* p = b_m16_interleave + (offset >> 4) * 2;
+  const uint8_t mx = (uint8_t)((p[1] * secoffset) >> 4);
+  int8_t y = (int8_t)(mx + p[0]);
+  if (theta & 0x80) y = (int8_t)-y;
+  return (uint8_t)(y + 128);
+}
+
+inline uint8_t beat8(uint8_t bpm) { return (uint8_t)((((uint32_t)millis() * ((uint32_t)bpm << 8) * 280) >> 16) >> 8); }
+
+inline void fill_solid(CRGB* leds, int n, const CRGB& c) {
+  for (int i = 0; i < n; ++i) leds[i] = c;
+}
+
+enum EOrder { RGB, GRB };
+template <uint8_t PIN, EOrder ORDER> class WS2812B {};
+
+namespace Host {
+  inline CRGB* leds = nullptr;
+  inline int ledCount = 0;
+  inline uint32_t ledShows = 0;
+}
+
+class CFastLED {
+public:
+  template <template <uint8_t, EOrder> class CHIPSET, uint8_t PIN, EOrder ORDER>
+  CFastLED& addLeds(CRGB* leds, int n) { Host::leds = leds; Host::ledCount = n; return *this; }
+  void show() { Host::ledShows++; }
+  void setBrightness(uint8_t b) { _brightness = b; }
+  uint8_t getBrightness() const { return _brightness; }
+
+private:
+  uint8_t _brightness{255};
+};
+inline CFastLED FastLED;
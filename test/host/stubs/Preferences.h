@@ -0,0 +1,97 @@
+#pragma once
+// In-memory Preferences with NVS accounting. Entry usage follows the ESP-IDF
+// NVS layout (32-byte entries): an integer takes 1 entry, a string 1 + its
+// bytes incl. NUL rounded up to entries, a blob an index entry plus a chunk
+// header and its data.
+#include <Arduino.h>
+#include <map>
+
+namespace Host {
+  struct NvsValue {
+    char type;         // 'i' integer, 's' string, 'b' blob
+    std::string bytes;
+  };
+  struct NvsStats {
+    uint32_t lookups;        // key searches (every get, isKey, remove, put)
+    uint32_t writes;         // put calls that changed flash
+    uint32_t entriesWritten; // 32-byte entries programmed by those writes
+  };
+  inline std::map<std::string, std::map<std::string, NvsValue>> nvs;
+  inline NvsStats nvsStats{};
+
+  inline uint32_t nvsEntries(const NvsValue& v) {
+    switch (v.type) {
+      case 's': return 1 + (uint32_t)(v.bytes.size() + 1 + 31) / 32;
+      case 'b': return 2 + (uint32_t)(v.bytes.size() + 31) / 32;
+      default:  return 1;
+    }
+  }
+  inline uint32_t nvsUsedEntries(const char* ns) {
+    uint32_t n = 0;
+    for (const auto& kv : nvs[ns]) n += nvsEntries(kv.second);
+    return n;
+  }
+}
+
+class Preferences {
+public:
+  bool begin(const char* ns, bool readOnly = false) { _ns = ns; _ro = readOnly; return true; }
+  void end() { _ns.clear(); }
+  bool clear() { if (_ro) return false; Host::nvs[_ns].clear(); return true; }
+  bool isKey(const char* key) { return find(key) != nullptr; }
+  bool remove(const char* key) {
+    Host::nvsStats.lookups++;
+    return !_ro && Host::nvs[_ns].erase(key) > 0;
+  }
+  size_t freeEntries() { return 630 - Host::nvsUsedEntries(_ns.c_str()); } // 5 pages of 126 entries
+
+  String getString(const char* key, const String& def = String()) { const auto* v = find(key, 's'); return v ? String(v->bytes) : def; }
+  bool getBool(const char* key, bool def = false) { return getInt(key, def) != 0; }
+  uint8_t getUChar(const char* key, uint8_t def = 0) { return (uint8_t)getInt(key, def); }
+  uint16_t getUShort(const char* key, uint16_t def = 0) { return (uint16_t)getInt(key, def); }
+  size_t getBytesLength(const char* key) { const auto* v = find(key, 'b'); return v ? v->bytes.size() : 0; }
+  size_t getBytes(const char* key, void* buf, size_t maxLen) {
+    const auto* v = find(key, 'b');
+    if (!v || v->bytes.size() > maxLen) return 0;
+    memcpy(buf, v->bytes.data(), v->bytes.size());
+    return v->bytes.size();
+  }
+
+  size_t putString(const char* key, const String& value) { return put(key, 's', std::string(value.c_str())) ? value.length() : 0; }
+  size_t putBool(const char* key, bool value) { return putInt(key, value ? 1 : 0) ? 1 : 0; }
+  size_t putUChar(const char* key, uint8_t value) { return putInt(key, value) ? 1 : 0; }
+  size_t putUShort(const char* key, uint16_t value) { return putInt(key, value) ? 2 : 0; }
+  size_t putBytes(const char* key, const void* buf, size_t len) {
+    return put(key, 'b', std::string((const char*)buf, len)) ? len : 0;
+  }
+
+private:
+  std::string _ns;
+  bool _ro{false};
+
+  const Host::NvsValue* find(const char* key, char type = 0) {
+    Host::nvsStats.lookups++;
+    auto& space = Host::nvs[_ns];
+    const auto it = space.find(key);
+    if (it == space.end() || (type && it->second.type != type)) return nullptr;
+    return &it->second;
+  }
+  long getInt(const char* key, long def) {
+    const auto* v = find(key, 'i');
+    return v ? strtol(v->bytes.c_str(), nullptr, 10) : def;
+  }
+  bool putInt(const char* key, long value) { return put(key, 'i', std::to_string(value)); }
+  // NVS skips the write when the stored value is identical
+  bool put(const char* key, char type, const std::string& bytes) {
+    if (_ro) return false;
+    const auto* old = find(key);
+    if (old && old->type == type && old->bytes == bytes) return true;
+    Host::NvsValue v{type, bytes};
+    Host::nvsStats.writes++;
+    Host::nvsStats.entriesWritten += Host::nvsEntries(v);
+    auto& space = Host::nvs[_ns];
+    space.erase(key); // a new entry, as NVS writes it (no capacity carried over)
+    space.emplace(key, std::move(v));
+    return true;
+  }
+};
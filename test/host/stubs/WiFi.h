@@ -0,0 +1,26 @@
+#pragma once
+// WiFi.status(), getMode() and setSleep(); Host::wifiStatus plays the station
+// state, Host::wifiMode the AP/STA mode and Host::wifiSleep the modem sleep
+#include <Arduino.h>
+
+typedef enum { WL_IDLE_STATUS = 0, WL_CONNECTED = 3, WL_CONNECTION_LOST = 5, WL_DISCONNECTED = 6 } wl_status_t;
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+namespace Host {
+  inline wl_status_t wifiStatus = WL_CONNECTED;
+  inline wifi_mode_t wifiMode = WIFI_STA;
+  inline bool wifiSleep = false;
+  inline uint32_t wifiSleepSwitches = 0;
+}
+
+class WiFiClass {
+public:
+  wl_status_t status() { return Host::wifiStatus; }
+  wifi_mode_t getMode() { return Host::wifiMode; }
+  bool setSleep(bool enabled) {
+    Host::wifiSleepSwitches += Host::wifiSleep != enabled;
+    Host::wifiSleep = enabled;
+    return true;
+  }
+};
+inline WiFiClass WiFi;
@@ -0,0 +1,42 @@
+#pragma once
+// esp_timer with the callback captured: tests fire it with Host::fireTimer()
+#include <stdint.h>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+typedef void (*esp_timer_cb_t)(void* arg);
+typedef enum { ESP_TIMER_TASK } esp_timer_dispatch_t;
+typedef struct {
+  esp_timer_cb_t callback;
+  void* arg;
+  esp_timer_dispatch_t dispatch_method;
+  const char* name;
+  bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+namespace Host {
+  struct Timer {
+    esp_timer_cb_t callback;
+    void* arg;
+    uint64_t periodUs;
+    bool running;
+  };
+  inline Timer timer{};  // the last timer created
+
+  inline void fireTimer(uint32_t times = 1) {
+    for (uint32_t i = 0; i < times; ++i) timer.callback(timer.arg);
+  }
+}
+typedef Host::Timer* esp_timer_handle_t;
+
+inline esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* out) {
+  Host::timer = Host::Timer{ args->callback, args->arg, 0, false };
+  *out = &Host::timer;
+  return ESP_OK;
+}
+inline esp_err_t esp_timer_start_periodic(esp_timer_handle_t t, uint64_t periodUs) {
+  t->periodUs = periodUs;
+  t->running = true;
+  return ESP_OK;
+}
+inline esp_err_t esp_timer_stop(esp_timer_handle_t t) { t->running = false; return ESP_OK; }
@@ -0,0 +1,17 @@
+#pragma once
+// gettimeofday() on the simulated clock: Host::epochUs + Host::nowUs, so code
+// that reads the wall clock directly follows the test's time. The macro reads
+// Host::nowUs where it is used (after Arduino.h).
+#include_next <sys/time.h>
+#include <stdint.h>
+
+namespace Host {
+  inline uint64_t epochUs = 1767225600ULL * 1000000ULL; // 2026-01-01 00:00:00 UTC at nowUs == 0
+  inline int wallClock(struct timeval* tv, uint64_t nowUs) {
+    const uint64_t t = epochUs + nowUs;
+    tv->tv_sec = (time_t)(t / 1000000ULL);
+    tv->tv_usec = (suseconds_t)(t % 1000000ULL);
+    return 0;
+  }
+}
+#define gettimeofday(tv, tz) Host::wallClock(tv, Host::nowUs)
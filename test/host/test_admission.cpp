@@ -0,0 +1,89 @@
+// Admission control: per-client token bucket (burst, refill, cap), LRU
+// replacement of the client table, the in-flight cap on expensive requests
+// and the counters; then a flood client next to a normal UI client.
+#include "services/Admission.cpp"
+#include "host_test.hpp"
+
+using Admission::Cost;
+using Admission::Verdict;
+
+// Admitted requests out of n back-to-back ones from ip
+static uint32_t burst(uint32_t ip, uint32_t n, Cost cost = Cost::Cheap) {
+  uint32_t ok = 0;
+  for (uint32_t i = 0; i < n; ++i) ok += Admission::admit(ip, cost) == Verdict::Admit;
+  return ok;
+}
+
+int main() {
+  Host::advanceMs(1000);
+  // Burst: a new client gets ADMIT_BURST requests, then waits for tokens
+  CHECK(burst(1, 20) == ADMIT_BURST);
+  CHECK(Admission::admit(1, Cost::Cheap) == Verdict::RateLimited);
+  // Refill: ADMIT_RATE_PER_S per second, in milli-tokens
+  Host::advanceMs(1000 / ADMIT_RATE_PER_S - 1);
+  CHECK(Admission::admit(1, Cost::Cheap) == Verdict::RateLimited);
+  Host::advanceMs(1);
+  CHECK(Admission::admit(1, Cost::Cheap) == Verdict::Admit);
+  // ...capped at the burst however long the client was away
+  Host::advanceMs(3600 * 1000);
+  CHECK(burst(1, 20) == ADMIT_BURST);
+  // Exempt requests are never limited and spend nothing
+  CHECK(burst(1, 50, Cost::Exempt) == 50);
+
+  // LRU: fill the table, then a ninth client replaces the least recently seen
+  Host::advanceMs(10000);
+  for (uint32_t ip = 1; ip <= ADMIT_MAX_CLIENTS; ++ip) { burst(ip, ADMIT_BURST); Host::advanceMs(10); }
+  CHECK(Admission::stats().clients == ADMIT_MAX_CLIENTS);
+  for (uint32_t ip = 2; ip <= ADMIT_MAX_CLIENTS; ++ip) Admission::admit(ip, Cost::Cheap); // seen again, still empty
+  CHECK(burst(100, 1) == 1);  // replaces client 1
+  CHECK(burst(2, 1) == 0);    // client 2 kept its empty bucket
+  CHECK(burst(1, 20) == ADMIT_BURST); // client 1 starts over (replaces client 3, the oldest now)
+  CHECK(Admission::stats().clients == ADMIT_MAX_CLIENTS);
+
+  // In-flight cap: Busy without spending a token, a release frees a slot
+  Host::advanceMs(60000);
+  const Admission::Stats s0 = Admission::stats();
+  CHECK(s0.inFlight == 0);
+  for (uint8_t i = 0; i < ADMIT_MAX_INFLIGHT; ++i) CHECK(Admission::admit(50 + i, Cost::Expensive) == Verdict::Admit);
+  CHECK(Admission::admit(60, Cost::Expensive) == Verdict::Busy);
+  CHECK(Admission::admit(60, Cost::Cheap) == Verdict::Admit); // cheap requests are not capped
+  Admission::release(); // the disconnect of one expensive request
+  CHECK(Admission::admit(60, Cost::Expensive) == Verdict::Admit);
+  const Admission::Stats s1 = Admission::stats();
+  CHECK(s1.inFlight == ADMIT_MAX_INFLIGHT);
+  CHECK(s1.inFlightPeak == ADMIT_MAX_INFLIGHT);
+  CHECK(s1.busy == s0.busy + 1);
+  CHECK(s1.admitted == s0.admitted + ADMIT_MAX_INFLIGHT + 2);
+  for (int i = 0; i < 5; ++i) Admission::release(); // more releases than requests: no underflow
+  CHECK(Admission::stats().inFlight == 0);
+  // Busy did not spend client 60's token: ADMIT_BURST - 2 left
+  CHECK(burst(60, 20) == ADMIT_BURST - 2);
+
+  // Load: a flood client at 200 req/s and a UI client polling every 2 s with
+  // a page load (6 requests) every minute, for 10 minutes
+  Host::advanceMs(60000);
+  uint32_t floodSent = 0, floodOk = 0, uiSent = 0, uiOk = 0;
+  const Admission::Stats l0 = Admission::stats();
+  for (uint32_t ms = 0; ms < 600000; ms += 5) {
+    Host::advanceMs(5);
+    floodSent++;
+    floodOk += Admission::admit(0xC0A80166, Cost::Expensive) == Verdict::Admit;
+    if (Admission::stats().inFlight) Admission::release(); // answered within the tick
+    if (ms % 2000 == 0) { uiSent++; uiOk += Admission::admit(0xC0A80105, Cost::Cheap) == Verdict::Admit; }
+    if (ms % 60000 == 0) { uiSent += 6; uiOk += burst(0xC0A80105, 6); }
+  }
+  CHECK(uiOk == uiSent);
+  CHECK(floodOk <= ADMIT_BURST + 600 * ADMIT_RATE_PER_S);
+  const Admission::Stats l1 = Admission::stats();
+  CHECK(l1.admitted - l0.admitted == floodOk + uiOk);
+  CHECK(l1.rateLimited - l0.rateLimited == floodSent - floodOk);
+  printf("10 min: flood %u/%u admitted (%.1f/s), UI %u/%u admitted\n", (unsigned)floodOk, (unsigned)floodSent,
+         floodOk / 600.0, (unsigned)uiOk, (unsigned)uiSent);
+
+  const double admitNs = HostTest::nsPerCall(2000000, [](uint32_t i) {
+    Host::nowUs += 1000;
+    KEEP(Admission::admit(1 + (i & 15), Cost::Cheap)); // 16 clients through 8 slots
+  });
+  printf("admit(): %.1f ns/call with 16 clients cycling through %u slots\n", admitNs, (unsigned)ADMIT_MAX_CLIENTS);
+  return HostTest::done();
+}
@@ -0,0 +1,127 @@
+// AmbientSampler filters replayed over an ambient trace (see ambient_trace.hpp)
+// through the captured sampling timer, against straightforward references:
+// - Average equals the rounded mean of the window
+// - Median equals the median of the newest min(window, MEDIAN_MAX) samples
+// - EMA stays within two counts of a floating-point EMA and settles after a step
+// - a consumer that falls behind keeps the newest samples and counts the rest
+#include "hal/AmbientSampler.hpp"
+#include "host_test.hpp"
+#include "ambient_trace.hpp"
+
+static const std::vector<uint16_t>* s_trace;
+static size_t s_next;
+static int readTrace(uint8_t) { return (*s_trace)[s_next++ % s_trace->size()]; }
+
+static uint16_t meanOf(const std::vector<uint16_t>& v, size_t end, size_t n) {
+  uint32_t sum = 0;
+  for (size_t i = end - n; i < end; ++i) sum += v[i];
+  return (uint16_t)((sum + n / 2) / n);
+}
+
+static uint16_t medianOf(const std::vector<uint16_t>& v, size_t end, size_t n) {
+  std::vector<uint16_t> w(v.begin() + (end - n), v.begin() + end);
+  std::sort(w.begin(), w.end());
+  return w[n / 2];
+}
+
+// Replays the trace, polling after every `batch` timer ticks like a render
+// loop that wakes less often than the sampling period; returns mismatches
+static uint32_t replay(const std::vector<uint16_t>& trace, uint8_t window, AmbientSampler::Filter filter, uint32_t batch) {
+  s_trace = &trace;
+  s_next = 0;
+  AmbientSampler s;
+  s.configure(window, filter);
+  s.begin(4, 250);
+  uint32_t bad = 0;
+  double ema = 0;
+  const double alpha = 2.0 / (window + 1);
+  for (size_t i = 1; i <= trace.size(); ++i) {
+    Host::fireTimer();
+    ema = i == 1 ? trace[0] : ema + alpha * (trace[i - 1] - ema);
+    if (i % batch) continue;
+    CHECK(s.poll());
+    const size_t n = min<size_t>(i, window);
+    uint16_t want = 0;
+    switch (filter) {
+      case AmbientSampler::Average: want = meanOf(trace, i, n); break;
+      case AmbientSampler::Median: want = medianOf(trace, i, min<size_t>(n, AmbientSampler::MEDIAN_MAX)); break;
+      case AmbientSampler::Ema: want = (uint16_t)lround(ema); break;
+    }
+    const int err = (int)s.value() - (int)want;
+    // The EMA runs in Q8 fixed point: allow its rounding, nothing else
+    if (filter == AmbientSampler::Ema ? (err < -2 || err > 2) : err != 0) bad++;
+    if (s.raw() != trace[i - 1]) bad++;
+  }
+  CHECK(s.overruns() == 0);
+  return bad;
+}
+
+int main() {
+  Host::adc = readTrace;
+  const std::vector<uint16_t> trace = AmbientTrace::load(4 * 3600, 250);
+  for (uint8_t f = AmbientSampler::Average; f <= AmbientSampler::Median; ++f) {
+    for (uint8_t window : { 1, 5, 20, 60 }) {
+      for (uint32_t batch : { 1, 4, 31 }) {
+        const uint32_t bad = replay(trace, window, (AmbientSampler::Filter)f, batch);
+        CHECK(bad == 0);
+        if (bad) printf("%s window %u batch %u: %u mismatches\n", AmbientSampler::filterName((AmbientSampler::Filter)f),
+                        (unsigned)window, (unsigned)batch, (unsigned)bad);
+      }
+    }
+  }
+  printf("%zu samples x 3 filters x 4 windows x 3 poll batches match the references\n", trace.size());
+
+  // Spikes: a flat 500 with isolated 4000 spikes; the median never moves
+  std::vector<uint16_t> spiky(400, 500);
+  for (size_t i = 20; i < spiky.size(); i += 37) spiky[i] = 4000;
+  s_trace = &spiky;
+  s_next = 0;
+  AmbientSampler med, avg;
+  med.configure(20, AmbientSampler::Median);
+  med.begin(4, 250);
+  uint16_t medMax = 0;
+  for (size_t i = 0; i < spiky.size(); ++i) { Host::fireTimer(); med.poll(); medMax = max(medMax, med.value()); }
+  CHECK(medMax == 500);
+  s_next = 0;
+  avg.configure(20, AmbientSampler::Average);
+  avg.begin(4, 250);
+  uint16_t avgMax = 0;
+  for (size_t i = 0; i < spiky.size(); ++i) { Host::fireTimer(); avg.poll(); avgMax = max(avgMax, avg.value()); }
+  printf("spikes of 4000 on 500: median peaks at %u, average at %u\n", (unsigned)medMax, (unsigned)avgMax);
+
+  // EMA settling: samples from a 500 -> 2500 step until within 1% of 2500
+  std::vector<uint16_t> step(200, 500);
+  step.resize(400, 2500);
+  s_trace = &step;
+  s_next = 0;
+  AmbientSampler ema;
+  ema.configure(20, AmbientSampler::Ema);
+  ema.begin(4, 250);
+  int settled = -1;
+  for (size_t i = 0; i < step.size(); ++i) {
+    Host::fireTimer();
+    ema.poll();
+    if (i >= 200 && settled < 0 && ema.value() >= 2475) settled = (int)(i - 199);
+  }
+  CHECK(settled > 0 && settled <= 45); // alpha 2/21: (1 - alpha)^n < 1% -> n = 47
+  printf("EMA window 20: within 1%% of a step after %d samples\n", settled);
+
+  // Stalled consumer: 100 ticks without a poll keep the newest RING - 1
+  std::vector<uint16_t> ramp(100);
+  for (size_t i = 0; i < ramp.size(); ++i) ramp[i] = (uint16_t)(i * 10);
+  s_trace = &ramp;
+  s_next = 0;
+  AmbientSampler late;
+  late.configure(31, AmbientSampler::Average);
+  late.begin(4, 250);
+  Host::fireTimer(100);
+  CHECK(late.poll());
+  CHECK(late.overruns() == 69);
+  CHECK(late.samples() == 31);
+  CHECK(late.raw() == 990);
+  CHECK(late.value() == meanOf(ramp, 100, 31));
+  CHECK(!late.poll());
+  printf("stalled consumer: kept %u newest samples, %u counted as overruns\n", (unsigned)late.samples(),
+         (unsigned)late.overruns());
+  return HostTest::done();
+}
@@ -0,0 +1,115 @@
+// AmbientHistory: the 12-bit packed rings against a plain array, the
+// per-minute and ten-minute means fed from a driver, and the CSV export taken
+// while values keep being appended (each row must match the export taken
+// before the appends, overwritten rows are skipped rather than shifted).
+#include "services/AmbientHistory.cpp"
+#include "host_test.hpp"
+#include <string>
+#include <vector>
+
+namespace EventLoop { void wakeIn(uint32_t) {} }
+using namespace AmbientHistory;
+
+// Walks the ring from the oldest value; compares the newest `count` references
+template <uint16_t N>
+static bool matches(const Ring12<N>& r, const std::vector<uint16_t>& ref) {
+  if (r.count != min<size_t>(ref.size(), N)) return false;
+  for (uint16_t i = 0; i < r.count; ++i) {
+    if (r.get((uint16_t)((r.oldest() + i) % N)) != ref[ref.size() - r.count + i]) return false;
+  }
+  return true;
+}
+
+template <uint16_t N>
+static uint32_t roundTrip(uint32_t pushes) {
+  Ring12<N> r{};
+  std::vector<uint16_t> ref;
+  uint32_t rng = 7, bad = 0;
+  for (uint32_t n = 0; n < pushes; ++n) {
+    rng = rng * 1664525u + 1013904223u;
+    const uint16_t v = (uint16_t)(rng >> 16); // includes values above 12 bits
+    r.push(v);
+    ref.push_back(v > 0x0FFF ? 0x0FFF : v);
+    if ((n % 97 == 0 || n + 1 == pushes) && !matches(r, ref)) bad++;
+  }
+  return bad;
+}
+
+// One minute's worth of samples already averaged
+static void pushMinute(uint16_t v) { s_sampleSum = v; s_sampleCount = 1; closeMinute(); }
+
+static std::string stream(Series s, uint32_t appendEvery, uint16_t& next) {
+  Cursor c;
+  beginCsv(c, s);
+  std::string out;
+  uint8_t buf[7]; // small chunks so appends land mid-export
+  uint32_t chunks = 0;
+  for (size_t n; (n = renderChunk(c, buf, sizeof(buf))) > 0; ) {
+    out.append((const char*)buf, n);
+    if (appendEvery && ++chunks % appendEvery == 0) pushMinute(next++);
+  }
+  return out;
+}
+
+struct FakeAmbient : HalDriver {
+  uint16_t avg{0};
+  void begin() override {}
+  void loop() override {}
+  void setPixel(uint16_t, uint8_t, uint8_t, uint8_t) override {}
+  void fill(uint8_t, uint8_t, uint8_t) override {}
+  void clear() override {}
+  void show() override {}
+  uint16_t size() const override { return 0; }
+  bool getAmbientReading(uint16_t& raw, uint16_t& out) override { raw = out = avg; return true; }
+};
+
+int main() {
+  // Packing: two values per 3 bytes, wrapped many times over
+  static_assert(sizeof(s_minute.data) == 2160 && sizeof(s_tenMinute.data) == 1512, "packed sizes");
+  CHECK(roundTrip<1440>(5000) == 0);
+  CHECK(roundTrip<1008>(5000) == 0);
+  CHECK(roundTrip<2>(9) == 0);
+  printf("rings: %zu + %zu bytes packed (%zu as uint16_t)\n", sizeof(s_minute.data), sizeof(s_tenMinute.data),
+         (size_t)(1440 + 1008) * 2);
+
+  // Feeding from a driver: samples every AMBIENT_HIST_SAMPLE_MS averaged per
+  // minute (a sample on the boundary opens the next minute), ten minute means
+  // folded into the ten-minute ring
+  FakeAmbient hal;
+  for (uint32_t minute = 0; minute < 30; ++minute) {
+    for (uint32_t ms = 0; ms < 60000; ms += AMBIENT_HIST_SAMPLE_MS) {
+      hal.avg = (uint16_t)(100 * minute + (ms < 30000 ? 0 : 10)); // mean 100 * minute + 5
+      loop(&hal);
+      Host::advanceMs(AMBIENT_HIST_SAMPLE_MS);
+    }
+  }
+  loop(&hal); // closes minute 29
+  CHECK(count(Series::Minute) == 30);
+  CHECK(count(Series::TenMinute) == 3);
+  bool means = true;
+  for (uint16_t m = 0; m < 30; ++m) means &= s_minute.get(m) == 100 * m + 5;
+  for (uint16_t t = 0; t < 3; ++t) means &= s_tenMinute.get(t) == 1000 * t + 455;
+  CHECK(means);
+
+  // CSV while appending: a full minute ring streamed in 7-byte chunks with an
+  // append after every chunk, against the export taken just before
+  s_minute = Ring12<1440>();
+  for (uint16_t i = 0; i < 1440; ++i) pushMinute(i);
+  uint16_t next = 3000;
+  const std::string before = stream(Series::Minute, 0, next);
+  const std::string during = stream(Series::Minute, 1, next);
+  uint32_t rowsBefore = 0, rowsDuring = 0, bad = 0;
+  for (char ch : before) rowsBefore += ch == '\n';
+  for (size_t p = 0, q; (q = during.find('\n', p)) != std::string::npos; p = q + 1) {
+    rowsDuring++;
+    if (before.find(during.substr(p, q - p + 1)) == std::string::npos) bad++;
+  }
+  CHECK(rowsBefore == 1441); // header + 1440 rows
+  CHECK(bad == 0);
+  CHECK(during.compare(during.size() - 7, 7, "0,1439\n") == 0); // newest row of the snapshot
+  CHECK(rowsDuring < rowsBefore);
+  printf("CSV during %u appends: %u of %u rows sent, %u overwritten rows skipped, %u mismatches\n",
+         (unsigned)(next - 3000), (unsigned)(rowsDuring - 1), (unsigned)(rowsBefore - 1),
+         (unsigned)(rowsBefore - rowsDuring), (unsigned)bad);
+  return HostTest::done();
+}
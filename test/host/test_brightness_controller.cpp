@@ -0,0 +1,90 @@
+// Ambient brightness path of the Qlock driver replayed over an ambient trace
+// (see ambient_trace.hpp): AmbientSampler at 250 ms, BrightnessCurve lookup,
+// BrightnessController fed per sample and updated per 10 ms frame.
+// Reports strip pushes per hour against re-pushing on every sample (the old
+// behaviour), on every change of the mapped value, and the steps the mapped
+// value travels (what stepping through every level costs without the
+// deadband). Checks the slew bound: at most one step per frame and
+// AMBIENT_SLEW_PER_S steps per second.
+#include "hal/AmbientSampler.hpp"
+#include "hal/BrightnessController.hpp"
+#include "hal/BrightnessCurve.hpp"
+#include "host_test.hpp"
+#include "ambient_trace.hpp"
+
+static const std::vector<uint16_t>* s_trace;
+static size_t s_next;
+static int readTrace(uint8_t) { return (*s_trace)[s_next++ % s_trace->size()]; }
+
+int main() {
+  static constexpr uint32_t SAMPLE_MS = 250;
+  static constexpr uint32_t FRAME_MS = 10;
+  static const char* const NAMES[] = { "linear", "gamma", "cie" };
+  const std::vector<uint16_t> trace = AmbientTrace::load(3600, SAMPLE_MS);
+  const double hours = trace.size() * SAMPLE_MS / 3600000.0;
+  Host::adc = readTrace;
+  s_trace = &trace;
+
+  printf("%-7s %6s %13s %14s %13s %11s %10s %11s\n", "curve", "window", "every sample", "mapped change",
+         "mapped steps", "controller", "max/frame", "max/second");
+  for (uint8_t c = BrightnessCurve::Linear; c <= BrightnessCurve::CieL; ++c) {
+    for (uint8_t window : { 1, 20 }) { // unfiltered, and the driver default
+      s_next = 0;
+      AmbientSampler sampler;
+      sampler.configure(window, AmbientSampler::Average);
+      sampler.begin(4, SAMPLE_MS);
+      uint8_t lut[BrightnessCurve::LUT_SIZE];
+      BrightnessCurve::build(lut, 10, 100, 1000, (BrightnessCurve::Curve)c);
+      BrightnessController ctl;
+
+      uint32_t samples = 0, mappedChanges = 0, mappedSteps = 0, pushes = 0;
+      int maxFrame = 0, maxSecond = 0;
+      int lastMapped = -1;
+      std::vector<uint8_t> outputs; // per frame, for the per-second bound
+      outputs.reserve(trace.size() * (SAMPLE_MS / FRAME_MS));
+      for (uint32_t nowMs = 0; nowMs < trace.size() * SAMPLE_MS; nowMs += FRAME_MS) {
+        if (nowMs % SAMPLE_MS == 0) Host::fireTimer();
+        if (sampler.poll()) {
+          const uint8_t mapped = BrightnessCurve::lookup(lut, sampler.value());
+          samples++;
+          if (lastMapped >= 0) mappedSteps += abs((int)mapped - lastMapped);
+          mappedChanges += mapped != lastMapped;
+          lastMapped = mapped;
+          ctl.setTarget(mapped);
+        }
+        if (ctl.update(nowMs)) pushes++;
+        if (!outputs.empty()) maxFrame = max(maxFrame, abs((int)ctl.output() - (int)outputs.back()));
+        outputs.push_back(ctl.output());
+      }
+      const size_t perSecond = 1000 / FRAME_MS;
+      for (size_t i = perSecond; i < outputs.size(); ++i) {
+        maxSecond = max(maxSecond, abs((int)outputs[i] - (int)outputs[i - perSecond]));
+      }
+      // Q8 slew plus the rounding of the 8-bit output
+      CHECK(maxFrame <= 1);
+      CHECK(maxSecond <= AMBIENT_SLEW_PER_S + 1);
+      CHECK(pushes < mappedSteps);
+      // Settled on the last target, or within the deadband of the last sample
+      CHECK(abs((int)ctl.output() - lastMapped) <= AMBIENT_DEADBAND);
+      printf("%-7s %6u %13.0f %14.0f %13.0f %11.0f %10d %11d\n", NAMES[c], (unsigned)window, samples / hours,
+             mappedChanges / hours, mappedSteps / hours, pushes / hours, maxFrame, maxSecond);
+    }
+  }
+  printf("pushes per hour over %.1f h of samples every %u ms, frames every %u ms\n", hours, (unsigned)SAMPLE_MS,
+         (unsigned)FRAME_MS);
+
+  // A settings change bypasses the deadband and the confirmation
+  BrightnessController ctl;
+  ctl.setTarget(100);
+  ctl.update(0);
+  ctl.setTarget(102, true);
+  uint32_t t = 0;
+  while (ctl.moving() && t < 1000) ctl.update(t += FRAME_MS);
+  CHECK(ctl.output() == 102);
+  // A single out-of-band sample is not followed; a confirmed one is
+  ctl.setTarget(150);
+  CHECK(ctl.target() == 102);
+  ctl.setTarget(150);
+  CHECK(ctl.target() == 150);
+  return HostTest::done();
+}
@@ -0,0 +1,69 @@
+// BrightnessCurve tables for every curve over a grid of min/max/threshold
+// settings: output never rises with more ambient light, the dark end is the
+// max% duty, the bright end lands on the min% duty, and the linear table
+// stays within its 16-count bucket of the per-sample float mapping it replaced.
+#include "hal/BrightnessCurve.hpp"
+#include "host_test.hpp"
+
+// The mapping applyToHardware() computed per frame before the table
+static uint8_t previousLinear(uint16_t a, uint8_t minPct, uint8_t maxPct, uint16_t thr) {
+  if (a <= thr) return (uint8_t)lroundf((maxPct / 100.0f) * 255.0f);
+  const uint16_t denom = (uint16_t)(4095 - thr);
+  const float t = denom == 0 ? 1.0f : (float)(a - thr) / (float)denom;
+  const float pct = (float)maxPct + t * ((float)minPct - (float)maxPct);
+  return (uint8_t)lroundf((pct / 100.0f) * 255.0f);
+}
+
+int main() {
+  static const char* const NAMES[] = { "linear", "gamma", "cie" };
+  uint32_t tables = 0;
+  int worstLinear = 0;
+  for (uint8_t c = BrightnessCurve::Linear; c <= BrightnessCurve::CieL; ++c) {
+    const auto curve = (BrightnessCurve::Curve)c;
+    for (uint8_t minPct : { 0, 1, 10, 50, 100 }) {
+      for (uint8_t maxPct : { 0, 5, 60, 100 }) {
+        if (maxPct < minPct) continue;
+        for (uint16_t thr : { 0, 8, 1000, 2048, 4000, 4095 }) {
+          uint8_t lut[BrightnessCurve::LUT_SIZE];
+          BrightnessCurve::build(lut, minPct, maxPct, thr, curve);
+          tables++;
+          bool monotonic = true;
+          for (uint16_t i = 1; i < BrightnessCurve::LUT_SIZE; ++i) monotonic &= lut[i] <= lut[i - 1];
+          CHECK(monotonic);
+          const float hi = BrightnessCurve::duty(maxPct, curve) * 255.0f;
+          const float lo = BrightnessCurve::duty(minPct, curve) * 255.0f;
+          // Bucket centres sit 8 counts in from 0 and 7 from full scale
+          if (thr >= 8) CHECK(lut[0] == (uint8_t)lroundf(hi));
+          const float slack = thr < 4095 ? (hi - lo) * 7.0f / (4095 - thr) + 1.0f : hi - lo + 1.0f;
+          CHECK(fabsf(lut[BrightnessCurve::LUT_SIZE - 1] - lo) <= slack);
+          if (!monotonic || (thr >= 8 && lut[0] != (uint8_t)lroundf(hi))) {
+            printf("%s min %u max %u thr %u: lut[0] %u lut[255] %u\n", NAMES[c], (unsigned)minPct,
+                   (unsigned)maxPct, (unsigned)thr, (unsigned)lut[0], (unsigned)lut[255]);
+          }
+          if (curve != BrightnessCurve::Linear || thr == 4095) continue;
+          const float bucket = 255.0f * (maxPct - minPct) / 100.0f * 8.0f / (4095 - thr) + 1.0f;
+          for (uint16_t a = 0; a <= 4095; ++a) {
+            const int d = abs((int)BrightnessCurve::lookup(lut, a) - (int)previousLinear(a, minPct, maxPct, thr));
+            CHECK(d <= bucket);
+            if (d > worstLinear) worstLinear = d;
+          }
+        }
+      }
+    }
+  }
+  // Out-of-range ADC values read the last bucket
+  uint8_t lut[BrightnessCurve::LUT_SIZE];
+  BrightnessCurve::build(lut, 10, 100, 1000, BrightnessCurve::Gamma);
+  CHECK(BrightnessCurve::lookup(lut, 65535) == lut[BrightnessCurve::LUT_SIZE - 1]);
+
+  // Distinct duties in the top quarter of the ADC range, where the output is dimmest
+  for (uint8_t c = BrightnessCurve::Linear; c <= BrightnessCurve::CieL; ++c) {
+    BrightnessCurve::build(lut, 5, 100, 0, (BrightnessCurve::Curve)c);
+    uint32_t steps = 0;
+    for (uint16_t i = 193; i < BrightnessCurve::LUT_SIZE; ++i) steps += lut[i] != lut[i - 1];
+    printf("%-6s 5..100%%: lut[0] %3u, lut[255] %3u, %2u distinct duties in the top ADC quarter\n", NAMES[c],
+           (unsigned)lut[0], (unsigned)lut[255], (unsigned)steps);
+  }
+  printf("%u tables checked; linear table vs per-sample float: max %d step(s), within the 16-count bucket bound\n", (unsigned)tables, worstLinear);
+  return HostTest::done();
+}
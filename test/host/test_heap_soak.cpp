@@ -0,0 +1,281 @@
+// Heap soak: replays a mix of web API calls against a first-fit heap the size
+// of the free DRAM on an ESP32-C3 with Wi-Fi up (and a second, tight one), and
+// reports free heap,
+// largest free block and fragmentation every REPORT_EVERY calls. The handlers
+// run the real Config, Log, HttpMetrics and HeapTrack code; the request,
+// parameter, response and lwIP buffer allocations around them follow the
+// AsyncWebServer pattern (request object, param Strings, a copied response
+// body, TCP buffers freed when acknowledged a few requests later).
+// Every C++ allocation and the firmware's malloc/free go to the model heap.
+// Fails on an allocation failure or if memory is not returned once the
+// configuration is back to its initial values.
+// host-build: -Wl,--wrap=malloc,--wrap=free,--wrap=realloc,--wrap=calloc
+// host-build: -Wl,--wrap=malloc,--wrap=free,--wrap=realloc,--wrap=calloc -DSOAK_HEAP_KB=24
+#include "core/Config.cpp"
+#include "core/HeapTrack.cpp"
+#include "core/Log.cpp"
+#include "services/HttpMetrics.cpp"
+#include "host_test.hpp"
+#include <memory>
+#include <new>
+#include <vector>
+
+#ifndef SOAK_HEAP_KB
+#define SOAK_HEAP_KB 160 // free DRAM after Wi-Fi, AsyncTCP and the web server are up
+#endif
+
+namespace EventLoop { void wakeIn(uint32_t) {} }
+
+// ---- first-fit heap: 16-byte headers, blocks split and coalesced ----
+namespace Heap {
+  static constexpr size_t SIZE = SOAK_HEAP_KB * 1024;
+  static constexpr size_t HDR = 16;
+  struct Block { uint32_t size; uint32_t used; uint64_t pad; }; // size includes the header
+  alignas(16) static uint8_t s_mem[SIZE];
+  static bool s_init = false;
+  static uint32_t s_free = 0;
+  static uint32_t s_failures = 0;
+
+  static Block* at(size_t off) { return (Block*)(s_mem + off); }
+
+  static void init() {
+    at(0)->size = SIZE;
+    at(0)->used = 0;
+    s_free = SIZE - HDR;
+    s_init = true;
+  }
+
+  static void publish() {
+    Host::heapFree = s_free;
+    if (s_free < Host::heapMinFree) Host::heapMinFree = s_free;
+  }
+
+  static void* alloc(size_t n) {
+    if (!s_init) init();
+    const uint32_t need = (uint32_t)((n + HDR + 15) & ~(size_t)15);
+    for (size_t off = 0; off < SIZE; off += at(off)->size) {
+      Block* b = at(off);
+      if (b->used) continue;
+      // Coalesce the free blocks that follow
+      while (off + b->size < SIZE && !at(off + b->size)->used) b->size += at(off + b->size)->size;
+      if (b->size < need) continue;
+      if (b->size - need >= 32) {
+        Block* rest = at(off + need);
+        rest->size = b->size - need;
+        rest->used = 0;
+        b->size = need;
+      }
+      b->used = 1;
+      s_free -= b->size;
+      publish();
+      return b + 1;
+    }
+    s_failures++;
+    return nullptr;
+  }
+
+  static void release(void* p) {
+    if (!p) return;
+    Block* b = (Block*)p - 1;
+    b->used = 0;
+    s_free += b->size;
+    publish();
+  }
+
+  static size_t usable(void* p) { return ((Block*)p - 1)->size - HDR; }
+
+  static uint32_t largest() {
+    uint32_t best = 0;
+    for (size_t off = 0; off < SIZE; ) {
+      uint32_t run = 0;
+      while (off < SIZE && !at(off)->used) { run += at(off)->size; off += at(off)->size; }
+      if (run > HDR && run - HDR > best) best = run - HDR;
+      if (off < SIZE) off += at(off)->size;
+    }
+    return best;
+  }
+}
+
+extern "C" {
+  void* __wrap_malloc(size_t n) { return Heap::alloc(n); }
+  void __wrap_free(void* p) { Heap::release(p); }
+  void* __wrap_calloc(size_t n, size_t size) {
+    void* p = Heap::alloc(n * size);
+    if (p) memset(p, 0, n * size);
+    return p;
+  }
+  void* __wrap_realloc(void* p, size_t n) {
+    void* q = Heap::alloc(n);
+    if (q && p) memcpy(q, p, min(n, Heap::usable(p)));
+    if (q) Heap::release(p);
+    return q;
+  }
+}
+void* operator new(size_t n) { void* p = Heap::alloc(n); if (!p) throw std::bad_alloc(); return p; }
+void* operator new[](size_t n) { return operator new(n); }
+void operator delete(void* p) noexcept { Heap::release(p); }
+void operator delete[](void* p) noexcept { Heap::release(p); }
+void operator delete(void* p, size_t) noexcept { Heap::release(p); }
+void operator delete[](void* p, size_t) noexcept { Heap::release(p); }
+
+// ---- request model ----
+struct Request {
+  char object[296]; // AsyncWebServerRequest and its client bookkeeping
+  std::vector<std::pair<String, String>> params;
+  String response;  // AsyncBasicResponse keeps a copy of the body
+};
+
+static Config s_cfg;
+static std::vector<void*> s_tcpUnacked;   // sent segments waiting for the ACK
+static uint32_t s_rng = 12345;
+static uint32_t rnd(uint32_t n) { s_rng = s_rng * 1103515245u + 12345u; return (s_rng >> 8) % n; }
+
+static void reply(Request& r, const String& body) {
+  HttpMetrics::addResponseBytes(body.length());
+  r.response = body;
+}
+
+static void apiStatus(Request& r) {
+  String json;
+  json.reserve(640);
+  json += "{\"ok\":true,\"wifi\":{\"mode\":\"AP_STA\",\"ap_ip\":\"" + String("192.168.4.1") + "\",";
+  json += "\"ap_clients\":" + String(0) + ",\"sta_connected\":" + String("true") + ",";
+  json += "\"sta_ip\":\"" + String("192.168.1.57") + "\"},\"time\":{\"synced\":" + String("true") + ",";
+  json += "\"epoch\":" + String((unsigned long)(1760000000 + millis() / 1000)) + ",\"iso\":\"2025-10-09T08:53:20\"},";
+  s_cfg.appendJson(json);
+  json += "}";
+  reply(r, json);
+}
+
+static void apiColor(Request& r) {
+  char hex[8];
+  snprintf(hex, sizeof(hex), "#%06X", (unsigned)rnd(0x1000000));
+  r.params.push_back({ String("hex"), String(hex) });
+  uint8_t cr, cg, cb;
+  if (parseHexColor(r.params[0].second, cr, cg, cb)) LOGI("/api/color hex=%s -> rgb(%u,%u,%u)", hex, cr, cg, cb);
+  reply(r, String("{\"ok\":true}"));
+}
+
+// configRoute(): validate, stage, commit (saves the record)
+static void apiConfig(Request& r, Config::Field f, const String& value) {
+  r.params.push_back({ String(Config::paramKey(f)), value });
+  for (int pass = 0; pass < 2; ++pass) {
+    if (s_cfg.set(f, r.params[0].second, pass == 1) == Config::SetResult::Invalid) {
+      reply(r, String("{\"ok\":false,\"err\":\"bad ") + Config::paramKey(f) + "\"}");
+      return;
+    }
+  }
+  reply(r, s_cfg.commit() ? String("{\"ok\":true}") : String("{\"ok\":false}"));
+}
+
+static String randomName(const char* prefix) {
+  String s(prefix);
+  for (uint32_t n = rnd(20); n; --n) s += (char)('a' + rnd(26));
+  return s;
+}
+
+static void apiSettings(Request& r) {
+  switch (rnd(4)) {
+    case 0: apiConfig(r, Config::Field::net_hostname, randomName("clock-")); break;
+    case 1: apiConfig(r, Config::Field::mqtt_host, randomName("broker.")); break;
+    case 2: apiConfig(r, Config::Field::led_brightness, String(rnd(256))); break;
+    default: apiConfig(r, Config::Field::ntp_timezone, rnd(2) ? String("CET-1CEST,M3.5.0,M10.5.0/3") : String("UTC0")); break;
+  }
+}
+
+static void metrics(Request& r) {
+  auto cursor = std::make_shared<HttpMetrics::Cursor>();
+  uint8_t* chunk = (uint8_t*)malloc(1436); // AsyncChunkedResponse fills one TCP segment at a time
+  size_t total = 0;
+  for (size_t n; (n = HttpMetrics::renderChunk(*cursor, chunk, 1436)) > 0; ) total += n;
+  free(chunk);
+  HttpMetrics::addResponseBytes(total);
+  (void)r;
+}
+
+static void apiLog(Request& r) { Log::drain(); reply(r, Log::tail()); }
+
+static void apiHeap(Request& r) {
+  String json;
+  json.reserve(640);
+  HeapTrack::appendJson(json);
+  reply(r, json);
+}
+
+struct Route { const char* path; uint8_t weight; void (*fn)(Request&); uint8_t id; };
+static Route s_routes[] = {
+  { "/api/status", 35, apiStatus, 0 },
+  { "/api/color", 30, apiColor, 0 },
+  { "/api/settings", 15, apiSettings, 0 },
+  { "/metrics", 10, metrics, 0 },
+  { "/api/log", 5, apiLog, 0 },
+  { "/api/heap", 5, apiHeap, 0 },
+};
+
+static void handle() {
+  uint32_t pick = rnd(100);
+  Route* route = s_routes;
+  while (pick >= route->weight) { pick -= route->weight; ++route; }
+  void* rx = malloc(536 + rnd(1000));   // pbuf holding the request
+  Request* req = new Request();
+  free(rx);
+  {
+    HttpMetrics::Scope scope(route->id);
+    route->fn(*req);
+  }
+  s_tcpUnacked.push_back(malloc(req->response.length() + 54));
+  delete req;
+  // Segments are acknowledged a few requests later, in arrival order
+  while (s_tcpUnacked.size() > 1 + rnd(4)) {
+    free(s_tcpUnacked.front());
+    s_tcpUnacked.erase(s_tcpUnacked.begin());
+  }
+  Host::advanceMs(50 + rnd(2000));
+  HeapTrack::loop();
+}
+
+int main() {
+  static constexpr uint32_t CALLS = 20000;
+  static constexpr uint32_t REPORT_EVERY = 2000;
+  Host::heapSize = Heap::SIZE;
+  Host::largestBlock = Heap::largest;
+  for (Route& r : s_routes) r.id = HttpMetrics::registerRoute(r.path, "GET");
+  s_tcpUnacked.reserve(8);
+  s_cfg.load();
+  s_cfg.save(); // a configured clock has its record
+  const Config initial = s_cfg;
+  for (uint32_t i = 0; i < 200; ++i) LOGI("boot line %u", (unsigned)i); // fill the log tail
+  Log::drain();
+  const uint32_t baseline = Heap::s_free;
+  Host::heapMinFree = baseline;
+
+  printf("%7s %8s %8s %8s %6s\n", "calls", "free", "minFree", "largest", "frag%");
+  printf("%7u %8u %8u %8u %6u\n", 0u, (unsigned)baseline, (unsigned)Host::heapMinFree, (unsigned)Heap::largest(), 0u);
+  uint32_t worstLargest = UINT32_MAX;
+  for (uint32_t i = 1; i <= CALLS; ++i) {
+    handle();
+    const uint32_t largest = Heap::largest();
+    if (largest < worstLargest) worstLargest = largest;
+    if (i % REPORT_EVERY == 0) {
+      printf("%7u %8u %8u %8u %6u\n", (unsigned)i, (unsigned)Heap::s_free, (unsigned)Host::heapMinFree,
+             (unsigned)largest, (unsigned)(100 - (uint64_t)largest * 100 / Heap::s_free));
+    }
+  }
+  printf("smallest largest-block over the run: %u bytes\n", (unsigned)worstLargest);
+  {
+    String json;
+    HeapTrack::appendJson(json);
+    printf("/api/heap: %s\n", json.c_str());
+  }
+
+  // Back to the initial configuration with nothing in flight: no leak
+  for (void* p : s_tcpUnacked) free(p);
+  s_tcpUnacked.clear();
+  s_cfg.~Config(); // assignment would keep the grown String buffers
+  new (&s_cfg) Config(initial);
+  s_cfg.save();
+  CHECK(Heap::s_failures == 0);
+  CHECK(Heap::s_free == baseline);
+  if (Heap::s_free != baseline) printf("free %u, baseline %u\n", (unsigned)Heap::s_free, (unsigned)baseline);
+  return HostTest::done();
+}
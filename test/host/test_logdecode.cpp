@@ -0,0 +1,67 @@
+// Binary log round trip on Linux: records written through the LOG* macros are
+// drained as frames, mixed with plain text, and decoded by tools/logdecode.py
+// against this executable (non-PIE, so string addresses match the ELF). The
+// decoded text must equal what printf produces for the same calls.
+// host-build: -DLOG_BINARY=1 -no-pie
+#include "core/Log.cpp"
+#include "host_test.hpp"
+#include <unistd.h>
+
+static std::string s_expected;
+
+static void expect(uint8_t level, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+static void expect(uint8_t level, const char* fmt, ...) {
+  if (level > Log::level()) return;
+  char text[256];
+  va_list ap;
+  va_start(ap, fmt);
+  vsnprintf(text, sizeof(text), fmt, ap);
+  va_end(ap);
+  char line[300];
+  snprintf(line, sizeof(line), "%lu [%c] %s: %s\n", millis(), "?EWID"[level], LOG_TAG, text);
+  s_expected += line;
+}
+
+#define BOTH(lvl, fmt, ...) do { LOG_AT(lvl, fmt, ##__VA_ARGS__); expect(lvl, fmt, ##__VA_ARGS__); } while (0)
+
+static void text(const char* s) {
+  Log::drain();
+  Host::serial += s;
+  s_expected += s;
+}
+
+int main() {
+  Host::captureSerial = true;
+  text("ESP-ROM:esp32c3-api1-20210207\nboot text without frames\n");
+  Host::nowUs = 1234000;
+  BOTH(Log::Info, "WiFi connecting to %s...", "HomeNetwork");
+  BOTH(Log::Warn, "v=%d u=%u x=%04X c=%c f=%.2f ll=%lld %%", -5, 7u, 0xab, 'Z', 3.14159, -1234567890123LL);
+  Host::nowUs = 4294967295000ULL; // millis() at its wrap point
+  BOTH(Log::Error, "no args");
+  BOTH(Log::Info, "ptr %p, empty '%s', width [%8s] [%-5d]", (void*)0x1000, "", "right", 42);
+  text("core debug output between frames\n");
+  Host::nowUs = 60000000;
+  BOTH(Log::Info, "heap: largest free block %u < %u bytes (free %u, min free %u)", 7000u, 8192u, 51234u, 40000u);
+  BOTH(Log::Debug, "above LOG_LEVEL, not in the capture");
+  Log::drain();
+
+  char capture[] = "/tmp/ezclock-logXXXXXX";
+  const int fd = mkstemp(capture);
+  CHECK(fd >= 0 && write(fd, Host::serial.data(), Host::serial.size()) == (ssize_t)Host::serial.size());
+  close(fd);
+  char exe[512];
+  const ssize_t n = readlink("/proc/self/exe", exe, sizeof(exe) - 1);
+  exe[n > 0 ? n : 0] = 0;
+  std::string cmd = std::string("python3 tools/logdecode.py ") + exe + " " + capture;
+  FILE* p = popen(cmd.c_str(), "r");
+  std::string decoded;
+  char buf[512];
+  for (size_t got; p && (got = fread(buf, 1, sizeof(buf), p)) > 0; ) decoded.append(buf, got);
+  CHECK(p && pclose(p) == 0);
+  unlink(capture);
+
+  CHECK(decoded == s_expected);
+  if (decoded != s_expected) printf("decoded:\n%s\nexpected:\n%s", decoded.c_str(), s_expected.c_str());
+  printf("%zu capture bytes decoded to %zu bytes of text\n", Host::serial.size(), decoded.size());
+  return HostTest::done();
+}
@@ -0,0 +1,174 @@
+// Wakeups of an idle, synced Qlock from the deadlines its stages ask for. Runs
+// the real EventLoop, HeapTrack, AmbientHistory, RadioPolicy and Qlock driver
+// (with its ambient sampling timer); the loop() of main.cpp and the render
+// task's HalTask::run() need FreeRTOS and are mirrored here. TimeSvc is synced
+// and logs every 10 s; MQTT is disabled (test_mqtt counts its own wakeups).
+// Reports loop and render-task wakeups per second:
+// - before OTA comes up, the OTA window after it does, the idle hour after
+//   that, and the minute after a web request reopens the window
+// - with the driver on its render task (RENDER_TASK 1) and on the loop (0)
+// - the last two builds put back the constants from before the stages raised
+//   their idle periods (OTA polled for good, heap check, loop and render caps
+//   at 1 s), which gave the earlier 5 / 2 / 1 wakeups/s
+// host-build: -DUSE_QLOCK3030=1
+// host-build: -DUSE_QLOCK3030=1 -DRENDER_TASK=0
+// host-build: -DUSE_QLOCK3030=1 -DQLOCK_SECONDS_PROGRESS=0
+// host-build: -DUSE_QLOCK3030=1 -DQLOCK_SECONDS_PROGRESS=0 -DRENDER_TASK=0
+// host-build: -DUSE_QLOCK3030=1 -DRENDER_TASK=0 -DOLD_DEADLINES=1 -DOTA_WINDOW_MS=0xFFFFFFFF -DHEAP_CHECK_MS=1000 -DEVENT_MAX_IDLE_MS=1000 -DRENDER_MAX_IDLE_MS=1000 -DQLOCK_FOLLOW_MS=60001
+// host-build: -DUSE_QLOCK3030=1 -DRENDER_TASK=0 -DOLD_DEADLINES=1 -DOTA_WINDOW_MS=0xFFFFFFFF -DHEAP_CHECK_MS=1000 -DEVENT_MAX_IDLE_MS=1000 -DRENDER_MAX_IDLE_MS=1000 -DQLOCK_FOLLOW_MS=60001 -DQLOCK_SECONDS_PROGRESS=0
+#include "core/EventLoop.cpp"
+#include "core/HeapTrack.cpp"
+#include "core/Log.cpp"
+#include "services/Admission.cpp"
+#include "services/AmbientHistory.cpp"
+#include <WiFi.h> // RadioPolicy.cpp includes it on ESP32 only
+#include "services/RadioPolicy.cpp"
+#include "hal/Driver_Qlock3030.cpp"
+#include "host_test.hpp"
+
+// main.cpp and HalTask.cpp defaults
+#ifndef RENDER_TASK
+#define RENDER_TASK 1
+#endif
+#ifndef OTA_POLL_MS
+#define OTA_POLL_MS 500
+#endif
+#ifndef OTA_WINDOW_MS
+#define OTA_WINDOW_MS 600000
+#endif
+#ifndef RENDER_FRAME_MS
+#define RENDER_FRAME_MS 10
+#endif
+#ifndef RENDER_MAX_IDLE_MS
+#define RENDER_MAX_IDLE_MS 10000
+#endif
+#ifndef OLD_DEADLINES
+#define OLD_DEADLINES 0 // 1 = the build line restores the earlier constants
+#endif
+
+// Synced, with the 10 s time log of TimeService.cpp
+namespace TimeSvc {
+  static uint32_t s_lastLog = 0;
+  bool isSynced() { return true; }
+  bool getLocal(struct tm& out) {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    const time_t t = tv.tv_sec;
+    gmtime_r(&t, &out);
+    return true;
+  }
+  void loop() {
+    const uint32_t nowMs = millis();
+    if (nowMs - s_lastLog < 10000) { EventLoop::wakeIn(10000 - (nowMs - s_lastLog)); return; }
+    s_lastLog = nowMs;
+    EventLoop::wakeIn(10000);
+  }
+}
+
+static HalDriver* s_drv = nullptr;
+static bool s_otaReady = false;
+static uint32_t s_otaReadyMs = 0;
+static uint64_t s_renderAtUs = 0;  // next render-task frame
+static uint64_t s_sampleAtUs = 0;  // next ambient sampling timer tick
+static uint32_t s_renderWakeups = 0;
+
+// main.cpp loop() with MQTT disabled, up to EventLoop::wait()
+static void loopPass() {
+  TimeSvc::loop();
+  RadioPolicy::loop();
+#if !RENDER_TASK
+  s_drv->loop();
+  EventLoop::wakeIn(s_drv->idleMs(millis()));
+#endif
+  AmbientHistory::loop(s_drv);
+  if (s_otaReady) {
+    const uint32_t nowMs = millis();
+    if (nowMs - s_otaReadyMs < OTA_WINDOW_MS || nowMs - RadioPolicy::lastTouchMs() < OTA_WINDOW_MS)
+      EventLoop::wakeIn(OTA_POLL_MS);
+  }
+  HeapTrack::loop();
+  Log::drain(); // the log task's work, kept off stdout
+}
+
+// HalTask::run(), one frame
+static void renderFrame() {
+  Host::nowUs = s_renderAtUs;
+  s_drv->loop();
+  s_renderWakeups++;
+  const uint32_t idle = s_drv->idleMs(millis());
+  if (idle <= RENDER_FRAME_MS) s_renderAtUs += RENDER_FRAME_MS * 1000ULL;
+  else s_renderAtUs = Host::nowUs + min<uint32_t>(idle, RENDER_MAX_IDLE_MS) * 1000ULL;
+}
+
+// While the loop task blocks, the sampling timer and the render task run in
+// time order; then EventLoop::wait() sleeps the same span and counts the wakeup
+static void wait() {
+  const uint64_t t0 = Host::nowUs;
+  const uint64_t end = t0 + max<uint32_t>(EventLoop::s_deadlineMs, EVENT_MIN_WAIT_MS) * 1000ULL;
+  for (;;) {
+    const uint64_t render = RENDER_TASK ? s_renderAtUs : UINT64_MAX;
+    const uint64_t next = min(render, s_sampleAtUs);
+    if (next >= end) break;
+    if (next == s_sampleAtUs) {
+      Host::nowUs = s_sampleAtUs;
+      if (Host::timer.running) Host::fireTimer();
+      s_sampleAtUs += Host::timer.periodUs ? Host::timer.periodUs : 1000;
+    } else {
+      renderFrame();
+    }
+  }
+  Host::nowUs = t0;
+  EventLoop::wait();
+}
+
+static void runUntil(uint32_t ms) {
+  while (millis() < ms) { loopPass(); wait(); }
+}
+
+struct Rate { double loop, render; };
+
+static Rate measure(const char* name, uint32_t seconds) {
+  const uint32_t loop0 = EventLoop::s_wakeups, render0 = s_renderWakeups, t0 = millis();
+  runUntil(t0 + seconds * 1000);
+  const double span = (millis() - t0) / 1000.0;
+  const Rate r{ (EventLoop::s_wakeups - loop0) / span, (s_renderWakeups - render0) / span };
+  printf("%-24s loop %5.2f/s  render task %5.2f/s\n", name, r.loop, r.render);
+  return r;
+}
+
+int main() {
+  Host::adc = [](uint8_t) { return 2000; };
+  Host::captureSerial = true;
+  EventLoop::begin();
+  s_drv = createDefaultDriver();
+  s_drv->begin();
+  RadioPolicy::begin();
+  printf("RENDER_TASK %d, QLOCK_SECONDS_PROGRESS %d%s\n", RENDER_TASK, QLOCK_SECONDS_PROGRESS,
+         OLD_DEADLINES ? ", deadlines as before" : "");
+
+  runUntil(60000); // first frame, brightness settles, radio goes to modem sleep
+  CHECK(RadioPolicy::powerSave());
+  const Rate before = measure("OTA not up", 600);
+  s_otaReady = true;
+  s_otaReadyMs = millis();
+  const Rate window = measure("OTA window", 600);
+  const Rate idle = measure("idle hour after it", 3600);
+  RadioPolicy::touch(); // a web request (Event::Web)
+  loopPass();
+  wait();
+  const Rate web = measure("minute after a request", 60);
+
+  HalTelemetry t{};
+  s_drv->getTelemetry(t);
+  CHECK(t.framesShown > 0);
+  // The OTA poll runs only inside its window
+  CHECK(window.loop >= 1000.0 / OTA_POLL_MS && web.loop >= 1000.0 / OTA_POLL_MS);
+  if (OTA_WINDOW_MS < 0xFFFFFFFFu) CHECK(idle.loop <= before.loop + 0.01);
+  // Render task: the loop only wakes for the 5 s ambient history sample and
+  // the 10 s time log and heap check
+  if (RENDER_TASK && !OLD_DEADLINES) CHECK(idle.loop <= 0.25);
+  // Driver (either task): the dot step or the QLOCK_FOLLOW_MS check, whichever is sooner
+  const double drv = RENDER_TASK ? idle.render : idle.loop;
+  if (!OLD_DEADLINES) CHECK(drv <= (QLOCK_SECONDS_PROGRESS ? 255.0 / 60 : 1000.0 / QLOCK_FOLLOW_MS) + 0.3);
+  return HostTest::done();
+}
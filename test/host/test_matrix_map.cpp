@@ -0,0 +1,114 @@
+// Matrix::Map builders: rejected tables at compile time, then a walk over
+// every cell and every strip index of the word-clock panel and of serpentine
+// panels:
+// - led[r][c] and cell[i] are inverses, and every LED has exactly one cell
+// - fromTable() reports out-of-range, duplicate and missing indices
+// - serpentine() snakes row by row (top-down and bottom-up), consecutive
+//   LEDs are neighbors, and fromTable() of its own led[][] gives it back
+// - Frame::at() / forEach() address the right pixels
+#include "hal/MatrixMap.hpp"
+#include "hal/WordClock.hpp"
+#include "host_test.hpp"
+
+constexpr uint8_t X = 0xFF;
+constexpr uint8_t GOOD[2][3] = { { 0, X, 1 }, { 3, X, 2 } };
+constexpr uint8_t TOO_HIGH[2][3] = { { 0, X, 1 }, { 4, X, 2 } };
+constexpr uint8_t TWICE[2][3] = { { 0, X, 1 }, { 1, X, 2 } };
+constexpr uint8_t GAP[2][3] = { { 0, X, X }, { 3, X, 2 } };
+constexpr auto SMALL = Matrix::fromTable<2, 3, 4>(GOOD, X);
+static_assert(SMALL.error == Matrix::Ok, "");
+static_assert(SMALL.led[0][1] == Matrix::NONE && SMALL.led[1][0] == 3 && SMALL.cell[2].row == 1 && SMALL.cell[2].col == 2, "");
+static_assert(SMALL.at(-1, 0) == Matrix::NONE && SMALL.at(0, 3) == Matrix::NONE && SMALL.at(2, 0) == Matrix::NONE, "");
+static_assert(Matrix::fromTable<2, 3, 4>(TOO_HIGH, X).error == Matrix::OutOfRange, "index 4 of 4");
+static_assert(Matrix::fromTable<2, 3, 4>(TWICE, X).error == Matrix::Duplicate, "1 twice");
+static_assert(Matrix::fromTable<2, 3, 4>(GAP, X).error == Matrix::Missing, "1 never placed");
+static_assert(Matrix::fromTable<2, 3, 3>(GOOD, X).error == Matrix::OutOfRange, "Count smaller than the table");
+
+constexpr auto SNAKE = Matrix::serpentine<3, 4>();
+constexpr auto SNAKE_UP = Matrix::serpentine<3, 4>(true);
+static_assert(SNAKE.error == Matrix::Ok && SNAKE.COUNT == 12, "");
+static_assert(SNAKE.led[0][0] == 0 && SNAKE.led[0][3] == 3 && SNAKE.led[1][3] == 4 && SNAKE.led[1][0] == 7 && SNAKE.led[2][0] == 8, "");
+static_assert(SNAKE_UP.led[2][0] == 0 && SNAKE_UP.led[1][3] == 4 && SNAKE_UP.led[0][0] == 8 && SNAKE_UP.led[0][3] == 11, "");
+
+// Inverse tables agree both ways and cover exactly COUNT cells
+template <class M>
+static uint16_t walk(const M& m) {
+  uint16_t real = 0;
+  for (uint8_t r = 0; r < M::ROWS; ++r) {
+    for (uint8_t c = 0; c < M::COLS; ++c) {
+      const uint16_t i = m.led[r][c];
+      CHECK(m.at(r, c) == i);
+      if (i == Matrix::NONE) continue;
+      ++real;
+      CHECK(i < M::COUNT && m.cell[i].row == r && m.cell[i].col == c);
+    }
+  }
+  for (uint16_t i = 0; i < M::COUNT; ++i) CHECK(m.led[m.cell[i].row][m.cell[i].col] == i);
+  CHECK(real == M::COUNT);
+  return real;
+}
+
+// Hand-written 3 x 4 snakes
+static const uint16_t DOWN[3][4] = { { 0, 1, 2, 3 }, { 7, 6, 5, 4 }, { 8, 9, 10, 11 } };
+static const uint16_t UP[3][4] = { { 8, 9, 10, 11 }, { 7, 6, 5, 4 }, { 0, 1, 2, 3 } };
+
+template <uint8_t R, uint8_t C>
+static void checkSerpentine(bool bottomUp, const uint16_t (*want)[4]) {
+  const auto m = Matrix::serpentine<R, C>(bottomUp);
+  CHECK(m.error == Matrix::Ok);
+  walk(m);
+  // Consecutive strip indices are adjacent cells
+  for (uint16_t i = 1; i < m.COUNT; ++i)
+    CHECK(abs(m.cell[i].row - m.cell[i - 1].row) + abs(m.cell[i].col - m.cell[i - 1].col) == 1);
+  // Round trip through the forward table
+  const auto back = Matrix::fromTable<R, C, (uint16_t)(R * C)>(m.led, Matrix::NONE);
+  CHECK(back.error == Matrix::Ok);
+  CHECK(!memcmp(back.led, m.led, sizeof(m.led)) && !memcmp(back.cell, m.cell, sizeof(m.cell)));
+  if (want)
+    for (uint8_t r = 0; r < R; ++r)
+      for (uint8_t c = 0; c < C; ++c) CHECK(m.led[r][c] == want[r][c]);
+}
+
+int main() {
+  CHECK(walk(SMALL) == 4);
+
+  // Word-clock panel as the Qlock driver builds it: 156 cells, 114 LEDs
+  constexpr auto panel = Matrix::fromTable<WordClock::ROWS, WordClock::COLS, WordClock::LED_COUNT>(WordClock::LED_AT, WordClock::NO_LED);
+  CHECK(panel.error == Matrix::Ok);
+  CHECK(walk(panel) == 114);
+  CHECK(panel.cell[0].row == 11 && panel.cell[0].col == 0 && panel.cell[113].row == 0 && panel.cell[113].col == 0);
+
+  // Break the panel table one way at a time
+  uint8_t table[WordClock::ROWS][WordClock::COLS];
+  memcpy(table, WordClock::LED_AT, sizeof(table));
+  table[5][5] = table[5][6];
+  CHECK((Matrix::fromTable<WordClock::ROWS, WordClock::COLS, WordClock::LED_COUNT>(table, WordClock::NO_LED).error == Matrix::Duplicate));
+  memcpy(table, WordClock::LED_AT, sizeof(table));
+  table[5][5] = WordClock::NO_LED;
+  CHECK((Matrix::fromTable<WordClock::ROWS, WordClock::COLS, WordClock::LED_COUNT>(table, WordClock::NO_LED).error == Matrix::Missing));
+  memcpy(table, WordClock::LED_AT, sizeof(table));
+  table[0][5] = WordClock::LED_COUNT;
+  CHECK((Matrix::fromTable<WordClock::ROWS, WordClock::COLS, WordClock::LED_COUNT>(table, WordClock::NO_LED).error == Matrix::OutOfRange));
+
+  checkSerpentine<3, 4>(false, DOWN);
+  checkSerpentine<3, 4>(true, UP);
+  checkSerpentine<1, 7>(false, nullptr);
+  checkSerpentine<16, 16>(false, nullptr);
+  checkSerpentine<15, 16>(true, nullptr);
+
+  // Frame: cell addressing writes the strip-order buffer
+  uint16_t px[12] = {};
+  Matrix::Frame<decltype(SNAKE), uint16_t> frame(SNAKE, px);
+  for (uint8_t r = 0; r < 3; ++r)
+    for (uint8_t c = 0; c < 4; ++c) *frame.at(r, c) = (uint16_t)(r * 10 + c);
+  CHECK(frame.at(-1, 0) == nullptr && frame.at(3, 0) == nullptr && frame.at(0, 4) == nullptr);
+  CHECK(px[4] == 13 && px[7] == 10 && frame[8] == 20);
+  uint16_t next = 0;
+  frame.forEach([&](uint16_t led, Matrix::Cell cell, uint16_t& v) {
+    CHECK(led == next++ && v == cell.row * 10 + cell.col);
+  });
+  CHECK(next == 12);
+  printf("panel %ux%u: %u LEDs, serpentine 3x4 / 1x7 / 16x16 / 15x16 up: inverse tables agree\n",
+         (unsigned)panel.ROWS, (unsigned)panel.COLS, (unsigned)panel.COUNT);
+  return HostTest::done();
+}
@@ -0,0 +1,378 @@
+// MQTT client against a scripted broker: the real MqttService on the loop
+// (EventLoop) with stubs/AsyncTCP.h as the network. The broker decodes what
+// the clock sends with its own parser and answers CONNECT, SUBSCRIBE and
+// PINGREQ unless told not to.
+// - remaining-length encoding at every byte-count boundary
+// - CONNECT byte for byte; SUBSCRIBE, PUBLISH and discovery frames decoded
+// - inbound PUBLISH split across reads, packed together, with 2-byte lengths
+// - oversized and malformed frames close the connection
+// - connect, CONNACK and keepalive timeouts recover without a disconnect callback
+// - a web UI change goes out with the next batch, not the next idle poll
+// - an idle online hour: frames sent and loop wakeups
+#include "core/Config.cpp"
+#include "core/Log.cpp"
+#include "core/EventLoop.cpp"
+#include "host_test.hpp"
+#include <map>
+#include <vector>
+
+// The client only builds for ESP32 (AsyncTCP); the locks are single-task here
+#define ARDUINO_ARCH_ESP32 1
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(m) (void)(m)
+#define portEXIT_CRITICAL(m) (void)(m)
+namespace TimeSvc {
+  bool isSynced() { return true; }
+}
+#include "services/MqttService.cpp"
+#undef ARDUINO_ARCH_ESP32
+
+struct FakeHal : HalDriver {
+  std::vector<int> brightness; // setBrightness() calls
+  uint8_t r = 0, g = 0, b = 0;
+  uint16_t ambient = 1200;
+  void begin() override {}
+  void loop() override {}
+  void setPixel(uint16_t, uint8_t, uint8_t, uint8_t) override {}
+  void fill(uint8_t ir, uint8_t ig, uint8_t ib) override { r = ir; g = ig; b = ib; }
+  void clear() override {}
+  void show() override {}
+  uint16_t size() const override { return 0; }
+  void setBrightness(uint8_t s) override { brightness.push_back(s); }
+  bool getAmbientReading(uint16_t& raw, uint16_t& avg) override { raw = avg = ambient; return true; }
+};
+
+struct Frame {
+  uint8_t type;
+  size_t lengthBytes; // bytes of the remaining-length field
+  std::string body;
+};
+
+// MQTT 3.1.1 section 2.2.3, independent of the client's encoder
+static bool decode(const std::string& s, size_t& off, Frame& f) {
+  if (off + 2 > s.size()) return false;
+  size_t rem = 0, mul = 1, i = off + 1;
+  for (;;) {
+    if (i >= s.size() || i - off > 4) return false;
+    const uint8_t d = (uint8_t)s[i++];
+    rem += (d & 0x7F) * mul;
+    mul *= 128;
+    if (!(d & 0x80)) break;
+  }
+  if (i + rem > s.size()) return false;
+  f.type = (uint8_t)s[off];
+  f.lengthBytes = i - off - 1;
+  f.body = s.substr(i, rem);
+  off = i + rem;
+  return true;
+}
+
+static std::string str16(const std::string& body, size_t& off) {
+  if (off + 2 > body.size()) return std::string();
+  const size_t n = ((uint8_t)body[off] << 8) | (uint8_t)body[off + 1];
+  const std::string s = body.substr(off + 2, n);
+  off += 2 + n;
+  return s;
+}
+
+static std::string publishFrame(const std::string& topic, const std::string& payload) {
+  const size_t rem = 2 + topic.size() + payload.size();
+  std::string f(1, '\x30');
+  size_t n = rem;
+  do { uint8_t d = n % 128; n /= 128; f += (char)(n ? d | 0x80 : d); } while (n);
+  f += (char)(topic.size() >> 8);
+  f += (char)(topic.size() & 0xFF);
+  return f + topic + payload;
+}
+
+struct Broker {
+  AsyncClient* c = nullptr;
+  bool accept = true;       // completes TCP connects
+  bool answerConnect = true;
+  bool answerPing = true;
+  size_t seen = 0;          // c->tx bytes decoded so far
+  std::vector<Frame> frames;
+  uint32_t count[16] = {};  // frames by packet type
+  size_t bytes = 0;
+  std::map<std::string, std::string> retained, last; // topic -> payload
+
+  bool pending() const { return (accept && c->connecting()) || (c->connected() && seen < c->tx.size()); }
+
+  // One delivery as AsyncTCP would make it while the loop task is blocked
+  void deliver() {
+    if (accept && c->connecting()) { c->peerConnected(); return; }
+    Frame f;
+    std::string reply;
+    while (c->connected() && decode(c->tx, seen, f)) {
+      frames.push_back(f);
+      count[f.type >> 4]++;
+      bytes += f.body.size() + 1 + f.lengthBytes;
+      switch (f.type >> 4) {
+        case 1: if (answerConnect) reply += std::string("\x20\x02\x00\x00", 4); break;
+        case 3: {
+          size_t off = 0;
+          const std::string t = str16(f.body, off);
+          last[t] = f.body.substr(off);
+          if (f.type & 1) retained[t] = last[t];
+          break;
+        }
+        case 8: reply += std::string("\x90\x03", 2) + f.body.substr(0, 2) + std::string(1, '\0'); break;
+        case 12: if (answerPing) reply += std::string("\xD0\x00", 2); break;
+      }
+    }
+    if (c->connected() && reply.size()) c->peerData(reply.data(), reply.size());
+  }
+};
+
+static Broker s_broker;
+
+// One loop pass; a broker reply posts Event::Mqtt, which ends the wait early
+static void pass() {
+  MqttSvc::loop();
+  if (s_broker.pending()) EventLoop::wakeIn(1);
+  EventLoop::wait();
+  s_broker.deliver();
+  Log::drain(); // the log task's share of the wait
+}
+
+static uint32_t runFor(uint32_t ms) {
+  const uint32_t w0 = EventLoop::s_wakeups, end = millis() + ms;
+  while ((int32_t)(millis() - end) < 0) pass();
+  return EventLoop::s_wakeups - w0;
+}
+
+static bool runUntil(bool (*cond)(), uint32_t maxMs) {
+  const uint32_t end = millis() + maxMs;
+  while (!cond() && (int32_t)(millis() - end) < 0) pass();
+  return cond();
+}
+
+static bool online() { return MqttSvc::isConnected(); }
+static bool idle() { return MqttSvc::s_state == MqttSvc::State::Idle; }
+
+static void checkRemainingLength() {
+  struct Case { size_t rem; const char* bytes; size_t n; };
+  // The examples of MQTT 3.1.1 table 2.4 plus both sides of each boundary
+  static const Case CASES[] = { { 0, "\x00", 1 }, { 127, "\x7F", 1 }, { 128, "\x80\x01", 2 },
+                                { 16383, "\xFF\x7F", 2 }, { 16384, "\x80\x80\x01", 3 },
+                                { 2097151, "\xFF\xFF\x7F", 3 }, { 2097152, "\x80\x80\x80\x01", 4 },
+                                { 268435455, "\xFF\xFF\xFF\x7F", 4 } };
+  for (const Case& k : CASES) {
+    uint8_t out[5];
+    const size_t n = MqttSvc::encodeHeader(out, 0x30, k.rem);
+    CHECK(n == 1 + k.n && out[0] == 0x30 && !memcmp(out + 1, k.bytes, k.n));
+    std::string s((const char*)out, n);
+    s.append(k.rem < 1024 ? k.rem : 0, 'x');
+    size_t off = 0;
+    Frame f;
+    if (k.rem < 1024) CHECK(decode(s, off, f) && f.body.size() == k.rem && off == s.size());
+  }
+}
+
+static void checkSession(FakeHal& hal) {
+  AsyncClient& c = *MqttSvc::s_client;
+  CHECK(runUntil(online, 5000));
+  CHECK(c.connects == 1 && c.host == "broker.lan" && c.port == 1883);
+
+  // CONNECT: clean session, will "offline" retained at <root>/status, keepalive 120 s
+  static const char CONNECT[] = "\x10\x51" "\x00\x04MQTT\x04\xE6\x00\x78"
+                                "\x00\x0E" "ezclock_a1b2c3"
+                                "\x00\x1D" "ezclock/ezclock_a1b2c3/status"
+                                "\x00\x07" "offline"
+                                "\x00\x05" "clock"
+                                "\x00\x06" "secret";
+  CHECK(c.tx.compare(0, sizeof(CONNECT) - 1, CONNECT, sizeof(CONNECT) - 1) == 0);
+
+  // Session setup and first state, each step one batch
+  runFor(5000);
+  CHECK(s_broker.frames.size() >= 12 && s_broker.seen == c.tx.size());
+  const Frame& sub = s_broker.frames[1];
+  CHECK(sub.type == 0x82);
+  size_t off = 2;
+  CHECK(sub.body.compare(0, 2, std::string("\x00\x01", 2)) == 0);
+  for (const char* sfx : { "/light/set", "/light/bri/set", "/light/rgb/set", "/light/fx/set" }) {
+    CHECK(str16(sub.body, off) == std::string("ezclock/ezclock_a1b2c3") + sfx);
+    CHECK(off < sub.body.size() && sub.body[off++] == 0); // QoS 0
+  }
+  CHECK(off == sub.body.size());
+
+  const std::string root = "ezclock/ezclock_a1b2c3";
+  CHECK(s_broker.frames[2].type == 0x31 && s_broker.retained[root + "/status"] == "online");
+  static const char* const DISCOVERY[][2] = {
+    { "homeassistant/light/ezclock_a1b2c3/config", "\"uniq_id\":\"ezclock_a1b2c3_light\"" },
+    { "homeassistant/sensor/ezclock_a1b2c3_ambient/config", "\"uniq_id\":\"ezclock_a1b2c3_ambient\"" },
+    { "homeassistant/binary_sensor/ezclock_a1b2c3_sync/config", "\"uniq_id\":\"ezclock_a1b2c3_sync\"" } };
+  for (uint8_t i = 0; i < 3; ++i) {
+    const Frame& f = s_broker.frames[3 + i];
+    off = 0;
+    CHECK(f.type == 0x31 && f.lengthBytes == 2 && str16(f.body, off) == DISCOVERY[i][0]);
+    const std::string json = f.body.substr(off);
+    CHECK(json.front() == '{' && json.back() == '}' && json.find(DISCOVERY[i][1]) != std::string::npos);
+    CHECK(json.find("\"name\":\"kitchen\"") != std::string::npos);
+  }
+  CHECK(s_broker.retained[root + "/light/state"] == "ON");
+  CHECK(s_broker.retained[root + "/light/bri"] == "255");
+  CHECK(s_broker.retained[root + "/light/rgb"] == "102,51,255"); // #6633FF
+  CHECK(s_broker.retained[root + "/light/fx"] == "none");
+  CHECK(s_broker.retained[root + "/synced"] == "ON");
+  CHECK(s_broker.last[root + "/ambient"] == "1200" && !s_broker.retained.count(root + "/ambient"));
+  CHECK(s_broker.count[8] == 1 && s_broker.count[1] == 1);
+
+  // Inbound: one frame a byte at a time, then three in one read (a foreign
+  // topic with a 2-byte length first), then one split mid-length
+  const std::string bri = publishFrame(root + "/light/bri/set", "77");
+  for (char ch : bri) c.peerData(&ch, 1);
+  pass();
+  CHECK(hal.brightness.size() == 1 && hal.brightness.back() == 77);
+  const std::string packed = publishFrame("other/" + std::string(140, 't'), "ignored") +
+                             publishFrame(root + "/light/rgb/set", "10,20,30") + publishFrame(root + "/light/set", "OFF");
+  CHECK(((uint8_t)packed[1] & 0x80) && !((uint8_t)packed[2] & 0x80)); // 2-byte remaining length
+  c.peerData(packed.data(), packed.size());
+  pass();
+  CHECK(hal.r == 10 && hal.g == 20 && hal.b == 30);
+  CHECK(hal.brightness.size() == 2 && hal.brightness.back() == 0);
+  const std::string on = publishFrame(root + "/light/set", "ON");
+  c.peerData(on.data(), 1);
+  c.peerData(on.data() + 1, on.size() - 1);
+  runFor(1000);
+  CHECK(hal.brightness.size() == 3 && hal.brightness.back() == 77);
+  CHECK(s_broker.retained[root + "/light/bri"] == "77");
+  CHECK(s_broker.retained[root + "/light/rgb"] == "10,20,30");
+  CHECK(s_broker.retained[root + "/light/state"] == "ON");
+  CHECK(c.closes == 0 && MqttSvc::s_rxLen == 0);
+}
+
+// A frame that cannot fit the receive buffer, and a length that never ends:
+// both close the connection; the disconnect callback then starts a new session
+static void checkBadFrames() {
+  AsyncClient& c = *MqttSvc::s_client;
+  const uint32_t closes = c.closes, connects = c.connects;
+  const std::string big = publishFrame("ezclock/ezclock_a1b2c3/light/set", std::string(300, 'x'));
+  c.peerData(big.data(), 40);
+  CHECK(c.closes == closes + 1 && MqttSvc::s_rxLen == 0);
+  c.peerDisconnected();
+  pass();
+  CHECK(idle());
+  CHECK(runUntil(online, 5000) && c.connects == connects + 1);
+  runFor(5000);
+
+  static const uint8_t LEN5[] = { 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+  c.peerData(LEN5, 3); // still a valid prefix
+  CHECK(c.closes == closes + 1);
+  c.peerData(LEN5 + 3, sizeof(LEN5) - 3);
+  CHECK(c.closes == closes + 2 && MqttSvc::s_rxLen == 0);
+  c.peerDisconnected();
+  pass();
+  CHECK(idle());
+  CHECK(runUntil(online, 5000) && c.connects == connects + 2);
+  runFor(5000);
+}
+
+// No callback ever reports these failures: the client must give up on its own,
+// without spinning, and a late disconnect callback must not reschedule it
+static void checkTimeouts() {
+  AsyncClient& c = *MqttSvc::s_client;
+
+  // Keepalive: the broker stops answering PINGREQ
+  s_broker.answerPing = false;
+  uint32_t closes = c.closes;
+  const uint32_t lastRx = MqttSvc::s_lastRxMs;
+  CHECK(runUntil(idle, 400000));
+  const uint32_t silentMs = MqttSvc::s_stateSinceMs - lastRx; // dropped when the state went Idle
+  CHECK(c.closes == closes + 1 && silentMs > 180000 && silentMs <= 180100); // on the deadline, not the next poll
+  const uint32_t retryAt = MqttSvc::s_nextAttemptMs;
+  c.peerDisconnected(); // late callback for the connection already dropped
+  pass();
+  CHECK(MqttSvc::s_nextAttemptMs == retryAt); // not rescheduled by the callback
+  s_broker.answerPing = true;
+  CHECK(runUntil(online, 5000));
+  runFor(5000);
+
+  // TCP connect that never completes, then a broker that never sends CONNACK
+  for (int mode = 0; mode < 2; ++mode) {
+    s_broker.accept = mode != 0;
+    s_broker.answerConnect = false;
+    MqttSvc::reconfigure();
+    closes = c.closes;
+    const uint32_t connects = c.connects, t0 = millis();
+    const uint32_t wakeups = runFor(120000);
+    // Attempts 10 s apart plus the 2, 4, 8, 16 s (+ up to 25%) backoff
+    CHECK(c.connects - connects >= 4 && c.connects - connects <= 6);
+    CHECK(c.closes - closes >= c.connects - connects - 1);
+    CHECK(wakeups <= 150); // waits out each attempt rather than polling it
+    printf("%s timeout: %u attempts in %u s, %u loop wakeups\n", mode ? "CONNACK" : "connect",
+           (unsigned)(c.connects - connects), (unsigned)((millis() - t0) / 1000), (unsigned)wakeups);
+  }
+  s_broker.accept = s_broker.answerConnect = true;
+  MqttSvc::reconfigure();
+  CHECK(runUntil(online, 5000));
+  runFor(5000);
+}
+
+static void idleHour(FakeHal& hal) {
+  memset(s_broker.count, 0, sizeof(s_broker.count));
+  const size_t bytes = s_broker.bytes;
+  const uint32_t sent = MqttSvc::messagesSent();
+  const uint32_t wakeups = runFor(3600000);
+  const uint32_t frames = MqttSvc::messagesSent() - sent;
+  CHECK(online());
+  CHECK(s_broker.count[3] == 0);
+  CHECK(s_broker.count[12] >= 39 && s_broker.count[12] <= 40); // PINGREQ every 90 s
+  CHECK(frames == s_broker.count[12]);
+  CHECK(wakeups <= 3600000 / MQTT_IDLE_POLL_MS + 2 * frames); // the idle poll plus each ping and its reply
+  printf("idle online hour: %u PUBLISH, %u PINGREQ = %u msgs/h sent (%u bytes); %u loop wakeups\n",
+         (unsigned)s_broker.count[3], (unsigned)s_broker.count[12], (unsigned)frames,
+         (unsigned)(s_broker.bytes - bytes), (unsigned)wakeups);
+
+  // Ambient drifting by 40 counts a minute: at most one publish a minute
+  memset(s_broker.count, 0, sizeof(s_broker.count));
+  for (int m = 0; m < 60; ++m) {
+    hal.ambient = (uint16_t)(1200 + 40 * (m % 20));
+    runFor(60000);
+  }
+  CHECK(s_broker.count[3] >= 55 && s_broker.count[3] <= 60);
+  CHECK(s_broker.count[12] >= 39 && s_broker.count[12] <= 40); // nothing answers a QoS 0 publish
+  CHECK(s_broker.count[1] == 0);
+  printf("ambient changing every minute: %u PUBLISH, %u PINGREQ in an hour\n", (unsigned)s_broker.count[3],
+         (unsigned)s_broker.count[12]);
+}
+
+// A web UI change wakes the loop with an event; it must go out with the next
+// batch (MQTT_MIN_BATCH_MS), not wait for the idle poll
+static void checkWebChange(Config& cfg) {
+  runFor(MQTT_IDLE_POLL_MS / 2);
+  const std::string fx = "ezclock/ezclock_a1b2c3/light/fx";
+  for (bool on : { true, false }) {
+    cfg.led.autoHue = on;
+    cfg.notify(Config::bit(Config::Field::led_autoHue));
+    const uint32_t t0 = millis();
+    EventLoop::wakeIn(0); // Event::Web
+    while (s_broker.retained[fx] != (on ? "autohue" : "none") && millis() - t0 < MQTT_IDLE_POLL_MS) pass();
+    CHECK(millis() - t0 <= MQTT_MIN_BATCH_MS + 1);
+    printf("web change published after %u ms\n", (unsigned)(millis() - t0));
+  }
+}
+
+int main() {
+  Host::efuseMac = 0x0000D0E0F0A1B2C3ULL;
+  Host::nowUs = 1000000;
+  Config cfg;
+  cfg.mqtt.enabled = true;
+  cfg.mqtt.host = "broker.lan";
+  cfg.mqtt.user = "clock";
+  cfg.mqtt.pass = "secret";
+  cfg.net.hostname = "kitchen";
+  FakeHal hal;
+  EventLoop::begin();
+  MqttSvc::begin(cfg, &hal);
+  s_broker.c = MqttSvc::s_client;
+
+  checkRemainingLength();
+  checkSession(hal);
+  checkBadFrames();
+  checkTimeouts();
+  checkWebChange(cfg);
+  idleHour(hal);
+  return HostTest::done();
+}
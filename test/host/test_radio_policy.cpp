@@ -0,0 +1,144 @@
+// RadioPolicy on a fake clock: the loop runs on the deadlines RadioPolicy and
+// EventLoop ask for, plus a pass whenever a web request, an OTA start/end or
+// a channel close would post an event. Checks when the radio switches:
+// - modem sleep RADIO_UI_HOLD_MS + RADIO_IDLE_MS (40 s) after the last UI
+//   request, full power on the pass that sees a request
+// - modem sleep RADIO_IDLE_MS (10 s) after an OTA ends or an expensive
+//   request (Admission in-flight count) closes, however long it lasted
+// - the soft AP keeps full power, and the counters in appendJson()
+#include "core/EventLoop.cpp"
+#include "core/Log.cpp"
+#include "services/Admission.cpp"
+#include <WiFi.h> // RadioPolicy.cpp includes it on ESP32 only
+#include "services/RadioPolicy.cpp"
+#include "host_test.hpp"
+#include <vector>
+
+struct Switch { uint32_t atMs; bool save; };
+static std::vector<Switch> s_switches;
+
+static void pass() {
+  const bool was = RadioPolicy::powerSave();
+  RadioPolicy::loop();
+  Log::drain();
+  if (RadioPolicy::powerSave() != was) s_switches.push_back({ (uint32_t)millis(), RadioPolicy::powerSave() });
+  CHECK(Host::wifiSleep == RadioPolicy::powerSave());
+}
+
+// Loop passes on the requested deadlines until `ms`, where an event wakes the
+// loop; the caller's stimulus then lands just before that pass
+static void runUntil(uint32_t ms) {
+  while (millis() < ms) {
+    pass();
+    EventLoop::wakeIn(ms - millis());
+    EventLoop::wait();
+  }
+}
+
+// Time of the first switch to `save` at or after fromMs (0 if none)
+static uint32_t switchAt(uint32_t fromMs, bool save) {
+  for (const Switch& s : s_switches)
+    if (s.atMs >= fromMs && s.save == save) return s.atMs;
+  return 0;
+}
+
+static uint32_t s_ip = 0x0A000001;
+
+// A web request as dispatch() makes it: admission, touch, handler, event
+static void request(uint32_t atMs, Admission::Cost cost = Admission::Cost::Cheap) {
+  runUntil(atMs);
+  CHECK(Admission::admit(s_ip, cost) == Admission::Verdict::Admit);
+  if (cost != Admission::Cost::Exempt) RadioPolicy::touch();
+}
+
+int main() {
+  Host::captureSerial = true;
+  Host::advanceMs(1000);
+  EventLoop::begin();
+  RadioPolicy::begin();
+  CHECK(!Host::wifiSleep);
+
+  // Boot counts as a UI touch: 30 s hold, then 10 s idle
+  const uint32_t boot = millis();
+  runUntil(100000);
+  CHECK(switchAt(boot, true) == boot + RADIO_UI_HOLD_MS + RADIO_IDLE_MS);
+  printf("boot: modem sleep after %u s\n", (unsigned)((switchAt(boot, true) - boot) / 1000));
+
+  // A UI request wakes the radio on its own pass; the hold restarts with every request
+  request(100000);
+  pass();
+  CHECK(switchAt(100000, false) == 100000);
+  request(125000);
+  runUntil(200000);
+  CHECK(switchAt(100000, true) == 125000 + RADIO_UI_HOLD_MS + RADIO_IDLE_MS);
+  printf("UI: full power at once, modem sleep %u s after the last request\n",
+         (unsigned)((switchAt(100000, true) - 125000) / 1000));
+
+  // Exempt requests (health checks) neither wake the radio nor hold it
+  request(210000, Admission::Cost::Exempt);
+  runUntil(260000);
+  CHECK(switchAt(210000, false) == 0);
+
+  // OTA over /ManualOTA or ArduinoOTA: 90 s with no loop deadline of its own
+  runUntil(300000);
+  RadioPolicy::setOta(true);
+  runUntil(390000);
+  CHECK(switchAt(300000, false) == 300000);
+  RadioPolicy::setOta(false);
+  runUntil(500000);
+  CHECK(switchAt(390000, true) == 390000 + RADIO_IDLE_MS);
+  printf("OTA: modem sleep %u s after it ends\n", (unsigned)((switchAt(390000, true) - 390000) / 1000));
+
+  // OTA ending between two loop passes (ArduinoOTA runs inside handle(), a
+  // passes-late loop): the idle time still runs from the end
+  runUntil(600000);
+  RadioPolicy::setOta(true);
+  pass();
+  Host::advanceMs(7000);
+  RadioPolicy::setOta(false);
+  Host::advanceMs(2000); // loop busy elsewhere
+  runUntil(700000);
+  CHECK(switchAt(600000, true) == 607000 + RADIO_IDLE_MS);
+
+  // Expensive request held open for 2 minutes (CSV or metrics stream)
+  request(800000, Admission::Cost::Expensive);
+  CHECK(Admission::stats().inFlight == 1);
+  runUntil(920000);
+  CHECK(switchAt(800000, false) == 800000 && switchAt(800000, true) == 0);
+  Admission::release();
+  RadioPolicy::channelClosed();
+  CHECK(Admission::stats().inFlight == 0);
+  runUntil(1000000);
+  CHECK(switchAt(800000, true) == 920000 + RADIO_IDLE_MS);
+  printf("channel: modem sleep %u s after the stream closes\n", (unsigned)((switchAt(800000, true) - 920000) / 1000));
+
+  // An OTA that fails at once still gets the full idle time; one switch each way
+  s_switches.clear();
+  Host::wifiSleepSwitches = 0;
+  const uint32_t d0 = 1100000;
+  runUntil(d0);
+  RadioPolicy::setOta(true);
+  pass();
+  RadioPolicy::setOta(false); // gone at once: idle 10 s > dwell 5 s
+  runUntil(d0 + 60000);
+  CHECK(switchAt(d0, false) == d0 && switchAt(d0, true) == d0 + RADIO_IDLE_MS);
+  CHECK(Host::wifiSleepSwitches == 2);
+
+  // Setup AP: no modem sleep while it is up
+  Host::wifiMode = WIFI_AP_STA;
+  runUntil(d0 + 70000);
+  CHECK(!RadioPolicy::powerSave());
+  runUntil(d0 + 300000);
+  CHECK(!RadioPolicy::powerSave());
+  Host::wifiMode = WIFI_STA;
+  runUntil(d0 + 300000 + RADIO_IDLE_MS);
+  pass();
+  CHECK(RadioPolicy::powerSave());
+
+  String json;
+  RadioPolicy::appendJson(json);
+  CHECK(json.indexOf("\"wakeBy\":{\"ui\":2,\"ota\":3,\"channel\":1,\"ap\":1}") >= 0);
+  CHECK(json.indexOf("\"requestsSave\":2,") >= 0);
+  printf("%s\n", json.c_str());
+  return HostTest::done();
+}
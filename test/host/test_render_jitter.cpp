@@ -0,0 +1,253 @@
+// Fade frame pacing under web load, with the driver on the loop task
+// (RENDER_TASK 0) and on its render task (RENDER_TASK 1). A fixed-priority
+// preemptive scheduler on one core (ESP32-C3) with a 1 ms tick runs the real
+// Qlock driver next to modelled Wi-Fi, lwIP and AsyncTCP work; the task
+// priorities are the firmware's, the CPU costs below are estimates, not
+// measurements. A web color change every 2 s starts a 1 s fade; the frames
+// shown during each fade give the interval to the previous one and its change
+// from the last interval (the FrameStats jitter).
+// - render task: frames slip by no more than the Wi-Fi/lwIP work above it
+// - loop task: frames also wait for every AsyncTCP handler and the loop stages
+// - no fade step is skipped on the driver's 100 ms poll frames, and a color
+//   change that lands during a fade starts when that fade ends
+// host-build: -DUSE_QLOCK3030=1
+#include "core/Log.cpp"
+#include "hal/Driver_Qlock3030.cpp"
+#include "host_test.hpp"
+#include <deque>
+#include <functional>
+#include <vector>
+
+namespace TimeSvc {
+  bool isSynced() { return true; }
+  bool getLocal(struct tm& out) {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    const time_t t = tv.tv_sec;
+    gmtime_r(&t, &out);
+    return true;
+  }
+}
+
+// HalTask.cpp / main.cpp / AsyncTCP / ESP-IDF task priorities
+constexpr uint8_t PRIO_WIFI = 23, PRIO_LWIP = 18, PRIO_RENDER = 12, PRIO_ASYNC_TCP = 10, PRIO_LOOP = 1;
+constexpr uint32_t TICK_US = 1000;        // CONFIG_FREERTOS_HZ 1000
+constexpr uint32_t RENDER_FRAME_MS = 10;  // HalTask.cpp
+constexpr uint32_t RENDER_MAX_IDLE_MS = 10000;
+constexpr uint16_t FADE_MS = 1000;
+constexpr uint32_t COLOR_EVERY_MS = 2000;
+
+// CPU cost estimates (us)
+constexpr uint32_t SHOW_US = 3500;        // 114 LEDs x 24 bits x 1.25 us on the wire; show() waits for it
+constexpr uint32_t DRIVER_US = 150;       // driver loop without a frame
+constexpr uint32_t STAGES_US = 200;       // the other loop stages per pass
+constexpr uint32_t WIFI_US = 80;          // per received frame
+constexpr uint32_t LWIP_US = 250;
+constexpr uint32_t STATUS_US = 3000;      // /api/status handler and JSON
+constexpr uint32_t COLOR_US = 1500;       // /api/config POST
+constexpr uint32_t CHUNK_US = 1200;       // one static-file chunk (per ACK)
+constexpr uint32_t RTT_US = 4000;         // client ACK round trip
+
+namespace Sim {
+  struct Job {
+    uint64_t readyUs;
+    uint32_t costUs;
+    std::function<uint32_t()> start;      // optional: runs at the start, returns the cost
+    std::function<void()> end;
+  };
+  struct Task {
+    uint8_t prio;
+    std::deque<Job> jobs;
+    uint32_t left = 0;
+    bool started = false;
+  };
+
+  static uint64_t s_now = 0;
+  static std::vector<Task*> s_tasks;
+
+  // Highest-priority ready task runs until its job ends or a higher one is released
+  static void run(uint64_t untilUs) {
+    while (s_now < untilUs) {
+      Task* best = nullptr;
+      uint64_t release = untilUs;
+      for (Task* t : s_tasks) {
+        if (t->jobs.empty()) continue;
+        if (t->jobs.front().readyUs <= s_now) { if (!best || t->prio > best->prio) best = t; }
+        else release = min(release, t->jobs.front().readyUs);
+      }
+      if (!best) { s_now = release; continue; }
+      if (!best->started) {
+        best->started = true;
+        Host::nowUs = s_now;
+        Job& j = best->jobs.front();
+        best->left = j.start ? j.start() : j.costUs;
+      }
+      uint64_t stop = s_now + best->left;
+      for (Task* t : s_tasks)
+        if (t->prio > best->prio && !t->jobs.empty()) stop = min(stop, max(t->jobs.front().readyUs, s_now));
+      best->left -= (uint32_t)(stop - s_now);
+      s_now = stop;
+      if (!best->left) {
+        auto end = std::move(best->jobs.front().end);
+        best->jobs.pop_front();
+        best->started = false;
+        Host::nowUs = s_now;
+        if (end) end();
+      }
+    }
+  }
+
+  static uint64_t nextTick(uint64_t us) { return (us / TICK_US + 1) * TICK_US; }
+}
+
+struct Load {
+  const char* name;
+  uint32_t statusEveryMs;  // 0 = no UI polling
+  uint32_t pageEveryMs;    // full page load (index and assets)
+  uint32_t pageChunks;
+};
+
+struct Result { double meanMs, p99Ms, maxMs, jitterMs; uint32_t frames; };
+
+static HalDriver* s_drv = nullptr;
+
+static Result run(bool renderTask, const Load& load, uint32_t seconds) {
+  using Sim::Job;
+  Sim::Task wifi{ PRIO_WIFI }, lwip{ PRIO_LWIP }, tcp{ PRIO_ASYNC_TCP }, drvTask{ renderTask ? PRIO_RENDER : PRIO_LOOP };
+  Sim::s_tasks = { &wifi, &lwip, &tcp, &drvTask };
+  const uint64_t t0 = Sim::s_now, end = t0 + seconds * 1000000ULL;
+
+  std::vector<uint64_t> fadeFrames;  // show times inside a fade
+  std::vector<std::pair<uint64_t, uint64_t>> fades;
+  uint64_t lastWake = t0;
+  bool sleeping = false;             // driver task blocked until an event (loop) or a command (render)
+
+  // Driver task: HalTask::run() frames, or main.cpp loop() passes with the driver in them
+  std::function<void(uint64_t)> schedule = [&](uint64_t at) {
+    Job j{ at, 0, nullptr, nullptr };
+    j.start = [&]() -> uint32_t {
+      HalTelemetry a{}, b{};
+      s_drv->getTelemetry(a);
+      s_drv->loop();
+      s_drv->getTelemetry(b);
+      const bool shown = b.framesShown != a.framesShown;
+      if (shown && !fades.empty() && Sim::s_now <= fades.back().second) fadeFrames.push_back(Sim::s_now);
+      return DRIVER_US + (shown ? SHOW_US : 0) + (renderTask ? 0 : STAGES_US);
+    };
+    j.end = [&]() {
+      const uint32_t idle = s_drv->idleMs(millis());
+      sleeping = false;
+      if (renderTask && idle <= RENDER_FRAME_MS) {
+        // vTaskDelayUntil: next tick of the fixed frame clock, at once if already past
+        lastWake += RENDER_FRAME_MS * 1000ULL;
+        if (lastWake < Sim::s_now) lastWake = Sim::s_now;
+        schedule(lastWake);
+      } else {
+        sleeping = true;
+        const uint32_t ms = max<uint32_t>(renderTask ? min<uint32_t>(idle, RENDER_MAX_IDLE_MS) : idle, 1);
+        lastWake = Sim::nextTick(Sim::s_now + (ms - 1) * 1000ULL);
+        schedule(lastWake);
+      }
+    };
+    drvTask.jobs.push_back(std::move(j));
+  };
+  // A web request or a command wakes a sleeping driver task now
+  auto wake = [&]() {
+    if (!sleeping || drvTask.jobs.empty() || drvTask.started) return;
+    drvTask.jobs.front().readyUs = Sim::s_now;
+    lastWake = Sim::s_now;
+    sleeping = false;
+  };
+
+  // Requests in time order: rx frame (Wi-Fi, lwIP), then the handler on AsyncTCP
+  struct Req { uint64_t at; uint32_t cost; bool color; bool last; };
+  std::vector<Req> reqs;
+  for (uint64_t t = t0 + 500000; t < end; t += COLOR_EVERY_MS * 1000ULL) reqs.push_back({ t, COLOR_US, true, true });
+  if (load.statusEveryMs)
+    for (uint64_t t = t0 + 137000; t < end; t += load.statusEveryMs * 1000ULL) reqs.push_back({ t, STATUS_US, false, true });
+  if (load.pageEveryMs)
+    for (uint64_t t = t0 + 911000; t < end; t += load.pageEveryMs * 1000ULL)
+      for (uint32_t k = 0; k < load.pageChunks; ++k) reqs.push_back({ t + k * RTT_US, CHUNK_US, false, k + 1 == load.pageChunks });
+  std::sort(reqs.begin(), reqs.end(), [](const Req& a, const Req& b) { return a.at < b.at; });
+  for (const Req& r : reqs) {
+    wifi.jobs.push_back({ r.at, WIFI_US, nullptr, nullptr });
+    lwip.jobs.push_back({ r.at, LWIP_US, nullptr, nullptr });
+    Job h{ r.at, r.cost, nullptr, nullptr };
+    const bool color = r.color, last = r.last;
+    h.end = [&, color, last]() {
+      if (color) {
+        // Web color change: the driver setter (through the command queue with the render task)
+        static uint8_t hue = 0;
+        CRGB c; hsv2rgb_rainbow(CHSV(hue += 40, 255, 255), c);
+        s_drv->fill(c.r, c.g, c.b);
+        fades.push_back({ Sim::s_now, Sim::s_now + FADE_MS * 1000ULL });
+      }
+      // The render task wakes for the queued command; the loop for EventLoop::post(Event::Web)
+      if (color || (last && !renderTask)) wake();
+    };
+    tcp.jobs.push_back(std::move(h));
+  }
+
+  schedule(Sim::nextTick(t0));
+  Sim::run(end);
+  Sim::run(end + 2000000); // let the last fade finish on an idle system
+  Sim::s_tasks.clear();
+
+  // Intervals between frames of the same fade
+  std::vector<double> gaps;
+  double jitter = 0, last = -1;
+  size_t f = 0;
+  for (size_t i = 1; i < fadeFrames.size(); ++i) {
+    while (f < fades.size() && fades[f].second < fadeFrames[i]) ++f;
+    if (f == fades.size() || fadeFrames[i - 1] < fades[f].first) { last = -1; continue; }
+    const double gap = (fadeFrames[i] - fadeFrames[i - 1]) / 1000.0;
+    if (last >= 0) jitter += fabs(gap - last);
+    last = gap;
+    gaps.push_back(gap);
+  }
+  std::vector<double> sorted = gaps;
+  std::sort(sorted.begin(), sorted.end());
+  Result r{};
+  r.frames = (uint32_t)gaps.size();
+  if (gaps.empty()) return r;
+  for (double g : gaps) r.meanMs += g;
+  r.meanMs /= gaps.size();
+  r.p99Ms = sorted[sorted.size() * 99 / 100];
+  r.maxMs = sorted.back();
+  r.jitterMs = gaps.size() > 1 ? jitter / (gaps.size() - 1) : 0;
+  return r;
+}
+
+int main() {
+  Host::captureSerial = true;
+  Host::adc = [](uint8_t) { return 2000; }; // steady ambient light: fades are the only motion
+  Host::nowUs = Sim::s_now = 1000000;
+  s_drv = createDefaultDriver();
+  s_drv->begin();
+  s_drv->setSmoothing(FADE_MS);
+  // First frame and its fade in before anything is measured
+  for (uint32_t i = 0; i < 300; ++i) { s_drv->loop(); Host::advanceMs(10); }
+  Sim::s_now = Host::nowUs;
+
+  static const Load LOADS[] = {
+    { "color changes only", 0, 0, 0 },
+    { "UI open (status 1/s)", 1000, 0, 0 },
+    { "status 4/s + page loads", 250, 3000, 24 },
+  };
+  printf("%-24s %-6s %7s %7s %7s %7s %7s\n", "web load", "driver", "frames", "mean ms", "p99 ms", "max ms",
+         "jitter");
+  for (const Load& load : LOADS) {
+    Result r[2];
+    for (int task = 0; task < 2; ++task) {
+      r[task] = run(task, load, 60);
+      Log::drain(); // driver log lines, kept off stdout
+      printf("%-24s %-6s %7u %7.2f %7.2f %7.2f %7.2f\n", load.name, task ? "render" : "loop", (unsigned)r[task].frames,
+             r[task].meanMs, r[task].p99Ms, r[task].maxMs, r[task].jitterMs);
+      CHECK(r[task].frames > 60 * 1000 / COLOR_EVERY_MS * FADE_MS / RENDER_FRAME_MS / 2);
+    }
+    // Render task: one frame tick plus at most the Wi-Fi/lwIP work of a request
+    CHECK(r[1].maxMs <= RENDER_FRAME_MS + (WIFI_US + LWIP_US) / 1000.0 + 1);
+    CHECK(r[1].maxMs <= r[0].maxMs && r[1].jitterMs <= r[0].jitterMs);
+  }
+  return HostTest::done();
+}
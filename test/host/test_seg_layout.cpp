@@ -0,0 +1,145 @@
+// SegLayout tables for several patterns, checked against LED indices worked
+// out by hand from the wiring: strip starts, first LED of each segment,
+// separator bases and glyphs, digit values for a time, and the masks written
+// by writeDigit/writeSeparator. Rejected patterns are checked at compile time.
+#include "hal/SegLayout.hpp"
+#include "host_test.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using SegLayout::build;
+
+// Every rejection reason, at compile time
+static_assert(build("HH*MM", 2, "fabcdeg", ':').error == SegLayout::Ok, "classic");
+static_assert(build("HH*MM", 2, "fabcdef", ':').error == SegLayout::BadOrder, "g missing, f twice");
+static_assert(build("HH*MM", 2, "fabcdegx", ':').error == SegLayout::BadOrder, "eight segments");
+static_assert(build("HH*MM", 2, "fabcdeG", ':').error == SegLayout::BadOrder, "not a..g");
+static_assert(build("HHMMSS_", 1, "abcdefg", ':').error == SegLayout::TooManyDigits, "7 cells");
+static_assert(build("H:H:M:M:S", 1, "abcdefg", ':').error == SegLayout::BadRole, "lone S");
+static_assert(build("H:H:M:M::", 1, "abcdefg", ':').error == SegLayout::TooManySeps, "5 separators");
+static_assert(build("HH|MM|||", 1, "abcdefg", ':').error == SegLayout::TooManyStrips, "5 strips");
+static_assert(build("HHH", 1, "abcdefg", ':').error == SegLayout::BadRole, "H three times");
+static_assert(build("HMM", 1, "abcdefg", ':').error == SegLayout::BadRole, "lone H");
+static_assert(build("HH/MM", 1, "abcdefg", ':').error == SegLayout::BadChar, "'/'");
+static_assert(build(":-", 1, "abcdefg", ':').error == SegLayout::Empty, "separators only");
+static_assert(SegLayout::glyphFromLiteral("'.'") == '.' && SegLayout::glyphFromLiteral(":") == ':', "STRIP_SEPARATOR forms");
+
+// Classic single strip, original wiring f a b c d e g, 2 LEDs per segment
+static constexpr char CLASSIC[] = "HH*MM";
+static constexpr char FABCDEG[] = "fabcdeg";
+using Classic = SegLayout::Layout<CLASSIC, 2, FABCDEG, ':'>;
+// Seconds on a second data pin, a..g wiring, 3 LEDs per segment
+static constexpr char SECONDS[] = "HH:MM|SS";
+static constexpr char ABCDEFG[] = "abcdefg";
+using Seconds = SegLayout::Layout<SECONDS, 3, ABCDEFG, ':'>;
+// Blank cells at both ends, reversed wiring, 1 LED per segment
+static constexpr char BLANKS[] = "_HH-MM_";
+static constexpr char GFEDCBA[] = "gfedcba";
+using Blanks = SegLayout::Layout<BLANKS, 1, GFEDCBA, ':'>;
+// Minutes first, every separator glyph, four strips, 4 LEDs per segment
+static constexpr char FOUR[] = "MM'|*HH.|SS|:";
+static constexpr char EDCBAFG[] = "edcbafg";
+using Four = SegLayout::Layout<FOUR, 4, EDCBAFG, '-'>;
+
+static_assert(Classic::LENGTH == 4 * 14 + 4 && Classic::DIGITS == 4 && Classic::SEPS == 1 && Classic::STRIPS == 1, "");
+static_assert(!Classic::SECONDS && Seconds::SECONDS && !Blanks::SECONDS && Four::SECONDS, "");
+static_assert(Seconds::LENGTH == 6 * 21 + 5 && Seconds::STRIPS == 2, "");
+static_assert(Blanks::LENGTH == 6 * 7 + 3 && Blanks::DIGITS == 6 && Blanks::SEPS == 1, "");
+static_assert(Four::LENGTH == 6 * 28 + 4 * 6 && Four::STRIPS == 4 && Four::SEPS == 4, "");
+
+struct Expect {
+  std::vector<uint16_t> stripStart;
+  std::vector<std::vector<uint16_t>> seg; // per digit, first LED of a..g
+  std::vector<uint16_t> sepBase;
+  std::string sepGlyph;
+  uint8_t at235907[6];                    // digitValue for 23:59:07
+};
+
+template <typename L>
+static void checkLayout(const char* name, const Expect& e) {
+  const SegLayout::Table& t = L::T;
+  CHECK(t.error == SegLayout::Ok);
+  CHECK(t.strips == e.stripStart.size() - 1);
+  for (size_t k = 0; k < e.stripStart.size(); ++k) CHECK(t.stripStart[k] == e.stripStart[k]);
+  CHECK(t.digits == e.seg.size());
+  for (uint8_t d = 0; d < t.digits; ++d)
+    for (uint8_t s = 0; s < 7; ++s) CHECK(t.seg[d][s] == e.seg[d][s]);
+  CHECK(t.seps == e.sepBase.size());
+  for (uint8_t i = 0; i < t.seps; ++i) CHECK(t.sepBase[i] == e.sepBase[i] && t.sepGlyph[i] == e.sepGlyph[i]);
+  for (uint8_t d = 0; d < t.digits; ++d) CHECK(L::digitValue(d, 23, 59, 7) == e.at235907[d]);
+
+  // Every digit and value: exactly the glyph's segments, LEDS each, nothing outside
+  static bool mask[L::LENGTH];
+  for (uint8_t d = 0; d < t.digits; ++d) {
+    for (uint8_t v = 0; v <= 10; ++v) {
+      memset(mask, 0, sizeof(mask));
+      L::writeDigit(mask, d, v);
+      bool want[L::LENGTH] = {};
+      const uint8_t bits = v < 10 ? SegLayout::GLYPHS[v] : 0;
+      for (uint8_t s = 0; s < 7; ++s)
+        if (bits & (1 << s)) for (uint8_t k = 0; k < L::LEDS; ++k) want[e.seg[d][s] + k] = true;
+      CHECK(!memcmp(mask, want, sizeof(mask)));
+    }
+  }
+  // Separators: two single LEDs then the bar, lit per glyph
+  for (uint8_t i = 0; i < t.seps; ++i) {
+    memset(mask, 1, sizeof(mask));
+    L::writeSeparators(mask);
+    const uint16_t b = e.sepBase[i], n = L::SEP_LENGTH;
+    std::vector<bool> lit;
+    for (uint16_t k = 0; k < n; ++k) lit.push_back(mask[b + k]);
+    std::vector<bool> want(n, false);
+    switch (e.sepGlyph[i]) {
+      case '\'': want[0] = true; break;
+      case '-':  want[1] = want[2] = true; break;
+      case '.':  want[n - 1] = true; break;
+      case ':':  want[0] = want[n - 1] = true; break;
+    }
+    CHECK(lit == want);
+  }
+  // Cells and separators tile the strips without gaps or overlap
+  std::vector<uint8_t> owner(t.length, 0);
+  for (uint8_t d = 0; d < t.digits; ++d)
+    for (uint8_t s = 0; s < 7; ++s) for (uint8_t k = 0; k < L::LEDS; ++k) owner[t.seg[d][s] + k]++;
+  for (uint8_t i = 0; i < t.seps; ++i) for (uint16_t k = 0; k < L::SEP_LENGTH; ++k) owner[t.sepBase[i] + k]++;
+  CHECK(std::count(owner.begin(), owner.end(), 1) == (long)t.length);
+  printf("%-15s %2u digits %u seps %u strips, %3u LEDs\n", name, (unsigned)t.digits, (unsigned)t.seps,
+         (unsigned)t.strips, (unsigned)t.length);
+}
+
+// First LEDs of a..g for a digit at `base` with the segment at wiring position
+// pos[s] (worked out from the order string by hand below)
+static std::vector<uint16_t> digit(uint16_t base, uint8_t leds, const uint8_t (&pos)[7]) {
+  std::vector<uint16_t> v;
+  for (uint8_t p : pos) v.push_back((uint16_t)(base + p * leds));
+  return v;
+}
+
+int main() {
+  // f a b c d e g: a=1 b=2 c=3 d=4 e=5 f=0 g=6
+  static const uint8_t fab[7] = { 1, 2, 3, 4, 5, 0, 6 };
+  checkLayout<Classic>("HH*MM", { { 0, 60 },
+                                  { digit(0, 2, fab), digit(14, 2, fab), digit(32, 2, fab), digit(46, 2, fab) },
+                                  { 28 }, ":", { 2, 3, 5, 9 } });
+  // a..g in order; strip 2 starts after HH:MM = 2*21 + 5 + 2*21
+  static const uint8_t abc[7] = { 0, 1, 2, 3, 4, 5, 6 };
+  checkLayout<Seconds>("HH:MM|SS", { { 0, 89, 131 },
+                                     { digit(0, 3, abc), digit(21, 3, abc), digit(47, 3, abc), digit(68, 3, abc),
+                                       digit(89, 3, abc), digit(110, 3, abc) },
+                                     { 42 }, ":", { 2, 3, 5, 9, 0, 7 } });
+  // g f e d c b a: a=6 ... g=0
+  static const uint8_t gfe[7] = { 6, 5, 4, 3, 2, 1, 0 };
+  checkLayout<Blanks>("_HH-MM_", { { 0, 45 },
+                                   { digit(0, 1, gfe), digit(7, 1, gfe), digit(14, 1, gfe), digit(24, 1, gfe),
+                                     digit(31, 1, gfe), digit(38, 1, gfe) },
+                                   { 21 }, "-", { 255, 2, 3, 5, 9, 255 } });
+  // e d c b a f g: a=4 b=3 c=2 d=1 e=0 f=5 g=6; digits 28 LEDs, separators 6;
+  // '*' takes the default '-'
+  static const uint8_t edc[7] = { 4, 3, 2, 1, 0, 5, 6 };
+  checkLayout<Four>("MM'|*HH.|SS|:", { { 0, 62, 130, 186, 192 },
+                                       { digit(0, 4, edc), digit(28, 4, edc), digit(68, 4, edc), digit(96, 4, edc),
+                                         digit(130, 4, edc), digit(158, 4, edc) },
+                                       { 56, 62, 124, 186 }, "'-.:", { 5, 9, 2, 3, 0, 7 } });
+  return HostTest::done();
+}
@@ -0,0 +1,128 @@
+// Word-clock tables against the hand-encoded French panel they replaced, and
+// the generated headers against their layout files:
+// - LED_AT equals the old Mapping table (150 = no LED)
+// - WordClock::frame() lights the same LEDs as the old Mask/timeMaskUpdate
+//   for all 1440 minutes, minute dots included
+// - tools/wordclock.py --check passes 1440/1440 for every layout
+// - regenerating src/hal/wordclock/*.hpp from tools/wordclock/*.clock gives
+//   the committed files byte for byte
+#include "hal/WordClock.hpp"
+#include "host_test.hpp"
+#include <string>
+#include <unistd.h>
+
+// Driver_Qlock3030.cpp before the tables were generated (Example/MyQlock)
+namespace Baseline {
+  const uint8_t Mapping[12][13] = {
+    {113,150,150,150,150,150,150,150,150,150,150,150,101},
+    {150,112,111,110,109,108,107,106,105,104,103,102,150},
+    {150,90,91,92,93,94,95,96,97,98,99,100,150},
+    {150,89,88,87,86,85,84,83,82,81,80,79,150},
+    {150,68,69,70,71,72,73,74,75,76,77,78,150},
+    {150,67,66,65,64,63,62,61,60,59,58,57,150},
+    {150,46,47,48,49,50,51,52,53,54,55,56,150},
+    {150,45,44,43,42,41,40,39,38,37,36,35,150},
+    {150,24,25,26,27,28,29,30,31,32,33,34,150},
+    {150,23,22,21,20,19,18,17,16,15,14,13,150},
+    {150,1,2,3,4,5,6,7,8,9,10,11,150},
+    {0,150,150,150,150,150,150,150,150,150,150,150,12}
+  };
+
+  const uint32_t Mask[12][13] = {
+    {16,0,0,0,0,0,0,0,0,0,0,0,30},
+    {0,1073610752,1073610752,0,1073610752,1073610752,1073610752,0,4194304,4194304,4194304,4194304,0},
+    {0,2097152,2097152,2097152,2097152,2097152,2097152,1048576,1048576,1048576,1048576,1048576,0},
+    {0,67108864,67108864,67108864,67108864,536870912,0,134217728,25165824,16777216,16777216,16777216,0},
+    {0,262144,262144,262144,131072,537001984,131072,131072,142737408,131072,0,0,0},
+    {0,268435456,268435456,268435456,268435456,537395200,524288,524288,8912896,134217728,0,0,0},
+    {0,33554432,33554432,33554432,33554432,536870912,536608768,536608768,536608768,536608768,536608768,536346624,0},
+    {0,126976,126976,126976,126976,126976,0,16384,16384,32896,32896,32896,0},
+    {0,256,256,0,16640,16640,16640,16640,16640,0,0,0,0},
+    {0,0,13824,13824,13824,13824,13824,5120,70720,70720,70720,70720,0},
+    {0,2048,2048,0,2048,2048,2048,2048,2048,0,0,0,0},
+    {24,0,0,0,0,0,0,0,0,0,0,0,28}
+  };
+
+  uint32_t timeMaskUpdate(uint8_t H, uint8_t M) {
+    uint8_t hours = H % 13 + (H - 1) / 12 + (M >= 35);
+    uint8_t Minutes = M / 5;
+    uint8_t minutes = M % 5;
+    if (H == 23 && M >= 35) { hours = 0; }
+    if (H == 12 && M >= 35) { hours = 1; }
+    return (uint32_t)1 << (17 + hours) | (uint32_t)1 << (5 + Minutes) | (uint32_t)1 << minutes;
+  }
+
+  // pixelStateUpdate + renderFrame: lit strip LEDs, one byte per LED
+  void frame(uint8_t hh, uint8_t mm, bool* lit) {
+    const uint32_t mask = timeMaskUpdate(hh, mm);
+    memset(lit, 0, WordClock::LED_COUNT);
+    for (uint8_t y = 0; y < 12; ++y)
+      for (uint8_t x = 0; x < 13; ++x)
+        if (Mapping[y][x] < WordClock::LED_COUNT && (Mask[y][x] & mask)) lit[Mapping[y][x]] = true;
+  }
+}
+
+static int run(const std::string& cmd, std::string& out) {
+  FILE* p = popen(cmd.c_str(), "r");
+  char buf[512];
+  for (size_t got; p && (got = fread(buf, 1, sizeof(buf), p)) > 0; ) out.append(buf, got);
+  return p ? pclose(p) : -1;
+}
+
+static std::string slurp(const std::string& path) {
+  std::string s;
+  FILE* f = fopen(path.c_str(), "rb");
+  char buf[4096];
+  for (size_t got; f && (got = fread(buf, 1, sizeof(buf), f)) > 0; ) s.append(buf, got);
+  if (f) fclose(f);
+  return s;
+}
+
+int main() {
+  CHECK(!strcmp(WordClock::LANG, "fr"));
+  CHECK(WordClock::LED_COUNT == 114 && WordClock::ROWS == 12 && WordClock::COLS == 13);
+  for (uint8_t y = 0; y < 12; ++y)
+    for (uint8_t x = 0; x < 13; ++x)
+      CHECK(WordClock::LED_AT[y][x] == (Baseline::Mapping[y][x] == 150 ? WordClock::NO_LED : Baseline::Mapping[y][x]));
+
+  uint16_t same = 0;
+  for (uint8_t hh = 0; hh < 24; ++hh) {
+    for (uint8_t mm = 0; mm < 60; ++mm) {
+      bool want[WordClock::LED_COUNT];
+      Baseline::frame(hh, mm, want);
+      uint8_t got[WordClock::FRAME_BYTES];
+      WordClock::frame(hh, mm, got);
+      bool equal = true;
+      for (uint16_t i = 0; i < WordClock::LED_COUNT; ++i) equal &= WordClock::lit(got, i) == want[i];
+      for (uint16_t i = WordClock::LED_COUNT; i < WordClock::FRAME_BYTES * 8; ++i) equal &= !WordClock::lit(got, i);
+      if (!equal) fprintf(stderr, "%02u:%02u differs from the old Mask/Mapping frame\n", hh, mm);
+      same += equal;
+    }
+  }
+  CHECK(same == 1440);
+  printf("fr: %u of 1440 minutes match the old Mask/Mapping frames\n", (unsigned)same);
+
+  const char* layouts = "tools/wordclock/de.clock tools/wordclock/en.clock tools/wordclock/fr.clock";
+  std::string out;
+  CHECK(run(std::string("python3 tools/wordclock.py --check ") + layouts, out) == 0);
+  size_t ok = 0;
+  for (size_t at = 0; (at = out.find(": 1440 minutes OK\n", at)) != std::string::npos; ++at) ++ok;
+  CHECK(ok == 3);
+  printf("%s", out.c_str());
+
+  char dir[] = "/tmp/ezclock-wordclockXXXXXX";
+  CHECK(mkdtemp(dir) != nullptr);
+  out.clear();
+  CHECK(run(std::string("python3 tools/wordclock.py --out-dir ") + dir + " " + layouts, out) == 0);
+  for (const char* lang : { "de", "en", "fr" }) {
+    const std::string name = std::string("WordClock_") + lang + ".hpp";
+    const std::string fresh = slurp(std::string(dir) + "/" + name);
+    const std::string committed = slurp("src/hal/wordclock/" + name);
+    CHECK(!fresh.empty() && fresh == committed);
+    if (fresh != committed) fprintf(stderr, "src/hal/wordclock/%s is stale: rerun tools/wordclock.py\n", name.c_str());
+    else printf("src/hal/wordclock/%s is up to date\n", name.c_str());
+    unlink((std::string(dir) + "/" + name).c_str());
+  }
+  rmdir(dir);
+  return HostTest::done();
+}
@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+"""Decode EzClock binary log frames (firmware built with -D LOG_BINARY=1).
+
+The device sends format-string and tag addresses instead of text. This tool
+looks both up in the firmware ELF and formats the raw arguments on the host.
+Bytes that are not part of a valid frame (ROM boot messages, core debug
+output) are passed through unchanged.
+
+Usage:
+  python tools/logdecode.py .pio/build/esp32c3/firmware.elf < capture.bin
+  curl -s http://ezclock.local/api/log | python tools/logdecode.py firmware.elf
+  python tools/logdecode.py firmware.elf --port /dev/ttyACM0   (needs pyserial)
+
+Frame layout (see src/core/Log.hpp):
+  0xFE, len, payload[len], xor(payload)
+  payload = level u8, ms u32, fmt u32, tag u32, args...
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+
+MARK = 0xFE
+HEADER = 13  # level + ms + fmt + tag
+LEVELS = {1: "E", 2: "W", 3: "I", 4: "D"}
+
+SPEC = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|j|z|t|L)?([diouxXcsfFeEgGaAp%])")
+
+
+class Elf:
+    """Just enough little-endian ELF parsing to read strings by address."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        d = self.data
+        if d[:4] != b"\x7fELF" or d[4] not in (1, 2) or d[5] != 1:
+            raise SystemExit("%s: not a little-endian ELF file" % path)
+        if d[4] == 1:  # ELF32 (the ESP32 firmware)
+            shoff, = struct.unpack_from("<I", d, 0x20)
+            shentsize, shnum = struct.unpack_from("<HH", d, 0x2E)
+            shdr = "<IIIIII"
+        else:  # ELF64, e.g. a host build of the logger
+            shoff, = struct.unpack_from("<Q", d, 0x28)
+            shentsize, shnum = struct.unpack_from("<HH", d, 0x3A)
+            shdr = "<IIQQQQ"
+        self.sections = []
+        for i in range(shnum):
+            _, sh_type, flags, addr, offset, size = struct.unpack_from(shdr, d, shoff + i * shentsize)
+            # SHT_PROGBITS sections that are loaded (SHF_ALLOC)
+            if sh_type == 1 and flags & 0x2 and size:
+                self.sections.append((addr, offset, size))
+
+    def string(self, addr):
+        for base, offset, size in self.sections:
+            if base <= addr < base + size:
+                start = offset + (addr - base)
+                end = self.data.find(b"\0", start, offset + size)
+                if end < 0:
+                    end = offset + size
+                return self.data[start:end].decode("utf-8", "replace")
+        return None
+
+
+class Args:
+    def __init__(self, raw):
+        self.raw = raw
+        self.pos = 0
+
+    def take(self, fmt, n):
+        if self.pos + n > len(self.raw):
+            raise EOFError
+        v, = struct.unpack_from(fmt, self.raw, self.pos)
+        self.pos += n
+        return v
+
+    def text(self):
+        n = self.take("<B", 1)
+        s = self.raw[self.pos:self.pos + n]
+        self.pos += n
+        return s.decode("utf-8", "replace")
+
+
+def render(fmt, args):
+    """printf-style formatting driven by the same argument sizes the device encoded."""
+    out = []
+    last = 0
+    for m in SPEC.finditer(fmt):
+        out.append(fmt[last:m.start()])
+        last = m.end()
+        flags, width, prec, length, conv = m.groups()
+        if conv == "%":
+            out.append("%")
+            continue
+        try:
+            if width == "*":
+                width = str(args.take("<i", 4))
+            if prec == "*":
+                prec = str(args.take("<i", 4))
+            spec = "%" + flags + (width or "") + ("." + prec if prec is not None else "")
+            wide = length in ("ll", "j")
+            if conv in "di":
+                v = args.take("<q", 8) if wide else args.take("<i", 4)
+                out.append((spec + "d") % v)
+            elif conv in "ouxX":
+                v = args.take("<Q", 8) if wide else args.take("<I", 4)
+                out.append((spec + ("d" if conv == "u" else conv)) % v)
+            elif conv == "c":
+                out.append((spec + "c") % chr(args.take("<I", 4) & 0xFF))
+            elif conv == "s":
+                out.append((spec + "s") % args.text())
+            elif conv == "p":
+                out.append("0x%x" % args.take("<I", 4))
+            elif conv in "aA":
+                out.append(float.hex(args.take("<f", 4)))
+            else:
+                out.append((spec + conv) % args.take("<f", 4))
+        except EOFError:
+            out.append("<truncated>")
+            last = len(fmt)
+            break
+    out.append(fmt[last:])
+    return "".join(out)
+
+
+def decode_frame(elf, payload):
+    level, ms, fmt_addr, tag_addr = struct.unpack_from("<BIII", payload, 0)
+    fmt = elf.string(fmt_addr)
+    if fmt is None or level not in LEVELS:
+        return None
+    tag = elf.string(tag_addr) or "?"
+    return "%u [%s] %s: %s\n" % (ms, LEVELS[level], tag, render(fmt, Args(payload[HEADER:])))
+
+
+def decode(elf, buf, out, final=False):
+    """Decode as much of buf as possible; returns the unconsumed remainder."""
+    i = 0
+    text_start = 0
+    while i < len(buf):
+        if buf[i] != MARK:
+            i += 1
+            continue
+        if i + 2 > len(buf):
+            break
+        n = buf[i + 1]
+        if i + 3 + n > len(buf):
+            if final:
+                i += 1
+                continue
+            break
+        payload = bytes(buf[i + 2:i + 2 + n])
+        chk = 0
+        for b in payload:
+            chk ^= b
+        line = decode_frame(elf, payload) if n >= HEADER and chk == buf[i + 2 + n] else None
+        if line is None:
+            i += 1  # not a frame: keep it as text and resync on the next marker
+            continue
+        out.write(bytes(buf[text_start:i]).decode("utf-8", "replace"))
+        out.write(line)
+        i += 3 + n
+        text_start = i
+    if final:
+        i = len(buf)
+    out.write(bytes(buf[text_start:i]).decode("utf-8", "replace"))
+    out.flush()
+    return buf[i:]
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("elf", help="firmware ELF matching the running image")
+    ap.add_argument("input", nargs="?", help="capture file (default: stdin)")
+    ap.add_argument("--port", help="read from a serial port instead")
+    ap.add_argument("--baud", type=int, default=115200)
+    args = ap.parse_args()
+
+    elf = Elf(args.elf)
+    if args.port:
+        import serial  # pyserial
+        port = serial.Serial(args.port, args.baud, timeout=0.2)
+        read = lambda: port.read(4096) or b""
+        eof = lambda chunk: False
+    else:
+        fd = os.open(args.input, os.O_RDONLY) if args.input else sys.stdin.fileno()
+        read = lambda: os.read(fd, 4096)
+        eof = lambda chunk: not chunk
+
+    pending = bytearray()
+    try:
+        while True:
+            chunk = read()
+            if eof(chunk):
+                break
+            pending = bytearray(decode(elf, pending + chunk, sys.stdout))
+        decode(elf, pending, sys.stdout, final=True)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""Measure the HTTP first-byte latency penalty of Wi-Fi modem sleep.
+
+Cold samples are taken after --idle seconds without UI requests, long enough
+for the radio policy to drop back to modem sleep; they probe the exempt
+/health route, which does not keep the radio up. Warm samples follow an
+/api/radio request, which switches the radio to full power. Both probe /health
+so the handler cost is the same; the difference is the radio wake-up (DTIM
+interval).
+
+Usage:
+  python tools/ttfb.py ezclock.local
+  python tools/ttfb.py 192.168.1.50 --rounds 10
+
+Prints the median and worst first-byte time per state and the radio duty
+cycle reported by the device.
+"""
+import argparse
+import json
+import socket
+import statistics
+import sys
+import time
+
+
+def first_byte_ms(host, port, path, timeout):
+    """Connect, send a GET and time until the first response byte."""
+    t0 = time.perf_counter()
+    with socket.create_connection((host, port), timeout=timeout) as s:
+        s.sendall(("GET %s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n" % (path, host)).encode())
+        if not s.recv(1):
+            raise IOError("connection closed without a response")
+        ms = (time.perf_counter() - t0) * 1000.0
+        while s.recv(4096):
+            pass
+    return ms
+
+
+def get_json(host, port, path, timeout):
+    with socket.create_connection((host, port), timeout=timeout) as s:
+        s.sendall(("GET %s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n" % (path, host)).encode())
+        data = b""
+        while True:
+            chunk = s.recv(4096)
+            if not chunk:
+                break
+            data += chunk
+    return json.loads(data.split(b"\r\n\r\n", 1)[1])
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("host")
+    ap.add_argument("--port", type=int, default=80)
+    ap.add_argument("--rounds", type=int, default=5)
+    ap.add_argument("--warm", type=int, default=10, help="warm samples per round")
+    ap.add_argument("--idle", type=float, default=50.0,
+                    help="seconds without UI requests before a cold sample "
+                         "(RADIO_UI_HOLD_MS + RADIO_IDLE_MS + margin)")
+    ap.add_argument("--timeout", type=float, default=5.0)
+    args = ap.parse_args()
+
+    cold, warm = [], []
+    for r in range(args.rounds):
+        time.sleep(args.idle)
+        ms = first_byte_ms(args.host, args.port, "/health", args.timeout)
+        # /api/radio is a UI request: it switches the radio to full power on the
+        # next loop pass, so this reply still shows the state of the cold probe
+        if get_json(args.host, args.port, "/api/radio", args.timeout).get("powerSave"):
+            cold.append(ms)
+        else:
+            print("round %d: radio was not in modem sleep, cold sample dropped (raise --idle)" % (r + 1),
+                  file=sys.stderr)
+        time.sleep(0.5)
+        for _ in range(args.warm):
+            warm.append(first_byte_ms(args.host, args.port, "/health", args.timeout))
+            time.sleep(0.2)
+        print("round %d: cold %.1f ms, warm median %.1f ms" % (r + 1, ms, statistics.median(warm[-args.warm:])),
+              file=sys.stderr)
+
+    radio = get_json(args.host, args.port, "/api/radio", args.timeout)
+    if not cold:
+        raise SystemExit("no cold samples: the radio never reported powerSave (RADIO_POWER_SAVE=0 build or --idle too short)")
+    print("state       samples  median_ms  max_ms")
+    print("modem sleep %7d  %9.1f  %6.1f" % (len(cold), statistics.median(cold), max(cold)))
+    print("full power  %7d  %9.1f  %6.1f" % (len(warm), statistics.median(warm), max(warm)))
+    print("penalty     %18.1f" % (statistics.median(cold) - statistics.median(warm)))
+    print("duty cycle: modem sleep %s%% of uptime, %s switches to full power, %s to sleep"
+          % (radio.get("savePct"), radio.get("toFull"), radio.get("toSave")))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,424 @@
+#!/usr/bin/env python3
+"""Generate word-clock tables (src/hal/wordclock/*.hpp) from a layout file.
+
+A layout (tools/wordclock/<lang>.clock) describes one panel:
+
+  lang fr                    language of the built-in phrases used by --check
+  size 12 13                 rows, columns of the cell matrix
+  wiring panel.wiring        strip order (file relative to the layout)
+
+  [grid]                     one line per row: a letter per cell,
+                             '.' = no LED, 'o' = minute dot
+  [words]                    TEXT[#tag] row col [right|down|diag]
+                             the letters under the word must spell TEXT;
+                             #tag tells apart words with the same text
+  [rules]
+    always WORD...           lit for every minute
+    next-hour-at 35          from this minute on the next hour is named
+    dots r,c r,c ...         minute % 5 == k lights the first k dots
+    hour H WORD...           hour words for displayed hour H (0..23);
+                             13..23 fall back to H - 12 when not given
+    hour H:F WORD...         replaces "hour H" at five-minute mark F
+    five F WORD...           words for the five-minute mark F (0, 5, .. 55)
+
+A wiring file lists the cells in strip order:
+    path r,c [r,c]           one cell, or a straight run (inclusive)
+    serpentine R0 R1 C0 C1   rows R0..R1, first row C0..C1, then alternating
+
+The generated header holds the strip index of every cell, the minute dot
+LEDs, the word group of every LED (prefix / hour / minute / dot, used for
+per-word colors) and one packed word frame (bit i = LED i) per five-minute
+slot of the day; the firmware ORs in the dots for minute % 5 (see
+src/hal/WordClock.hpp).
+
+Usage:
+  python tools/wordclock.py tools/wordclock/*.clock --out-dir src/hal/wordclock
+  python tools/wordclock.py --check tools/wordclock/*.clock
+
+--check spells out every one of the 1440 minutes in the layout's language
+(independently of the rules) and verifies that the generated frame lights
+exactly the cells of those words plus the expected minute dots.
+"""
+import argparse
+import itertools
+import os
+import sys
+
+DIRS = {"right": (0, 1), "down": (1, 0), "diag": (1, 1)}
+SLOTS = 24 * 12
+GROUPS = ["prefix", "hour", "minute", "dot", "none"]  # order of WordClock::Group
+
+
+class LayoutError(Exception):
+    pass
+
+
+class Layout:
+    def __init__(self, path):
+        self.path = path
+        self.name = os.path.splitext(os.path.basename(path))[0]
+        self.lang = self.name
+        self.rows = self.cols = 0
+        self.grid = []
+        self.words = {}      # key (TEXT or TEXT#tag) -> list of (row, col)
+        self.always = []
+        self.next_hour_at = 60
+        self.dots = []
+        self.hours = {}      # (hour, five or None) -> [word keys]
+        self.fives = {}      # five -> [word keys]
+        self.wiring = []     # cells in strip order
+        self._parse()
+
+    def _fail(self, lineno, msg):
+        raise LayoutError("%s:%d: %s" % (self.path, lineno, msg))
+
+    def _cell(self, lineno, text):
+        try:
+            r, c = (int(v) for v in text.split(","))
+        except ValueError:
+            self._fail(lineno, "expected row,col, got %r" % text)
+        if not (0 <= r < self.rows and 0 <= c < self.cols):
+            self._fail(lineno, "cell %d,%d outside %dx%d" % (r, c, self.rows, self.cols))
+        return r, c
+
+    def _word_keys(self, lineno, keys):
+        for k in keys:
+            if k not in self.words:
+                self._fail(lineno, "unknown word %r" % k)
+        return keys
+
+    def _parse(self):
+        section = None
+        wiring = None
+        with open(self.path, encoding="utf-8") as f:
+            lines = list(enumerate(f, 1))
+        for lineno, raw in lines:
+            line = raw.rstrip("\n")
+            if section != "grid":
+                line = line.split("#", 1)[0] if line.lstrip().startswith("#") else line
+            if not line.strip():
+                continue
+            if line.startswith("["):
+                section = line.strip("[] \t")
+                continue
+            tok = line.split()
+            if section is None:
+                if tok[0] == "lang":
+                    self.lang = tok[1]
+                elif tok[0] == "size":
+                    self.rows, self.cols = int(tok[1]), int(tok[2])
+                elif tok[0] == "wiring":
+                    wiring = os.path.join(os.path.dirname(self.path), tok[1])
+                else:
+                    self._fail(lineno, "unknown setting %r" % tok[0])
+            elif section == "grid":
+                row = line.strip()
+                if len(row) != self.cols:
+                    self._fail(lineno, "grid row has %d cells, expected %d" % (len(row), self.cols))
+                self.grid.append(row)
+            elif section == "words":
+                self._parse_word(lineno, tok)
+            elif section == "rules":
+                self._parse_rule(lineno, tok)
+            else:
+                self._fail(lineno, "unknown section [%s]" % section)
+        if len(self.grid) != self.rows:
+            raise LayoutError("%s: grid has %d rows, expected %d" % (self.path, len(self.grid), self.rows))
+        if wiring is None:
+            raise LayoutError("%s: missing 'wiring'" % self.path)
+        self._parse_wiring(wiring)
+
+    def _parse_word(self, lineno, tok):
+        if len(tok) not in (3, 4):
+            self._fail(lineno, "expected TEXT row col [dir]")
+        key = tok[0]
+        text = key.split("#", 1)[0]
+        r, c = int(tok[1]), int(tok[2])
+        dr, dc = DIRS.get(tok[3] if len(tok) == 4 else "right", (None, None))
+        if dr is None:
+            self._fail(lineno, "direction must be one of %s" % ", ".join(DIRS))
+        cells = [(r + i * dr, c + i * dc) for i in range(len(text))]
+        for (cr, cc), ch in zip(cells, text):
+            if not (0 <= cr < self.rows and 0 <= cc < self.cols) or self.grid[cr][cc] != ch:
+                self._fail(lineno, "%s does not match the grid at %d,%d" % (key, r, c))
+        if key in self.words:
+            self._fail(lineno, "duplicate word %r (add a #tag)" % key)
+        self.words[key] = cells
+
+    def _parse_rule(self, lineno, tok):
+        kind, args = tok[0], tok[1:]
+        if kind == "always":
+            self.always = self._word_keys(lineno, args)
+        elif kind == "next-hour-at":
+            self.next_hour_at = int(args[0])
+        elif kind == "dots":
+            self.dots = [self._cell(lineno, a) for a in args]
+            for r, c in self.dots:
+                if self.grid[r][c] != "o":
+                    self._fail(lineno, "dot %d,%d is not an 'o' cell" % (r, c))
+        elif kind == "hour":
+            h, _, f = args[0].partition(":")
+            key = (int(h), int(f) if f else None)
+            if not 0 <= key[0] < 24:
+                self._fail(lineno, "hour out of range")
+            self.hours[key] = self._word_keys(lineno, args[1:])
+        elif kind == "five":
+            f = int(args[0])
+            if f % 5 or not 0 <= f < 60:
+                self._fail(lineno, "five-minute mark must be 0, 5, .. 55")
+            self.fives[f] = self._word_keys(lineno, args[1:])
+        else:
+            self._fail(lineno, "unknown rule %r" % kind)
+
+    def _parse_wiring(self, path):
+        with open(path, encoding="utf-8") as f:
+            for lineno, raw in enumerate(f, 1):
+                tok = raw.split("#", 1)[0].split()
+                if not tok:
+                    continue
+                if tok[0] == "path" and len(tok) in (2, 3):
+                    a = self._cell(lineno, tok[1])
+                    b = self._cell(lineno, tok[2]) if len(tok) == 3 else a
+                    if a[0] != b[0] and a[1] != b[1]:
+                        self._fail(lineno, "path must be horizontal or vertical")
+                    n = max(abs(b[0] - a[0]), abs(b[1] - a[1]))
+                    sr = (b[0] > a[0]) - (b[0] < a[0])
+                    sc = (b[1] > a[1]) - (b[1] < a[1])
+                    self.wiring += [(a[0] + i * sr, a[1] + i * sc) for i in range(n + 1)]
+                elif tok[0] == "serpentine" and len(tok) == 5:
+                    r0, r1, c0, c1 = (int(v) for v in tok[1:])
+                    rs = range(r0, r1 + 1) if r1 >= r0 else range(r0, r1 - 1, -1)
+                    for i, r in enumerate(rs):
+                        a, b = (c0, c1) if i % 2 == 0 else (c1, c0)
+                        cs = range(a, b + 1) if b >= a else range(a, b - 1, -1)
+                        self.wiring += [(r, c) for c in cs]
+                else:
+                    raise LayoutError("%s:%d: expected 'path r,c [r,c]' or 'serpentine R0 R1 C0 C1'" % (path, lineno))
+        seen = set()
+        for cell in self.wiring:
+            r, c = cell
+            if cell in seen:
+                raise LayoutError("%s: cell %d,%d wired twice" % (path, r, c))
+            if self.grid[r][c] == ".":
+                raise LayoutError("%s: cell %d,%d is wired but has no letter or dot" % (path, r, c))
+            seen.add(cell)
+        for r in range(self.rows):
+            for c in range(self.cols):
+                if self.grid[r][c] != "." and (r, c) not in seen:
+                    raise LayoutError("%s: cell %d,%d (%s) is not wired" % (path, r, c, self.grid[r][c]))
+
+    # --- rendering -------------------------------------------------------
+
+    def displayed_hour(self, h, m):
+        return (h + (1 if m - m % 5 >= self.next_hour_at else 0)) % 24
+
+    def word_keys(self, h, m):
+        five = m - m % 5
+        dh = self.displayed_hour(h, m)
+        base = dh if dh in (0, 12) or (dh, None) in self.hours else dh - 12
+        hour = self.hours.get((base, five), self.hours.get((base, None)))
+        if hour is None:
+            raise LayoutError("%s: no words for hour %d" % (self.path, base))
+        return self.always + self.fives.get(five, []) + hour
+
+    def led_groups(self):
+        """Group of every LED; a cell shared by words of different groups is an error."""
+        group = {}
+
+        def claim(cells, g):
+            for cell in cells:
+                if group.get(cell, g) != g:
+                    raise LayoutError("%s: cell %d,%d is used by %s and %s words" % (
+                        self.path, cell[0], cell[1], GROUPS[group[cell]], GROUPS[g]))
+                group[cell] = g
+
+        for k in self.always:
+            claim(self.words[k], 0)
+        for keys in self.hours.values():
+            for k in keys:
+                claim(self.words[k], 1)
+        for keys in self.fives.values():
+            for k in keys:
+                claim(self.words[k], 2)
+        claim(self.dots, 3)
+        return [group.get(cell, 4) for cell in self.wiring]
+
+    def led_of(self):
+        return {cell: i for i, cell in enumerate(self.wiring)}
+
+    def word_frame(self, slot):
+        h, m = divmod(slot * 5, 60)
+        led = self.led_of()
+        bits = 0
+        for k in self.word_keys(h, m):
+            for cell in self.words[k]:
+                bits |= 1 << led[cell]
+        return bits
+
+    def frame_cells(self, h, m):
+        """Cells lit at h:m as the firmware composes them (words | dots)."""
+        bits = self.word_frame((h * 60 + m) // 5)
+        led = self.led_of()
+        for cell in self.dots[: m % 5]:
+            bits |= 1 << led[cell]
+        return {cell for cell, i in led.items() if bits >> i & 1}
+
+
+# --- header output -------------------------------------------------------
+
+def emit(layout, out_path):
+    n = len(layout.wiring)
+    if n > 255:
+        raise LayoutError("%s: %d LEDs do not fit the uint8_t index tables" % (layout.path, n))
+    nbytes = (n + 7) // 8
+    led = layout.led_of()
+    src = os.path.relpath(layout.path, os.path.dirname(os.path.abspath(__file__)) + "/..").replace(os.sep, "/")
+    o = []
+    o.append("// Generated by tools/wordclock.py from %s - do not edit." % src)
+    o.append("#pragma once")
+    o.append("#include <stdint.h>")
+    o.append("")
+    o.append("// Grid:")
+    for row in layout.grid:
+        o.append("//   %s" % row)
+    o.append("namespace WordClock {")
+    o.append("  constexpr const char* LANG = \"%s\";" % layout.lang)
+    o.append("  constexpr uint8_t ROWS = %d;" % layout.rows)
+    o.append("  constexpr uint8_t COLS = %d;" % layout.cols)
+    o.append("  constexpr uint16_t LED_COUNT = %d;" % n)
+    o.append("  constexpr uint8_t NO_LED = 0xFF;")
+    o.append("  constexpr uint8_t FRAME_BYTES = %d;" % nbytes)
+    o.append("  constexpr uint16_t SLOTS = %d; // five-minute slots per day" % SLOTS)
+    o.append("")
+    o.append("  // Strip index of each cell, NO_LED where the panel has none")
+    o.append("  constexpr uint8_t LED_AT[ROWS][COLS] = {")
+    for r in range(layout.rows):
+        vals = [str(led[(r, c)]) if (r, c) in led else "NO_LED" for c in range(layout.cols)]
+        o.append("    {%s}," % ", ".join(vals))
+    o.append("  };")
+    o.append("")
+    o.append("  // Minute dots in lighting order: minute % 5 == k lights the first k")
+    o.append("  constexpr uint8_t DOT_COUNT = %d;" % len(layout.dots))
+    o.append("  constexpr uint8_t DOTS[DOT_COUNT + 1] = {%s};" % ", ".join([str(led[c]) for c in layout.dots] + ["NO_LED"]))
+    o.append("")
+    o.append("  // Word group of each LED: 0 prefix, 1 hour, 2 minute, 3 dot, 4 never lit")
+    groups = layout.led_groups()
+    o.append("  constexpr uint8_t LED_GROUP[LED_COUNT] = {")
+    for i in range(0, n, 38):
+        o.append("    %s," % ", ".join(str(g) for g in groups[i:i + 38]))
+    o.append("  };")
+    o.append("")
+    o.append("  // Word layer per slot (slot = minute of day / 5), bit i of byte i / 8 = LED i")
+    o.append("  constexpr uint8_t WORDS[SLOTS][FRAME_BYTES] = {")
+    for slot in range(SLOTS):
+        bits = layout.word_frame(slot)
+        h, m = divmod(slot * 5, 60)
+        text = " ".join(k.split("#", 1)[0] for k in layout.word_keys(h, m))
+        vals = ", ".join("0x%02X" % (bits >> (8 * i) & 0xFF) for i in range(nbytes))
+        o.append("    {%s}, // %02d:%02d %s" % (vals, h, m, text))
+    o.append("  };")
+    o.append("}")
+    data = "\n".join(o) + "\n"
+    with open(out_path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(data)
+
+
+# --- independent phrases for --check -------------------------------------
+
+def phrase_fr(h, m):
+    f = m - m % 5
+    dh = (h + (f >= 35)) % 24
+    names = ["", "UNE", "DEUX", "TROIS", "QUATRE", "CINQ", "SIX", "SEPT", "HUIT", "NEUF", "DIX", "ONZE"]
+    w = ["IL", "EST"]
+    if dh == 0:
+        w.append("MINUIT")
+    elif dh == 12:
+        w.append("MIDI")
+    else:
+        w += [names[dh % 12], "HEURE" if dh % 12 == 1 else "HEURES"]
+    w += {0: "", 5: "CINQ", 10: "DIX", 15: "ET QUART", 20: "VINGT", 25: "VINGT - CINQ",
+          30: "ET DEMIE", 35: "MOINS VINGT - CINQ", 40: "MOINS VINGT", 45: "MOINS LE QUART",
+          50: "MOINS DIX", 55: "MOINS CINQ"}[f].split()
+    return w
+
+
+def phrase_en(h, m):
+    f = m - m % 5
+    dh = (h + (f >= 35)) % 12
+    names = ["TWELVE", "ONE", "TWO", "THREE", "FOUR", "FIVE", "SIX", "SEVEN", "EIGHT", "NINE", "TEN", "ELEVEN"]
+    rel = {0: "OCLOCK", 5: "FIVE PAST", 10: "TEN PAST", 15: "A QUARTER PAST", 20: "TWENTY PAST",
+           25: "TWENTY FIVE PAST", 30: "HALF PAST", 35: "TWENTY FIVE TO", 40: "TWENTY TO",
+           45: "A QUARTER TO", 50: "TEN TO", 55: "FIVE TO"}[f]
+    return ["IT", "IS"] + rel.split() + [names[dh]]
+
+
+def phrase_de(h, m):
+    f = m - m % 5
+    dh = (h + (f >= 25)) % 12
+    names = ["ZWÖLF", "EINS", "ZWEI", "DREI", "VIER", "FÜNF", "SECHS", "SIEBEN", "ACHT", "NEUN", "ZEHN", "ELF"]
+    hour = "EIN" if f == 0 and dh == 1 else names[dh]
+    rel = {0: "", 5: "FÜNF NACH", 10: "ZEHN NACH", 15: "VIERTEL NACH", 20: "ZWANZIG NACH",
+           25: "FÜNF VOR HALB", 30: "HALB", 35: "FÜNF NACH HALB", 40: "ZWANZIG VOR",
+           45: "VIERTEL VOR", 50: "ZEHN VOR", 55: "FÜNF VOR"}[f]
+    return ["ES", "IST"] + rel.split() + [hour] + (["UHR"] if f == 0 else [])
+
+
+PHRASES = {"fr": phrase_fr, "en": phrase_en, "de": phrase_de}
+
+
+def check(layout):
+    """Every minute must light exactly the cells of its phrase plus its dots."""
+    say = PHRASES.get(layout.lang)
+    if say is None:
+        raise LayoutError("%s: no built-in phrases for language %r" % (layout.path, layout.lang))
+    by_text = {}
+    for key, cells in layout.words.items():
+        by_text.setdefault(key.split("#", 1)[0], []).append(cells)
+    bad = 0
+    for h in range(24):
+        for m in range(60):
+            words = say(h, m)
+            lit = layout.frame_cells(h, m)
+            want_dots = set(layout.dots[: m % 5])
+            choices = [by_text.get(w, []) for w in words]
+            ok = False
+            # Words with the same text at several places: one placement must match
+            for pick in itertools.product(*choices):
+                if len(set(map(tuple, pick))) != len(pick):
+                    continue
+                if set().union(*map(set, pick)) | want_dots == lit:
+                    ok = True
+                    break
+            if not ok:
+                bad += 1
+                if bad <= 5:
+                    print("%s: %02d:%02d should read %r" % (layout.path, h, m, " ".join(words)), file=sys.stderr)
+    return bad
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("layouts", nargs="+", help="layout files (tools/wordclock/*.clock)")
+    ap.add_argument("--out-dir", default="src/hal/wordclock", help="where WordClock_<name>.hpp is written")
+    ap.add_argument("--check", action="store_true", help="verify all 1440 minutes instead of generating")
+    args = ap.parse_args()
+    failed = 0
+    for path in args.layouts:
+        try:
+            layout = Layout(path)
+            if args.check:
+                bad = check(layout)
+                print("%s: %s" % (path, "%d of 1440 minutes wrong" % bad if bad else "1440 minutes OK"))
+                failed += bad > 0
+            else:
+                out = os.path.join(args.out_dir, "WordClock_%s.hpp" % layout.name)
+                emit(layout, out)
+                print("%s -> %s (%d LEDs)" % (path, out, len(layout.wiring)))
+        except LayoutError as e:
+            print(e, file=sys.stderr)
+            failed += 1
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())